@@ -0,0 +1,462 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The most modes a group may hold. Since modes of unit length are dropped
+// and every other mode at least doubles the extent of its group, this limit
+// is never reached by a tensor that fits in memory.
+#define BAO_TCONTRACT_MAX_MODES 64
+
+// A group of modes that together form one dimension (m, n, or k) of the
+// matrix product, along with the strides of each mode in the two tensors
+// that share the group: (A, C) for m, (B, C) for n, and (A, B) for k.
+typedef struct
+{
+	dim_t n_mode;
+	dim_t len[ BAO_TCONTRACT_MAX_MODES ];
+	inc_t stride[ 2 ][ BAO_TCONTRACT_MAX_MODES ];
+} bao_tgroup_t;
+
+static void bao_tcontract_group_add
+     (
+       bao_tgroup_t* g,
+       dim_t         len,
+       inc_t         stride0,
+       inc_t         stride1
+     )
+{
+	// Modes of unit length do not contribute to the group.
+	if ( len == 1 ) return;
+
+	if ( g->n_mode == BAO_TCONTRACT_MAX_MODES )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	g->len[ g->n_mode ]         = len;
+	g->stride[ 0 ][ g->n_mode ] = stride0;
+	g->stride[ 1 ][ g->n_mode ] = stride1;
+	g->n_mode += 1;
+}
+
+// Sort the modes of a group by increasing stride in the tensor selected by
+// key, then merge each mode into its predecessor wherever it continues the
+// predecessor's layout in both tensors. A group that merges into a single
+// mode is addressed by one stride in each tensor.
+static void bao_tcontract_group_fold
+     (
+       bao_tgroup_t* g,
+       dim_t         key
+     )
+{
+	for ( dim_t d = 1; d < g->n_mode; ++d )
+	{
+		const dim_t len = g->len[ d ];
+		const inc_t s0  = g->stride[ 0 ][ d ];
+		const inc_t s1  = g->stride[ 1 ][ d ];
+		const inc_t sk  = bli_abs( g->stride[ key ][ d ] );
+
+		dim_t e = d;
+		for ( ; e > 0 && bli_abs( g->stride[ key ][ e - 1 ] ) > sk; --e )
+		{
+			g->len[ e ]         = g->len[ e - 1 ];
+			g->stride[ 0 ][ e ] = g->stride[ 0 ][ e - 1 ];
+			g->stride[ 1 ][ e ] = g->stride[ 1 ][ e - 1 ];
+		}
+		g->len[ e ]         = len;
+		g->stride[ 0 ][ e ] = s0;
+		g->stride[ 1 ][ e ] = s1;
+	}
+
+	dim_t w = 0;
+	for ( dim_t d = 1; d < g->n_mode; ++d )
+	{
+		if ( g->stride[ 0 ][ d ] == g->len[ w ] * g->stride[ 0 ][ w ] &&
+		     g->stride[ 1 ][ d ] == g->len[ w ] * g->stride[ 1 ][ w ] )
+		{
+			g->len[ w ] *= g->len[ d ];
+		}
+		else
+		{
+			w += 1;
+			g->len[ w ]         = g->len[ d ];
+			g->stride[ 0 ][ w ] = g->stride[ 0 ][ d ];
+			g->stride[ 1 ][ w ] = g->stride[ 1 ][ d ];
+		}
+	}
+	if ( g->n_mode > 0 ) g->n_mode = w + 1;
+}
+
+static dim_t bao_tcontract_group_len
+     (
+       const bao_tgroup_t* g
+     )
+{
+	dim_t len = 1;
+
+	for ( dim_t d = 0; d < g->n_mode; ++d ) len *= g->len[ d ];
+
+	return len;
+}
+
+// Return the stride of the group in tensor t if it consists of at most one
+// mode, or zero otherwise. An empty group has unit extent and is given unit
+// stride.
+static inc_t bao_tcontract_group_stride
+     (
+       const bao_tgroup_t* g,
+       dim_t               t
+     )
+{
+	if ( g->n_mode == 0 ) return 1;
+	if ( g->n_mode == 1 ) return g->stride[ t ][ 0 ];
+	return 0;
+}
+
+// Fill scat with the offsets in tensor t of every index of the group, with
+// the first mode varying fastest.
+static void bao_tcontract_group_scatter
+     (
+       const bao_tgroup_t* g,
+       dim_t               t,
+       inc_t*              scat
+     )
+{
+	const dim_t len = bao_tcontract_group_len( g );
+	dim_t       pos[ BAO_TCONTRACT_MAX_MODES ] = { 0 };
+	inc_t       off = 0;
+
+	for ( dim_t i = 0; i < len; ++i )
+	{
+		scat[ i ] = off;
+
+		for ( dim_t d = 0; d < g->n_mode; ++d )
+		{
+			off += g->stride[ t ][ d ];
+			if ( ++pos[ d ] < g->len[ d ] ) break;
+			off -= g->len[ d ] * g->stride[ t ][ d ];
+			pos[ d ] = 0;
+		}
+	}
+}
+
+//
+// -- Define the tcontract operation's thread entry point ----------------------
+//
+
+err_t bao_tcontract_int
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     )
+{
+	bao_tcontract_bp_var1
+	(
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm,
+	  thread
+	);
+
+	return BLIS_SUCCESS;
+}
+
+//
+// -- Define the tcontract operation's typed API -------------------------------
+//
+
+// C := beta * C + alpha * A * B, where A, B, and C are tensors whose modes are
+// labeled by the characters of idx_a, idx_b, and idx_c. Every label appears in
+// exactly two of the three tensors: the modes shared by A and C form the m
+// dimension of the equivalent gemm, those shared by B and C form n, and those
+// shared by A and B are summed over and form k.
+//
+// If each of m, n, and k folds into a single stride in every tensor, the
+// contraction is a gemm on strided views of the tensors and is computed by
+// bli_gemm_ex(). Otherwise, the tensors are viewed as block-scatter matrices
+// and computed by bao_tcontract_bp_var1(), which packs A and B directly from
+// the tensors, so that no permuted copy of any tensor is ever formed.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       ctype*       alpha, \
+       dim_t        ndim_a, const dim_t* len_a, const inc_t* stride_a, \
+                    const char*  idx_a, ctype* a, \
+       dim_t        ndim_b, const dim_t* len_b, const inc_t* stride_b, \
+                    const char*  idx_b, ctype* b, \
+       ctype*       beta, \
+       dim_t        ndim_c, const dim_t* len_c, const inc_t* stride_c, \
+                    const char*  idx_c, ctype* c  \
+     ) \
+{ \
+	PASTECH3(bao_,ch,opname,BLIS_TAPI_EX_SUF) \
+	( \
+	  alpha, \
+	  ndim_a, len_a, stride_a, idx_a, a, \
+	  ndim_b, len_b, stride_b, idx_b, b, \
+	  beta, \
+	  ndim_c, len_c, stride_c, idx_c, c, \
+	  NULL, \
+	  NULL  \
+	); \
+} \
+\
+void PASTECH3(bao_,ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+       ctype*       alpha, \
+       dim_t        ndim_a, const dim_t* len_a, const inc_t* stride_a, \
+                    const char*  idx_a, ctype* a, \
+       dim_t        ndim_b, const dim_t* len_b, const inc_t* stride_b, \
+                    const char*  idx_b, ctype* b, \
+       ctype*       beta, \
+       dim_t        ndim_c, const dim_t* len_c, const inc_t* stride_c, \
+                    const char*  idx_c, ctype* c, \
+       cntx_t*      cntx, \
+       rntm_t*      rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Check parameters. */ \
+	if ( bli_error_checking_is_enabled() ) \
+		bao_tcontract_check( ndim_a, len_a, stride_a, idx_a, \
+		                     ndim_b, len_b, stride_b, idx_b, \
+		                     ndim_c, len_c, stride_c, idx_c ); \
+\
+	/* Sort the modes into the m, n, and k groups. */ \
+	bao_tgroup_t gm = { 0 }; \
+	bao_tgroup_t gn = { 0 }; \
+	bao_tgroup_t gk = { 0 }; \
+\
+	for ( dim_t d = 0; d < ndim_a; ++d ) \
+	{ \
+		const dim_t dc = bao_tcontract_find_mode( ndim_c, idx_c, idx_a[ d ] ); \
+		const dim_t db = bao_tcontract_find_mode( ndim_b, idx_b, idx_a[ d ] ); \
+\
+		if      ( dc >= 0 ) bao_tcontract_group_add( &gm, len_a[ d ], \
+		                                         stride_a[ d ], stride_c[ dc ] ); \
+		else if ( db >= 0 ) bao_tcontract_group_add( &gk, len_a[ d ], \
+		                                         stride_a[ d ], stride_b[ db ] ); \
+	} \
+	for ( dim_t d = 0; d < ndim_b; ++d ) \
+	{ \
+		const dim_t dc = bao_tcontract_find_mode( ndim_c, idx_c, idx_b[ d ] ); \
+\
+		if      ( dc >= 0 ) bao_tcontract_group_add( &gn, len_b[ d ], \
+		                                         stride_b[ d ], stride_c[ dc ] ); \
+	} \
+\
+	/* Order m and n by their strides in C and k by its strides in A, and
+	   merge the modes that can be addressed together. */ \
+	bao_tcontract_group_fold( &gm, 1 ); \
+	bao_tcontract_group_fold( &gn, 1 ); \
+	bao_tcontract_group_fold( &gk, 0 ); \
+\
+	dim_t m = bao_tcontract_group_len( &gm ); \
+	dim_t n = bao_tcontract_group_len( &gn ); \
+	dim_t k = bao_tcontract_group_len( &gk ); \
+\
+	/* If C is empty, return early. */ \
+	if ( m == 0 || n == 0 ) return; \
+\
+	/* If every group is addressed by a single stride in each tensor, the
+	   contraction is a gemm on strided views of A, B, and C. */ \
+	{ \
+		const inc_t rs_a = bao_tcontract_group_stride( &gm, 0 ); \
+		const inc_t cs_a = bao_tcontract_group_stride( &gk, 0 ); \
+		const inc_t rs_b = bao_tcontract_group_stride( &gk, 1 ); \
+		const inc_t cs_b = bao_tcontract_group_stride( &gn, 0 ); \
+		const inc_t rs_c = bao_tcontract_group_stride( &gm, 1 ); \
+		const inc_t cs_c = bao_tcontract_group_stride( &gn, 1 ); \
+\
+		if ( rs_a > 0 && cs_a > 0 && rs_b > 0 && \
+		     cs_b > 0 && rs_c > 0 && cs_c > 0 && \
+		     bli_check_matrix_strides( m, k, rs_a, cs_a, 1 ) == BLIS_SUCCESS && \
+		     bli_check_matrix_strides( k, n, rs_b, cs_b, 1 ) == BLIS_SUCCESS && \
+		     bli_check_matrix_strides( m, n, rs_c, cs_c, 1 ) == BLIS_SUCCESS ) \
+		{ \
+			obj_t alphao, ao, bo, betao, co; \
+\
+			bli_obj_create_1x1_with_attached_buffer( dt, alpha, &alphao ); \
+			bli_obj_create_1x1_with_attached_buffer( dt, beta,  &betao  ); \
+\
+			bli_obj_create_with_attached_buffer( dt, m, k, a, rs_a, cs_a, &ao ); \
+			bli_obj_create_with_attached_buffer( dt, k, n, b, rs_b, cs_b, &bo ); \
+			bli_obj_create_with_attached_buffer( dt, m, n, c, rs_c, cs_c, &co ); \
+\
+			bli_gemm_ex( &alphao, &ao, &bo, &betao, &co, cntx, rntm ); \
+			return; \
+		} \
+	} \
+\
+	/* Initialize a local runtime with global settings if necessary. Note
+	   that in the case that a runtime is passed in, we make a local copy. */ \
+	rntm_t rntm_l; \
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; } \
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; } \
+\
+	/* Obtain a valid (native) context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* An optimization: If C is closer to row storage than to column storage
+	   and the microkernel prefers contiguous columns, or vice versa, swap the
+	   roles of A and B, which transposes the entire operation. */ \
+	{ \
+		const inc_t rs_c = bli_abs( gm.n_mode ? gm.stride[ 1 ][ 0 ] : 0 ); \
+		const inc_t cs_c = bli_abs( gn.n_mode ? gn.stride[ 1 ][ 0 ] : 0 ); \
+		const bool  col_pref \
+		= bli_cntx_l3_nat_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+		if ( rs_c != 0 && cs_c != 0 && \
+		     ( col_pref ? cs_c < rs_c : rs_c < cs_c ) ) \
+		{ \
+			bao_tgroup_t gt = gm; gm = gn; gn = gt; \
+			ctype*       t  = a;  a  = b;  b  = t; \
+			dim_t        mt = m;  m  = n;  n  = mt; \
+\
+			for ( dim_t d = 0; d < gk.n_mode; ++d ) \
+			{ \
+				const inc_t s = gk.stride[ 0 ][ d ]; \
+				gk.stride[ 0 ][ d ] = gk.stride[ 1 ][ d ]; \
+				gk.stride[ 1 ][ d ] = s; \
+			} \
+		} \
+	} \
+\
+	/* Compute the scatter vectors of A, B, and C. */ \
+	inc_t* restrict scat = bli_malloc_intl( 2 * ( m + n + k ) * sizeof( inc_t ) ); \
+\
+	inc_t* restrict rscat_a = scat; \
+	inc_t* restrict rscat_c = rscat_a + m; \
+	inc_t* restrict cscat_b = rscat_c + m; \
+	inc_t* restrict cscat_c = cscat_b + n; \
+	inc_t* restrict cscat_a = cscat_c + n; \
+	inc_t* restrict rscat_b = cscat_a + k; \
+\
+	bao_tcontract_group_scatter( &gm, 0, rscat_a ); \
+	bao_tcontract_group_scatter( &gm, 1, rscat_c ); \
+	bao_tcontract_group_scatter( &gn, 0, cscat_b ); \
+	bao_tcontract_group_scatter( &gn, 1, cscat_c ); \
+	bao_tcontract_group_scatter( &gk, 0, cscat_a ); \
+	bao_tcontract_group_scatter( &gk, 1, rscat_b ); \
+\
+	if ( k == 0 || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		/* If alpha is zero, or if A and B have a zero dimension, scale C by
+		   beta and return early. */ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			ctype* restrict c_ij = c + rscat_c[ i ] + cscat_c[ j ]; \
+\
+			if ( PASTEMAC(ch,eq0)( *beta ) ) { PASTEMAC(ch,set0s)( *c_ij ); } \
+			else                             { PASTEMAC(ch,scals)( *beta, *c_ij ); } \
+		} \
+	} \
+	else \
+	{ \
+		bao_bsmat_t bs_a = { a, rscat_a, cscat_a }; \
+		bao_bsmat_t bs_b = { b, rscat_b, cscat_b }; \
+		bao_bsmat_t bs_c = { c, rscat_c, cscat_c }; \
+\
+		obj_t alphao, ao, bo, betao, co; \
+\
+		bli_obj_create_1x1_with_attached_buffer( dt, alpha, &alphao ); \
+		bli_obj_create_1x1_with_attached_buffer( dt, beta,  &betao  ); \
+\
+		/* The operand objects only convey the datatype and the dimensions to
+		   the thread decorator; their buffers refer to the block-scatter
+		   descriptions of the tensors. */ \
+		bli_obj_create_without_buffer( dt, m, k, &ao ); \
+		bli_obj_create_without_buffer( dt, k, n, &bo ); \
+		bli_obj_create_without_buffer( dt, m, n, &co ); \
+		bli_obj_set_buffer( &bs_a, &ao ); \
+		bli_obj_set_buffer( &bs_b, &bo ); \
+		bli_obj_set_buffer( &bs_c, &co ); \
+\
+		/* Parse and interpret the contents of the rntm_t object to properly
+		   set the ways of parallelism for each loop. */ \
+		bli_rntm_set_ways_for_op \
+		( \
+		  BLIS_GEMM, \
+		  BLIS_LEFT, /* ignored for gemm/hemm/symm */ \
+		  m, n, k, \
+		  rntm  \
+		); \
+\
+		/* Both A and B are always packed. (The sup thread infrastructure
+		   only creates the communicators needed for packing when it is told
+		   that at least one of them will be.) */ \
+		bli_rntm_set_pack_a( TRUE, rntm ); \
+		bli_rntm_set_pack_b( TRUE, rntm ); \
+\
+		/* Spawn threads (if applicable), where bao_tcontract_int() is the
+		   thread entry point function for each thread. */ \
+		bli_l3_sup_thread_decorator \
+		( \
+		  bao_tcontract_int, \
+		  BLIS_GEMM, /* operation family id */ \
+		  &alphao, \
+		  &ao, \
+		  &bo, \
+		  &betao, \
+		  &co, \
+		  cntx, \
+		  rntm  \
+		); \
+	} \
+\
+	bli_free_intl( scat ); \
+}
+
+//INSERT_GENTFUNC_BASIC0( tcontract )
+GENTFUNC( float,    s, tcontract )
+GENTFUNC( double,   d, tcontract )
+GENTFUNC( scomplex, c, tcontract )
+GENTFUNC( dcomplex, z, tcontract )
+
@@ -0,0 +1,134 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// -- Define the block-scatter matrix type -------------------------------------
+//
+
+// A tensor operand viewed as a matrix whose row and column indices are each
+// formed from one or more tensor modes. Element (i,j) of the matrix resides
+// at buf + rscat[i] + cscat[j], where the scatter vectors hold the offsets
+// (in units of elements) obtained by combining the modes of each group.
+typedef struct
+{
+	void*  buf;
+	inc_t* rscat;
+	inc_t* cscat;
+} bao_bsmat_t;
+
+// Return the constant stride of the n offsets in scat, or zero if the offsets
+// are not evenly spaced. Blocks of at most one element are given unit stride.
+BLIS_INLINE inc_t bao_tcontract_block_stride( dim_t n, const inc_t* scat )
+{
+	if ( n <= 1 ) return 1;
+
+	const inc_t bs = scat[ 1 ] - scat[ 0 ];
+
+	for ( dim_t i = 2; i < n; ++i )
+		if ( scat[ i ] - scat[ i - 1 ] != bs ) return 0;
+
+	return bs;
+}
+
+// Find the mode of a tensor labeled x. Return -1 if there is none and -2 if
+// there is more than one.
+BLIS_INLINE dim_t bao_tcontract_find_mode( dim_t ndim, const char* idx, char x )
+{
+	dim_t found = -1;
+
+	for ( dim_t d = 0; d < ndim; ++d )
+	{
+		if ( idx[ d ] != x ) continue;
+		if ( found != -1 ) return -2;
+		found = d;
+	}
+
+	return found;
+}
+
+//
+// -- Prototype the tcontract operation's thread entry point -------------------
+//
+
+err_t bao_tcontract_int
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     );
+
+//
+// -- Prototype the tcontract operation's typed API ----------------------------
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+     ( \
+       ctype*       alpha, \
+       dim_t        ndim_a, const dim_t* len_a, const inc_t* stride_a, \
+                    const char*  idx_a, ctype* a, \
+       dim_t        ndim_b, const dim_t* len_b, const inc_t* stride_b, \
+                    const char*  idx_b, ctype* b, \
+       ctype*       beta, \
+       dim_t        ndim_c, const dim_t* len_c, const inc_t* stride_c, \
+                    const char*  idx_c, ctype* c  \
+     ); \
+\
+BLIS_EXPORT_ADDON void PASTECH3(bao_,ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+       ctype*       alpha, \
+       dim_t        ndim_a, const dim_t* len_a, const inc_t* stride_a, \
+                    const char*  idx_a, ctype* a, \
+       dim_t        ndim_b, const dim_t* len_b, const inc_t* stride_b, \
+                    const char*  idx_b, ctype* b, \
+       ctype*       beta, \
+       dim_t        ndim_c, const dim_t* len_c, const inc_t* stride_c, \
+                    const char*  idx_c, ctype* c, \
+       cntx_t*      cntx, \
+       rntm_t*      rntm  \
+     );
+
+//INSERT_GENTPROT_BASIC0( tcontract )
+GENTPROT( float,    s, tcontract )
+GENTPROT( double,   d, tcontract )
+GENTPROT( scomplex, c, tcontract )
+GENTPROT( dcomplex, z, tcontract )
+
@@ -0,0 +1,473 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#define FUNCPTR_T tcontract_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       dim_t            m,
+       dim_t            n,
+       dim_t            k,
+       void*   restrict alpha,
+       void*   restrict a, const inc_t* rscat_a, const inc_t* cscat_a,
+       void*   restrict b, const inc_t* rscat_b, const inc_t* cscat_b,
+       void*   restrict beta,
+       void*   restrict c, const inc_t* rscat_c, const inc_t* cscat_c,
+       cntx_t* restrict cntx,
+       rntm_t* restrict rntm,
+       thrinfo_t* restrict thread
+     );
+
+//
+// -- Block-scatter block-panel algorithm (object interface) -------------------
+//
+
+// Define a function pointer array named ftypes and initialize its contents with
+// the addresses of the typed functions defined below, bao_?tcontract_bp_var1().
+static FUNCPTR_T GENARRAY_PREF(ftypes,bao_,tcontract_bp_var1);
+
+void bao_tcontract_bp_var1
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     )
+{
+	const num_t    dt        = bli_obj_dt( c );
+
+	const dim_t    m         = bli_obj_length( c );
+	const dim_t    n         = bli_obj_width( c );
+	const dim_t    k         = bli_obj_width( a );
+
+	// The operand objects only carry the datatype and the dimensions; their
+	// buffers refer to the block-scatter descriptions of the tensors.
+	bao_bsmat_t*   bs_a      = bli_obj_buffer( a );
+	bao_bsmat_t*   bs_b      = bli_obj_buffer( b );
+	bao_bsmat_t*   bs_c      = bli_obj_buffer( c );
+
+	void* restrict buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+	void* restrict buf_beta  = bli_obj_buffer_for_1x1( dt, beta );
+
+	// Index into the function pointer array to extract the correct
+	// typed function pointer based on the chosen datatype.
+	FUNCPTR_T f = ftypes[dt];
+
+	// Invoke the function.
+	f
+	(
+	  m,
+	  n,
+	  k,
+	  buf_alpha,
+	  bs_a->buf, bs_a->rscat, bs_a->cscat,
+	  bs_b->buf, bs_b->rscat, bs_b->cscat,
+	  buf_beta,
+	  bs_c->buf, bs_c->rscat, bs_c->cscat,
+	  cntx,
+	  rntm,
+	  thread
+	);
+}
+
+//
+// -- Block-scatter block-panel algorithm (typed interface) --------------------
+//
+
+// This is the conventional five-loop algorithm, except that A, B, and C are
+// addressed through scatter vectors rather than through a pair of strides.
+// The blocks of A and B are packed by bao_?tcontract_packm(), after which the
+// microkernel sees the same micropanels it would for a plain gemm. Microtiles
+// of C whose row and column offsets are each evenly spaced are updated in
+// place; the rest are computed into a temporary and scattered into C.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+       dim_t            m, \
+       dim_t            n, \
+       dim_t            k, \
+       void*   restrict alpha, \
+       void*   restrict a, const inc_t* rscat_a, const inc_t* cscat_a, \
+       void*   restrict b, const inc_t* rscat_b, const inc_t* cscat_b, \
+       void*   restrict beta, \
+       void*   restrict c, const inc_t* rscat_c, const inc_t* cscat_c, \
+       cntx_t* restrict cntx, \
+       rntm_t* restrict rntm, \
+       thrinfo_t* restrict thread  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Query the context for various blocksizes. */ \
+	const dim_t NR  = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t MR  = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NC  = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx ); \
+	const dim_t MC  = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t KC  = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx ); \
+\
+	/* Query the context for the microkernel address and cast it to its
+	   function pointer type. */ \
+	PASTECH(ch,gemm_ukr_ft) \
+               gemm_ukr = bli_cntx_get_l3_nat_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* Temporary C buffer for edge cases and for microtiles that cannot be
+	   updated in place. Its storage matches the microkernel's preference. */ \
+	ctype       ct[ BLIS_STACK_BUF_MAX_SIZE \
+	                / sizeof( ctype ) ] \
+	                __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const bool col_pref = bli_cntx_l3_nat_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	const inc_t rs_ct   = ( col_pref ? 1 : NR ); \
+	const inc_t cs_ct   = ( col_pref ? MR : 1 ); \
+\
+	ctype* restrict a_00       = a; \
+	ctype* restrict b_00       = b; \
+	ctype* restrict c_00       = c; \
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict beta_cast  = beta; \
+\
+	/* Make local copies of the scalars to prevent any unnecessary sharing of
+	   cache lines between the cores' caches. */ \
+	ctype           alpha_local = *alpha_cast; \
+	ctype           beta_local  = *beta_cast; \
+	ctype           one_local   = *PASTEMAC(ch,1); \
+	ctype           zero_local  = *PASTEMAC(ch,0); \
+\
+	auxinfo_t       aux; \
+\
+	/* Initialize a mem_t entry for A and B. */ \
+	mem_t mem_a = BLIS_MEM_INITIALIZER; \
+	mem_t mem_b = BLIS_MEM_INITIALIZER; \
+\
+	/* Define an array of bszid_t ids, which will act as our substitute for
+	   the cntl_t tree. */ \
+	bszid_t bszids[8] = { BLIS_NC,      /* 5th loop */ \
+	                      BLIS_KC,      /* 4th loop */ \
+	                      BLIS_NO_PART, /* pack B */ \
+	                      BLIS_MC,      /* 3rd loop */ \
+	                      BLIS_NO_PART, /* pack A */ \
+	                      BLIS_NR,      /* 2nd loop */ \
+	                      BLIS_MR,      /* 1st loop */ \
+	                      BLIS_KR };    /* microkernel loop */  \
+\
+	bszid_t* restrict bszids_jc = &bszids[0]; \
+	bszid_t* restrict bszids_pc = &bszids[1]; \
+	bszid_t* restrict bszids_ic = &bszids[3]; \
+	bszid_t* restrict bszids_jr = &bszids[5]; \
+\
+	thrinfo_t* restrict thread_jc = NULL; \
+	thrinfo_t* restrict thread_pc = NULL; \
+	thrinfo_t* restrict thread_pb = NULL; \
+	thrinfo_t* restrict thread_ic = NULL; \
+	thrinfo_t* restrict thread_pa = NULL; \
+	thrinfo_t* restrict thread_jr = NULL; \
+	thrinfo_t* restrict thread_ir = NULL; \
+\
+	/* Identify the current thrinfo_t node and then grow the tree. */ \
+	thread_jc = thread; \
+	bli_thrinfo_sup_grow( rntm, bszids_jc, thread_jc ); \
+\
+	/* Compute the JC loop thread range for the current thread. */ \
+	dim_t jc_start, jc_end; \
+	bli_thread_range_sub( thread_jc, n, NR, FALSE, &jc_start, &jc_end ); \
+\
+	/* Loop over the n dimension (NC columns at a time). */ \
+	for ( dim_t jj = jc_start; jj < jc_end; jj += NC ) \
+	{ \
+		/* Calculate the thread's current JC block dimension. */ \
+		const dim_t nc_cur = bli_min( NC, jc_end - jj ); \
+\
+		/* Identify the current thrinfo_t node and then grow the tree. */ \
+		thread_pc = bli_thrinfo_sub_node( thread_jc ); \
+		bli_thrinfo_sup_grow( rntm, bszids_pc, thread_pc ); \
+\
+		/* Loop over the k dimension (KC rows/columns at a time). */ \
+		for ( dim_t pp = 0; pp < k; pp += KC ) \
+		{ \
+			/* Calculate the thread's current PC block dimension. */ \
+			const dim_t kc_cur = bli_min( KC, k - pp ); \
+\
+			/* Only apply beta to the first iteration of the pc loop. */ \
+			ctype* restrict beta_use = ( pp == 0 ? &beta_local : &one_local ); \
+			const bool      beta_is0 = PASTEMAC(ch,eq0)( *beta_use ); \
+\
+			/* Identify the current thrinfo_t node. Note that the thrinfo_t
+			   node will have already been created by a previous call to
+			   bli_thrinfo_sup_grow() since bszid_t values of BLIS_NO_PART
+			   cause the tree to grow by two (e.g. to the next bszid that is
+			   a normal bszid_t value). */ \
+			thread_pb = bli_thrinfo_sub_node( thread_pc ); \
+\
+			/* Acquire (or reuse) the packing buffer for B and pack the
+			   current block of B into it. */ \
+			PASTEMAC(ch,packm_sup_init_mem_b) \
+			( \
+			  TRUE, BLIS_BUFFER_FOR_B_PANEL, \
+			  KC, NC, NR, \
+			  cntx, rntm, &mem_b, thread_pb  \
+			); \
+\
+			ctype* restrict b_pc_use = bli_mem_buffer( &mem_b ); \
+			const inc_t     ps_b_use = NR * kc_cur; \
+\
+			PASTECH2(bao_,ch,tcontract_packm) \
+			( \
+			  BLIS_PACKED_COL_PANELS, \
+			  nc_cur, kc_cur, NR, \
+			  b_00, cscat_b + jj, rscat_b + pp, \
+			  b_pc_use, ps_b_use, \
+			  cntx, \
+			  thread_pb  \
+			); \
+\
+			/* Identify the current thrinfo_t node and then grow the tree. */ \
+			thread_ic = bli_thrinfo_sub_node( thread_pb ); \
+			bli_thrinfo_sup_grow( rntm, bszids_ic, thread_ic ); \
+\
+			/* Compute the IC loop thread range for the current thread. */ \
+			dim_t ic_start, ic_end; \
+			bli_thread_range_sub( thread_ic, m, MR, FALSE, &ic_start, &ic_end ); \
+\
+			/* Loop over the m dimension (MC rows at a time). */ \
+			for ( dim_t ii = ic_start; ii < ic_end; ii += MC ) \
+			{ \
+				/* Calculate the thread's current IC block dimension. */ \
+				const dim_t mc_cur = bli_min( MC, ic_end - ii ); \
+\
+				/* Identify the current thrinfo_t node. */ \
+				thread_pa = bli_thrinfo_sub_node( thread_ic ); \
+\
+				/* Acquire (or reuse) the packing buffer for A and pack the
+				   current block of A into it. */ \
+				PASTEMAC(ch,packm_sup_init_mem_a) \
+				( \
+				  TRUE, BLIS_BUFFER_FOR_A_BLOCK, \
+				  MC, KC, MR, \
+				  cntx, rntm, &mem_a, thread_pa  \
+				); \
+\
+				ctype* restrict a_ic_use = bli_mem_buffer( &mem_a ); \
+				const inc_t     ps_a_use = MR * kc_cur; \
+\
+				PASTECH2(bao_,ch,tcontract_packm) \
+				( \
+				  BLIS_PACKED_ROW_PANELS, \
+				  mc_cur, kc_cur, MR, \
+				  a_00, rscat_a + ii, cscat_a + pp, \
+				  a_ic_use, ps_a_use, \
+				  cntx, \
+				  thread_pa  \
+				); \
+\
+				/* Identify the current thrinfo_t node and then grow the tree. */ \
+				thread_jr = bli_thrinfo_sub_node( thread_pa ); \
+				bli_thrinfo_sup_grow( rntm, bszids_jr, thread_jr ); \
+\
+				/* Query the number of threads and thread ids for the JR loop.
+				   NOTE: These values are only needed when computing the next
+				   micropanel of B. */ \
+				const dim_t jr_nt  = bli_thread_n_way( thread_jr ); \
+				const dim_t jr_tid = bli_thread_work_id( thread_jr ); \
+\
+				/* Compute number of primary and leftover components of the JR loop. */ \
+				dim_t jr_iter = ( nc_cur + NR - 1 ) / NR; \
+				dim_t jr_left =   nc_cur % NR; \
+\
+				/* Compute the JR loop thread range for the current thread. */ \
+				dim_t jr_start, jr_end; \
+				bli_thread_range_sub( thread_jr, jr_iter, 1, FALSE, &jr_start, &jr_end ); \
+\
+				/* Loop over the n dimension (NR columns at a time). */ \
+				for ( dim_t j = jr_start; j < jr_end; j += 1 ) \
+				{ \
+					const dim_t nr_cur \
+					= ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left ); \
+\
+					ctype* restrict       b_jr     = b_pc_use + j * ps_b_use; \
+					const inc_t* restrict cscat_jr = cscat_c + jj + j * NR; \
+					const inc_t           cbs      = \
+					bao_tcontract_block_stride( nr_cur, cscat_jr ); \
+\
+					/* Assume for now that our next panel of B to be the current panel
+					   of B. */ \
+					ctype* restrict b2 = b_jr; \
+\
+					/* Identify the current thrinfo_t node. */ \
+					thread_ir = bli_thrinfo_sub_node( thread_jr ); \
+\
+					/* Query the number of threads and thread ids for the IR loop.
+					   NOTE: These values are only needed when computing the next
+					   micropanel of A. */ \
+					const dim_t ir_nt  = bli_thread_n_way( thread_ir ); \
+					const dim_t ir_tid = bli_thread_work_id( thread_ir ); \
+\
+					/* Compute number of primary and leftover components of the IR loop. */ \
+					dim_t ir_iter = ( mc_cur + MR - 1 ) / MR; \
+					dim_t ir_left =   mc_cur % MR; \
+\
+					/* Compute the IR loop thread range for the current thread. */ \
+					dim_t ir_start, ir_end; \
+					bli_thread_range_sub( thread_ir, ir_iter, 1, FALSE, &ir_start, &ir_end ); \
+\
+					/* Loop over the m dimension (MR rows at a time). */ \
+					for ( dim_t i = ir_start; i < ir_end; i += 1 ) \
+					{ \
+						const dim_t mr_cur \
+						= ( bli_is_not_edge_f( i, ir_iter, ir_left ) ? MR : ir_left ); \
+\
+						ctype* restrict       a_ir     = a_ic_use + i * ps_a_use; \
+						const inc_t* restrict rscat_ir = rscat_c + ii + i * MR; \
+						const inc_t           rbs      = \
+						bao_tcontract_block_stride( mr_cur, rscat_ir ); \
+						ctype* restrict       c_ir     = \
+						c_00 + rscat_ir[ 0 ] + cscat_jr[ 0 ]; \
+\
+						ctype* restrict a2; \
+\
+						/* Compute the addresses of the next micropanels of A and B. */ \
+						a2 = bli_gemm_get_next_a_upanel( a_ir, ps_a_use, 1 ); \
+						if ( bli_is_last_iter( i, ir_end, ir_tid, ir_nt ) ) \
+						{ \
+							a2 = a_ic_use; \
+							b2 = bli_gemm_get_next_b_upanel( b_jr, ps_b_use, 1 ); \
+							if ( bli_is_last_iter( j, jr_end, jr_tid, jr_nt ) ) \
+								b2 = b_pc_use; \
+						} \
+\
+						/* Save the addresses of next micropanels of A and B to the
+						   auxinfo_t object. */ \
+						bli_auxinfo_set_next_a( a2, &aux ); \
+						bli_auxinfo_set_next_b( b2, &aux ); \
+\
+						if ( rbs != 0 && cbs != 0 && \
+						     mr_cur == MR && nr_cur == NR ) \
+						{ \
+							/* The microtile is an ordinary strided submatrix of C,
+							   so the microkernel updates it in place. */ \
+							gemm_ukr \
+							( \
+							  kc_cur, \
+							  &alpha_local, \
+							  a_ir, \
+							  b_jr, \
+							  beta_use, \
+							  c_ir, rbs, cbs, \
+							  &aux, \
+							  cntx  \
+							); \
+						} \
+						else \
+						{ \
+							/* Invoke the gemm microkernel. */ \
+							gemm_ukr \
+							( \
+							  kc_cur, \
+							  &alpha_local, \
+							  a_ir, \
+							  b_jr, \
+							  &zero_local, \
+							  ct, rs_ct, cs_ct, \
+							  &aux, \
+							  cntx  \
+							); \
+\
+							if ( rbs != 0 && cbs != 0 ) \
+							{ \
+								/* Scale the edge of C and add the result from above. */ \
+								PASTEMAC(ch,xpbys_mxn) \
+								( \
+								  mr_cur, \
+								  nr_cur, \
+								  ct,   rs_ct, cs_ct, \
+								  beta_use, \
+								  c_ir, rbs,   cbs \
+								); \
+							} \
+							else \
+							{ \
+								/* Scatter the result from above into C. */ \
+								for ( dim_t jt = 0; jt < nr_cur; ++jt ) \
+								for ( dim_t it = 0; it < mr_cur; ++it ) \
+								{ \
+									ctype* restrict ct_ij = ct + it * rs_ct + jt * cs_ct; \
+									ctype* restrict c_ij  = c_00 + rscat_ir[ it ] \
+									                             + cscat_jr[ jt ]; \
+\
+									if ( beta_is0 ) { PASTEMAC(ch,copys)( *ct_ij, *c_ij ); } \
+									else { PASTEMAC(ch,xpbys)( *ct_ij, *beta_use, *c_ij ); } \
+								} \
+							} \
+						} \
+					} \
+				} \
+			} \
+\
+			/* This barrier is needed to prevent threads from starting to pack
+			   the next row panel of B before the current row panel is fully
+			   computed upon. */ \
+			bli_thread_barrier( thread_pb ); \
+		} \
+	} \
+\
+	/* Release any memory that was acquired for packing matrices A and B. */ \
+	PASTEMAC(ch,packm_sup_finalize_mem_a) \
+	( \
+	  TRUE, \
+	  rntm, \
+	  &mem_a, \
+	  thread_pa  \
+	); \
+	PASTEMAC(ch,packm_sup_finalize_mem_b) \
+	( \
+	  TRUE, \
+	  rntm, \
+	  &mem_b, \
+	  thread_pb  \
+	); \
+}
+
+//INSERT_GENTFUNC_BASIC0( tcontract_bp_var1 )
+GENTFUNC( float,    s, tcontract_bp_var1 )
+GENTFUNC( double,   d, tcontract_bp_var1 )
+GENTFUNC( scomplex, c, tcontract_bp_var1 )
+GENTFUNC( dcomplex, z, tcontract_bp_var1 )
+
@@ -0,0 +1,114 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Check the mode count, the mode lengths, and the pointers of one tensor.
+static err_t bao_tcontract_check_tensor
+     (
+       dim_t        ndim,
+       const dim_t* len,
+       const inc_t* stride,
+       const char*  idx
+     )
+{
+	if ( ndim < 0 ) return BLIS_NEGATIVE_DIMENSION;
+
+	if ( ndim > 0 && ( len == NULL || stride == NULL || idx == NULL ) )
+		return BLIS_NULL_POINTER;
+
+	for ( dim_t d = 0; d < ndim; ++d )
+		if ( len[ d ] < 0 ) return BLIS_NEGATIVE_DIMENSION;
+
+	return BLIS_SUCCESS;
+}
+
+void bao_tcontract_check
+     (
+       dim_t        ndim_a, const dim_t* len_a, const inc_t* stride_a,
+                    const char*  idx_a,
+       dim_t        ndim_b, const dim_t* len_b, const inc_t* stride_b,
+                    const char*  idx_b,
+       dim_t        ndim_c, const dim_t* len_c, const inc_t* stride_c,
+                    const char*  idx_c
+     )
+{
+	err_t e_val;
+
+	// Check the mode counts, mode lengths, and pointers.
+
+	e_val = bao_tcontract_check_tensor( ndim_a, len_a, stride_a, idx_a );
+	bli_check_error_code( e_val );
+
+	e_val = bao_tcontract_check_tensor( ndim_b, len_b, stride_b, idx_b );
+	bli_check_error_code( e_val );
+
+	e_val = bao_tcontract_check_tensor( ndim_c, len_c, stride_c, idx_c );
+	bli_check_error_code( e_val );
+
+	// Check that every mode label appears in exactly two of the three
+	// tensors, at most once in each, and with the same length in both.
+	// Labels that appear in all three tensors (batch modes), in only one
+	// (traces and broadcasts), or more than once in a tensor (diagonals)
+	// do not describe a contraction that maps onto a single gemm.
+
+	const dim_t        ndim[3] = { ndim_a, ndim_b, ndim_c };
+	const dim_t* const len[3]  = { len_a,  len_b,  len_c  };
+	const char*  const idx[3]  = { idx_a,  idx_b,  idx_c  };
+
+	for ( dim_t t = 0; t < 3; ++t )
+	for ( dim_t d = 0; d < ndim[ t ]; ++d )
+	{
+		dim_t n_tensors = 0;
+
+		for ( dim_t u = 0; u < 3; ++u )
+		{
+			const dim_t du = bao_tcontract_find_mode( ndim[ u ], idx[ u ],
+			                                          idx[ t ][ d ] );
+
+			if ( du == -2 ) e_val = BLIS_NOT_YET_IMPLEMENTED;
+			else if ( du >= 0 )
+			{
+				if ( len[ u ][ du ] != len[ t ][ d ] )
+					e_val = BLIS_NONCONFORMAL_DIMENSIONS;
+				++n_tensors;
+			}
+			bli_check_error_code( e_val );
+		}
+
+		if ( n_tensors != 2 ) e_val = BLIS_NOT_YET_IMPLEMENTED;
+		bli_check_error_code( e_val );
+	}
+}
+
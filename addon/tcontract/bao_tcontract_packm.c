@@ -0,0 +1,159 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// -- Block-scatter packing ----------------------------------------------------
+//
+
+// Pack a block of a block-scatter matrix into micropanels of panel_dim_max
+// rows (for A) or columns (for B). Where the offsets of a micropanel in dscat
+// are evenly spaced, the k dimension is split into runs of evenly spaced
+// offsets in lscat, and each run, being an ordinary strided submatrix, is
+// handed to the context's packm kernel. Everything else is gathered element
+// by element through the scatter vectors.
+
+// The shortest run along k that is packed with the packm kernel.
+#define BAO_TCONTRACT_PACKM_MIN_RUN 4
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       pack_t           schema, \
+       dim_t            iter_dim, \
+       dim_t            panel_len, \
+       dim_t            panel_dim_max, \
+       ctype*  restrict x, const inc_t* dscat, const inc_t* lscat, \
+       ctype*  restrict p, inc_t ps_p, \
+       cntx_t* restrict cntx, \
+       thrinfo_t* restrict thread  \
+     ) \
+{ \
+	ctype* restrict one = PASTEMAC(ch,1); \
+\
+	/* Compute the total number of iterations we'll need. */ \
+	const dim_t n_iter = iter_dim / panel_dim_max + \
+	                   ( iter_dim % panel_dim_max ? 1 : 0 ); \
+\
+	/* Query the number of threads and thread ids from the current thread's
+	   packm thrinfo_t node. */ \
+	const dim_t nt  = bli_thread_n_way( thread ); \
+	const dim_t tid = bli_thread_work_id( thread ); \
+\
+	/* Suppress warnings in case tid isn't used (ie: as in slab partitioning). */ \
+	( void )nt; \
+	( void )tid; \
+\
+	dim_t it_start, it_end, it_inc; \
+\
+	/* Determine the thread range and increment using the current thread's
+	   packm thrinfo_t node. */ \
+	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &it_start, &it_end, &it_inc ); \
+\
+	/* Iterate over every logical micropanel in the source matrix. */ \
+	for ( dim_t it = 0; it < n_iter; it += 1 ) \
+	{ \
+		if ( !bli_packm_my_iter( it, it_start, it_end, tid, nt ) ) continue; \
+\
+		const dim_t           ic          = it * panel_dim_max; \
+		const dim_t           panel_dim_i = bli_min( panel_dim_max, iter_dim - ic ); \
+		const inc_t* restrict dscat_i     = dscat + ic; \
+		ctype*       restrict p_use       = p + it * ps_p; \
+\
+		const inc_t dbs = bao_tcontract_block_stride( panel_dim_i, dscat_i ); \
+\
+		for ( dim_t l0 = 0, l1; l0 < panel_len; l0 = l1 ) \
+		{ \
+			/* Find the longest run of evenly spaced offsets in lscat that
+			   begins at l0. */ \
+			inc_t lbs = 1; \
+\
+			l1 = l0 + 1; \
+			if ( l1 < panel_len ) \
+			{ \
+				lbs = lscat[ l1 ] - lscat[ l0 ]; \
+				while ( l1 < panel_len && lscat[ l1 ] - lscat[ l1 - 1 ] == lbs ) ++l1; \
+			} \
+\
+			ctype* restrict p_run = p_use + l0 * panel_dim_max; \
+\
+			if ( dbs != 0 && l1 - l0 >= BAO_TCONTRACT_PACKM_MIN_RUN ) \
+			{ \
+				PASTEMAC(ch,packm_cxk) \
+				( \
+				  BLIS_NO_CONJUGATE, \
+				  schema, \
+				  panel_dim_i, \
+				  panel_dim_max, \
+				  l1 - l0, \
+				  l1 - l0, \
+				  one, \
+				  x + dscat_i[ 0 ] + lscat[ l0 ], dbs, lbs, \
+				  p_run,                               panel_dim_max, \
+				  cntx  \
+				); \
+			} \
+			else \
+			{ \
+				for ( dim_t l = l0; l < l1; ++l ) \
+				{ \
+					ctype* restrict x_l = x + lscat[ l ]; \
+					ctype* restrict p_l = p_use + l * panel_dim_max; \
+\
+					for ( dim_t i = 0; i < panel_dim_i; ++i ) \
+					{ \
+						PASTEMAC(ch,copys)( x_l[ dscat_i[ i ] ], p_l[ i ] ); \
+					} \
+					for ( dim_t i = panel_dim_i; i < panel_dim_max; ++i ) \
+					{ \
+						PASTEMAC(ch,set0s)( p_l[ i ] ); \
+					} \
+				} \
+			} \
+		} \
+	} \
+\
+	/* Barrier so that packing is done before computation. */ \
+	bli_thread_barrier( thread ); \
+}
+
+//INSERT_GENTFUNC_BASIC0( tcontract_packm )
+GENTFUNC( float,    s, tcontract_packm )
+GENTFUNC( double,   d, tcontract_packm )
+GENTFUNC( scomplex, c, tcontract_packm )
+GENTFUNC( dcomplex, z, tcontract_packm )
+
@@ -0,0 +1,956 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2022, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+
+// Benchmark application to replay complete aocl logs generated by BLIS
+// library. Unlike the per-operation bench drivers, the log may contain any
+// mix of operations. Identical calls are grouped into a single shape, each
+// shape is timed once with the requested number of repetitions and the
+// results are written as a JSON report. When a baseline report (generated
+// by an earlier run of this application) is given, every shape is compared
+// against it and shapes slower than the tolerance are flagged.
+
+#ifndef N_REPEAT
+//#define N_REPEAT 100
+#endif
+
+#define BUFFER_SIZE      1024
+#define API_SIZE         32
+#define ARGS_SIZE        256
+
+#define REPLAY_FLUSH_MB  128
+#define REPLAY_TOL_PCT   5.0
+
+typedef enum
+{
+    REPLAY_GEMM = 0,
+    REPLAY_GEMMT,
+    REPLAY_TRSM,
+    REPLAY_TRMM,
+    REPLAY_SYRK,
+    REPLAY_HERK,
+    REPLAY_GEMV,
+    REPLAY_GER,
+    REPLAY_GERU,
+    REPLAY_GERC,
+    REPLAY_DOT,
+    REPLAY_AXPY,
+    REPLAY_SCAL,
+    REPLAY_COPY,
+    REPLAY_SWAP,
+    REPLAY_NUM_OPS
+} replay_op_t;
+
+static const char* replay_op_names[ REPLAY_NUM_OPS ] =
+{
+    "gemm", "gemmt", "trsm", "trmm", "syrk", "herk", "gemv",
+    "ger", "geru", "gerc", "dot", "axpy", "scal", "copy", "swap"
+};
+
+// One unique call found in the log.
+typedef struct
+{
+    char   api[ API_SIZE ];
+    char   args[ ARGS_SIZE ];
+    dim_t  calls;          // number of occurrences in the log
+    dim_t  nt;             // threads recorded in the log (0 if absent)
+    int    replayed;
+    double time;           // best time in seconds
+    double gflops;
+    double base_time;      // baseline best time, or 0 if not found
+} replay_rec_t;
+
+// Parsed arguments and operands of one call.
+typedef struct
+{
+    replay_op_t op;
+    num_t       dt;
+    char        side, uplo, transa, transb, diag;
+    f77_int     m, n, k;
+    f77_int     lda, ldb, ldc;
+    f77_int     incx, incy;
+    double      alpha_r, alpha_i, beta_r, beta_i;
+    double      flops;
+
+    scomplex    alpha_s, beta_s;
+    dcomplex    alpha_d, beta_d;
+
+    void*       a;
+    void*       b;
+    void*       c;
+    void*       c_save;
+    siz_t       c_size;
+} replay_call_t;
+
+typedef struct
+{
+    replay_rec_t* recs;
+    dim_t         n_recs;
+    dim_t         n_alloc;
+    dim_t*        hash;      // indices into recs, -1 when empty
+    dim_t         n_hash;
+} replay_tab_t;
+
+
+// -- Record table -------------------------------------------------------------
+
+static unsigned long replay_hash_key( const char* api, const char* args )
+{
+    // FNV-1a over api and args.
+    unsigned long h = 2166136261UL;
+    const char*   s;
+
+    for ( s = api;  *s; ++s ) { h ^= ( unsigned char )*s; h *= 16777619UL; }
+    h ^= ' ';
+    for ( s = args; *s; ++s ) { h ^= ( unsigned char )*s; h *= 16777619UL; }
+
+    return h;
+}
+
+static void replay_tab_rehash( replay_tab_t* tab, dim_t n_hash )
+{
+    dim_t i;
+
+    free( tab->hash );
+
+    tab->n_hash = n_hash;
+    tab->hash   = malloc( n_hash * sizeof( dim_t ) );
+
+    for ( i = 0; i < n_hash; ++i ) tab->hash[ i ] = -1;
+
+    for ( i = 0; i < tab->n_recs; ++i )
+    {
+        dim_t h = replay_hash_key( tab->recs[ i ].api, tab->recs[ i ].args ) & ( n_hash - 1 );
+
+        while ( tab->hash[ h ] != -1 ) h = ( h + 1 ) & ( n_hash - 1 );
+
+        tab->hash[ h ] = i;
+    }
+}
+
+static replay_rec_t* replay_tab_find( replay_tab_t* tab, const char* api, const char* args )
+{
+    dim_t h;
+
+    if ( tab->n_hash == 0 ) return NULL;
+
+    h = replay_hash_key( api, args ) & ( tab->n_hash - 1 );
+
+    while ( tab->hash[ h ] != -1 )
+    {
+        replay_rec_t* rec = &tab->recs[ tab->hash[ h ] ];
+
+        if ( strcmp( rec->api, api ) == 0 && strcmp( rec->args, args ) == 0 )
+            return rec;
+
+        h = ( h + 1 ) & ( tab->n_hash - 1 );
+    }
+
+    return NULL;
+}
+
+static replay_rec_t* replay_tab_insert( replay_tab_t* tab, const char* api, const char* args )
+{
+    replay_rec_t* rec = replay_tab_find( tab, api, args );
+
+    if ( rec != NULL ) return rec;
+
+    if ( tab->n_recs == tab->n_alloc )
+    {
+        tab->n_alloc = ( tab->n_alloc == 0 ? 64 : 2 * tab->n_alloc );
+        tab->recs    = realloc( tab->recs, tab->n_alloc * sizeof( replay_rec_t ) );
+    }
+
+    rec = &tab->recs[ tab->n_recs ];
+    memset( rec, 0, sizeof( replay_rec_t ) );
+    strncpy( rec->api,  api,  API_SIZE  - 1 );
+    strncpy( rec->args, args, ARGS_SIZE - 1 );
+    tab->n_recs += 1;
+
+    // Keep the load factor of the hash table below one half.
+    if ( 2 * tab->n_recs > tab->n_hash )
+        replay_tab_rehash( tab, tab->n_hash == 0 ? 128 : 2 * tab->n_hash );
+    else
+    {
+        dim_t h = replay_hash_key( api, args ) & ( tab->n_hash - 1 );
+
+        while ( tab->hash[ h ] != -1 ) h = ( h + 1 ) & ( tab->n_hash - 1 );
+
+        tab->hash[ h ] = tab->n_recs - 1;
+    }
+
+    return rec;
+}
+
+
+// -- Log parsing --------------------------------------------------------------
+
+// Split one log line into the api name and its arguments. The api name may
+// carry a ":<line>:" suffix and the gemm logs append the " nt=..." stats on
+// the same line; both are stripped so identical calls map to the same key.
+static int replay_parse_line( char* line, char* api, char* args, dim_t* nt )
+{
+    char* p = line;
+    char* s;
+    char* d;
+
+    while ( *p == ' ' || *p == '\t' ) ++p;
+
+    if ( *p == '\0' || *p == '\n' || *p == '#' ) return FALSE;
+
+    s = p;
+    while ( *p != '\0' && *p != ' ' && *p != '\t' && *p != '\n' ) ++p;
+    if ( *p == '\0' || *p == '\n' ) return FALSE;
+    *p++ = '\0';
+
+    if ( ( d = strchr( s, ':' ) ) != NULL ) *d = '\0';
+    strncpy( api, s, API_SIZE - 1 );
+    api[ API_SIZE - 1 ] = '\0';
+
+    *nt = 0;
+    if ( ( s = strstr( p, "nt=" ) ) != NULL )
+    {
+        sscanf( s, "nt=" INT_FS, nt );
+        *s = '\0';
+    }
+
+    // Collapse whitespace.
+    d = args;
+    while ( *p != '\0' && d < args + ARGS_SIZE - 1 )
+    {
+        if ( isspace( ( unsigned char )*p ) )
+        {
+            while ( isspace( ( unsigned char )*p ) ) ++p;
+            if ( *p != '\0' && d != args ) *d++ = ' ';
+        }
+        else *d++ = *p++;
+    }
+    *d = '\0';
+
+    return ( d != args );
+}
+
+// Map an api name such as "dgemm_" to the operation.
+static int replay_find_op( const char* api, replay_op_t* op )
+{
+    char name[ API_SIZE ];
+    int  len, i;
+
+    strncpy( name, api, API_SIZE - 1 );
+    name[ API_SIZE - 1 ] = '\0';
+
+    len = strlen( name );
+    if ( len > 0 && name[ len - 1 ] == '_' ) name[ --len ] = '\0';
+
+    if ( len < 2 ) return FALSE;
+    if ( strchr( "sdczSDCZ", name[ 0 ] ) == NULL ) return FALSE;
+
+    for ( i = 0; i < REPLAY_NUM_OPS; ++i )
+    {
+        if ( strcmp( name + 1, replay_op_names[ i ] ) == 0 )
+        {
+            *op = ( replay_op_t )i;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+static int replay_char_to_dt( char dt_ch, num_t* dt )
+{
+    if      ( dt_ch == 'S' || dt_ch == 's' ) *dt = BLIS_FLOAT;
+    else if ( dt_ch == 'D' || dt_ch == 'd' ) *dt = BLIS_DOUBLE;
+    else if ( dt_ch == 'C' || dt_ch == 'c' ) *dt = BLIS_SCOMPLEX;
+    else if ( dt_ch == 'Z' || dt_ch == 'z' ) *dt = BLIS_DCOMPLEX;
+    else return FALSE;
+
+    return TRUE;
+}
+
+// Parse the arguments of one call. The formats follow the AOCL_DTL_log_*
+// functions in aocl_dtl/aocldtl_blis.c.
+static int replay_parse_call( replay_op_t op, const char* args, replay_call_t* call )
+{
+    char  dt_ch = 0;
+    dim_t m = 0, n = 0, k = 0;
+    dim_t lda = 0, ldb = 0, ldc = 0;
+    dim_t incx = 1, incy = 1;
+    int   nf, ne;
+
+    memset( call, 0, sizeof( replay_call_t ) );
+    call->op = op;
+
+    switch ( op )
+    {
+        case REPLAY_GEMM:
+            ne = 13;
+            nf = sscanf( args, "%c %c %c " INT_FS INT_FS INT_FS " %lf %lf " INT_FS INT_FS " %lf %lf " INT_FS,
+                         &dt_ch, &call->transa, &call->transb, &m, &n, &k,
+                         &call->alpha_r, &call->alpha_i, &lda, &ldb,
+                         &call->beta_r, &call->beta_i, &ldc );
+            call->flops = 2.0 * m * n * k;
+            break;
+
+        case REPLAY_GEMMT:
+            ne = 13;
+            nf = sscanf( args, "%c %c " INT_FS INT_FS INT_FS INT_FS INT_FS " %c %c %lf %lf %lf %lf",
+                         &dt_ch, &call->uplo, &n, &k, &lda, &ldb, &ldc,
+                         &call->transa, &call->transb,
+                         &call->alpha_r, &call->alpha_i,
+                         &call->beta_r, &call->beta_i );
+            call->flops = 1.0 * n * n * k;
+            break;
+
+        case REPLAY_TRSM:
+            ne = 11;
+            nf = sscanf( args, "%c %c %c %c %c " INT_FS INT_FS INT_FS INT_FS " %lf %lf",
+                         &dt_ch, &call->side, &call->uplo, &call->transa, &call->diag,
+                         &m, &n, &lda, &ldb, &call->alpha_r, &call->alpha_i );
+            call->flops = ( call->side == 'L' || call->side == 'l' ) ? 1.0 * m * m * n
+                                                                      : 1.0 * m * n * n;
+            break;
+
+        case REPLAY_TRMM:
+            ne = 11;
+            nf = sscanf( args, "%c %c %c %c %c " INT_FS INT_FS " %lf %lf " INT_FS INT_FS,
+                         &dt_ch, &call->side, &call->uplo, &call->transa, &call->diag,
+                         &m, &n, &call->alpha_r, &call->alpha_i, &lda, &ldb );
+            call->flops = ( call->side == 'L' || call->side == 'l' ) ? 1.0 * m * m * n
+                                                                      : 1.0 * m * n * n;
+            break;
+
+        case REPLAY_SYRK:
+        case REPLAY_HERK:
+            ne = 11;
+            nf = sscanf( args, "%c %c %c " INT_FS INT_FS " %lf %lf " INT_FS " %lf %lf " INT_FS,
+                         &dt_ch, &call->uplo, &call->transa, &n, &k,
+                         &call->alpha_r, &call->alpha_i, &lda,
+                         &call->beta_r, &call->beta_i, &ldc );
+            call->flops = 1.0 * n * n * k;
+            break;
+
+        case REPLAY_GEMV:
+            ne = 11;
+            nf = sscanf( args, "%c %c " INT_FS INT_FS " %lf %lf " INT_FS INT_FS " %lf %lf " INT_FS,
+                         &dt_ch, &call->transa, &m, &n,
+                         &call->alpha_r, &call->alpha_i, &lda, &incx,
+                         &call->beta_r, &call->beta_i, &incy );
+            call->flops = 2.0 * m * n;
+            break;
+
+        case REPLAY_GER:
+        case REPLAY_GERU:
+        case REPLAY_GERC:
+            ne = 8;
+            nf = sscanf( args, "%c " INT_FS INT_FS " %lf %lf " INT_FS INT_FS INT_FS,
+                         &dt_ch, &m, &n, &call->alpha_r, &call->alpha_i,
+                         &incx, &incy, &lda );
+            call->flops = 2.0 * m * n;
+            break;
+
+        case REPLAY_DOT:
+        case REPLAY_COPY:
+        case REPLAY_SWAP:
+            ne = 4;
+            nf = sscanf( args, "%c " INT_FS INT_FS INT_FS, &dt_ch, &n, &incx, &incy );
+            call->flops = ( op == REPLAY_DOT ? 2.0 * n : 0.0 );
+            break;
+
+        case REPLAY_AXPY:
+            ne = 6;
+            nf = sscanf( args, "%c " INT_FS " %lf %lf " INT_FS INT_FS,
+                         &dt_ch, &n, &call->alpha_r, &call->alpha_i, &incx, &incy );
+            call->flops = 2.0 * n;
+            break;
+
+        case REPLAY_SCAL:
+            ne = 5;
+            nf = sscanf( args, "%c %lf %lf " INT_FS INT_FS,
+                         &dt_ch, &call->alpha_r, &call->alpha_i, &n, &incx );
+            call->flops = 1.0 * n;
+            break;
+
+        default:
+            return FALSE;
+    }
+
+    if ( nf != ne ) return FALSE;
+    if ( !replay_char_to_dt( dt_ch, &call->dt ) ) return FALSE;
+
+    // Reject combinations that have no BLAS entry point.
+    if ( bli_is_complex( call->dt ) &&
+         ( op == REPLAY_GER || op == REPLAY_DOT ) ) return FALSE;
+    if ( bli_is_real( call->dt ) &&
+         ( op == REPLAY_HERK || op == REPLAY_GERU || op == REPLAY_GERC ) ) return FALSE;
+
+    if ( m < 0 || n < 0 || k < 0 ) return FALSE;
+
+    if ( bli_is_complex( call->dt ) ) call->flops *= 4.0;
+
+    call->m = m; call->n = n; call->k = k;
+    call->lda = bli_max( lda, 1 ); call->ldb = bli_max( ldb, 1 ); call->ldc = bli_max( ldc, 1 );
+    call->incx = incx; call->incy = incy;
+
+    return TRUE;
+}
+
+
+// -- Operand setup ------------------------------------------------------------
+
+static siz_t replay_vec_elems( f77_int len, f77_int inc )
+{
+    return ( siz_t )( 1 + ( bli_max( len, 1 ) - 1 ) * bli_abs( inc ) );
+}
+
+// Allocate and randomize an ld x n operand. A diagonally dominant operand
+// is used for the triangular matrix of trsm so that repeated solves do not
+// overflow.
+static void* replay_alloc( num_t dt, siz_t ld, siz_t n, siz_t* size, bool diag_dom )
+{
+    siz_t  elems = ld * bli_max( n, 1 );
+    siz_t  bytes = elems * bli_dt_size( dt );
+    void*  buf   = malloc( bytes );
+    obj_t  x;
+    siz_t  i;
+
+    if ( buf == NULL ) return NULL;
+
+    bli_obj_create_with_attached_buffer( dt, ld, bli_max( n, 1 ), buf, 1, ld, &x );
+    bli_randm( &x );
+
+    if ( diag_dom )
+    {
+        siz_t ndiag = bli_min( ld, n );
+
+        for ( i = 0; i < ndiag; ++i )
+        {
+            siz_t off = ( i * ld + i ) * ( bli_is_complex( dt ) ? 2 : 1 );
+
+            if ( bli_is_single_prec( dt ) ) (( float*  )buf)[ off ] += ( float )ndiag + 1.0f;
+            else                            (( double* )buf)[ off ] += ( double )ndiag + 1.0;
+        }
+    }
+
+    if ( size != NULL ) *size = bytes;
+
+    return buf;
+}
+
+static void* replay_scalar( num_t dt, double re, double im, scomplex* s, dcomplex* d )
+{
+    if ( bli_is_single_prec( dt ) )
+    {
+        bli_csets( ( float )re, ( float )im, *s );
+        return s;
+    }
+
+    bli_zsets( re, im, *d );
+    return d;
+}
+
+static int replay_setup( replay_call_t* call )
+{
+    num_t   dt = call->dt;
+    f77_int m  = call->m, n = call->n, k = call->k;
+    bool    nt_a = ( call->transa == 'N' || call->transa == 'n' );
+    bool    nt_b = ( call->transb == 'N' || call->transb == 'n' );
+    bool    left = ( call->side   == 'L' || call->side   == 'l' );
+
+    switch ( call->op )
+    {
+        case REPLAY_GEMM:
+            call->a = replay_alloc( dt, call->lda, nt_a ? k : m, NULL, FALSE );
+            call->b = replay_alloc( dt, call->ldb, nt_b ? n : k, NULL, FALSE );
+            call->c = replay_alloc( dt, call->ldc, n, &call->c_size, FALSE );
+            break;
+
+        case REPLAY_GEMMT:
+            call->a = replay_alloc( dt, call->lda, nt_a ? k : n, NULL, FALSE );
+            call->b = replay_alloc( dt, call->ldb, nt_b ? n : k, NULL, FALSE );
+            call->c = replay_alloc( dt, call->ldc, n, &call->c_size, FALSE );
+            break;
+
+        case REPLAY_TRSM:
+        case REPLAY_TRMM:
+            call->a = replay_alloc( dt, call->lda, left ? m : n, NULL, call->op == REPLAY_TRSM );
+            call->b = NULL;
+            call->c = replay_alloc( dt, call->ldb, n, &call->c_size, FALSE );
+            break;
+
+        case REPLAY_SYRK:
+        case REPLAY_HERK:
+            call->a = replay_alloc( dt, call->lda, nt_a ? k : n, NULL, FALSE );
+            call->b = NULL;
+            call->c = replay_alloc( dt, call->ldc, n, &call->c_size, FALSE );
+            break;
+
+        case REPLAY_GEMV:
+            call->a = replay_alloc( dt, call->lda, n, NULL, FALSE );
+            call->b = replay_alloc( dt, replay_vec_elems( nt_a ? n : m, call->incx ), 1, NULL, FALSE );
+            call->c = replay_alloc( dt, replay_vec_elems( nt_a ? m : n, call->incy ), 1, &call->c_size, FALSE );
+            break;
+
+        case REPLAY_GER:
+        case REPLAY_GERU:
+        case REPLAY_GERC:
+            call->a = replay_alloc( dt, replay_vec_elems( m, call->incx ), 1, NULL, FALSE );
+            call->b = replay_alloc( dt, replay_vec_elems( n, call->incy ), 1, NULL, FALSE );
+            call->c = replay_alloc( dt, call->lda, n, &call->c_size, FALSE );
+            break;
+
+        case REPLAY_SCAL:
+            call->a = NULL;
+            call->b = NULL;
+            call->c = replay_alloc( dt, replay_vec_elems( n, call->incx ), 1, &call->c_size, FALSE );
+            break;
+
+        default:
+            // dot, axpy, copy and swap: x is read, y is read and/or written.
+            call->a = NULL;
+            call->b = replay_alloc( dt, replay_vec_elems( n, call->incx ), 1, NULL, FALSE );
+            call->c = replay_alloc( dt, replay_vec_elems( n, call->incy ), 1, &call->c_size, FALSE );
+            break;
+    }
+
+    if ( call->c == NULL ) return FALSE;
+    if ( call->a == NULL && call->op <= REPLAY_GERC ) return FALSE;
+
+    call->c_save = malloc( call->c_size );
+    if ( call->c_save == NULL ) return FALSE;
+    memcpy( call->c_save, call->c, call->c_size );
+
+    return TRUE;
+}
+
+static void replay_cleanup( replay_call_t* call )
+{
+    free( call->a );
+    free( call->b );
+    free( call->c );
+    free( call->c_save );
+}
+
+
+// -- Execution ----------------------------------------------------------------
+
+#define REPLAY_DISPATCH( dt, opname, ... ) \
+    switch ( dt ) \
+    { \
+        case BLIS_FLOAT:    PASTEF77(s,opname)( __VA_ARGS__ ); break; \
+        case BLIS_DOUBLE:   PASTEF77(d,opname)( __VA_ARGS__ ); break; \
+        case BLIS_SCOMPLEX: PASTEF77(c,opname)( __VA_ARGS__ ); break; \
+        case BLIS_DCOMPLEX: PASTEF77(z,opname)( __VA_ARGS__ ); break; \
+        default: break; \
+    }
+
+#define REPLAY_DISPATCH_R( dt, opname, ... ) \
+    if ( bli_is_float( dt ) ) PASTEF77(s,opname)( __VA_ARGS__ ); \
+    else                      PASTEF77(d,opname)( __VA_ARGS__ );
+
+#define REPLAY_DISPATCH_C( dt, opname, ... ) \
+    if ( bli_is_scomplex( dt ) ) PASTEF77(c,opname)( __VA_ARGS__ ); \
+    else                         PASTEF77(z,opname)( __VA_ARGS__ );
+
+static void replay_call( replay_call_t* call, void* alpha, void* beta )
+{
+    num_t   dt = call->dt;
+    f77_int m  = call->m, n = call->n, k = call->k;
+
+    switch ( call->op )
+    {
+        case REPLAY_GEMM:
+            REPLAY_DISPATCH( dt, gemm, &call->transa, &call->transb, &m, &n, &k,
+                             alpha, call->a, &call->lda, call->b, &call->ldb,
+                             beta, call->c, &call->ldc );
+            break;
+
+        case REPLAY_GEMMT:
+            REPLAY_DISPATCH( dt, gemmt, &call->uplo, &call->transa, &call->transb, &n, &k,
+                             alpha, call->a, &call->lda, call->b, &call->ldb,
+                             beta, call->c, &call->ldc );
+            break;
+
+        case REPLAY_TRSM:
+            REPLAY_DISPATCH( dt, trsm, &call->side, &call->uplo, &call->transa, &call->diag,
+                             &m, &n, alpha, call->a, &call->lda, call->c, &call->ldb );
+            break;
+
+        case REPLAY_TRMM:
+            REPLAY_DISPATCH( dt, trmm, &call->side, &call->uplo, &call->transa, &call->diag,
+                             &m, &n, alpha, call->a, &call->lda, call->c, &call->ldb );
+            break;
+
+        case REPLAY_SYRK:
+            REPLAY_DISPATCH( dt, syrk, &call->uplo, &call->transa, &n, &k,
+                             alpha, call->a, &call->lda, beta, call->c, &call->ldc );
+            break;
+
+        case REPLAY_HERK:
+            // alpha and beta are real; the real part is the first member of
+            // the complex scalar.
+            REPLAY_DISPATCH_C( dt, herk, &call->uplo, &call->transa, &n, &k,
+                               alpha, call->a, &call->lda, beta, call->c, &call->ldc );
+            break;
+
+        case REPLAY_GEMV:
+            REPLAY_DISPATCH( dt, gemv, &call->transa, &m, &n, alpha, call->a, &call->lda,
+                             call->b, &call->incx, beta, call->c, &call->incy );
+            break;
+
+        case REPLAY_GER:
+            REPLAY_DISPATCH_R( dt, ger, &m, &n, alpha, call->a, &call->incx,
+                               call->b, &call->incy, call->c, &call->lda );
+            break;
+
+        case REPLAY_GERU:
+            REPLAY_DISPATCH_C( dt, geru, &m, &n, alpha, call->a, &call->incx,
+                               call->b, &call->incy, call->c, &call->lda );
+            break;
+
+        case REPLAY_GERC:
+            REPLAY_DISPATCH_C( dt, gerc, &m, &n, alpha, call->a, &call->incx,
+                               call->b, &call->incy, call->c, &call->lda );
+            break;
+
+        case REPLAY_DOT:
+        {
+            volatile double rho;
+
+            if ( bli_is_float( dt ) ) rho = sdot_( &n, call->b, &call->incx, call->c, &call->incy );
+            else                      rho = ddot_( &n, call->b, &call->incx, call->c, &call->incy );
+            ( void )rho;
+            break;
+        }
+
+        case REPLAY_AXPY:
+            REPLAY_DISPATCH( dt, axpy, &n, alpha, call->b, &call->incx, call->c, &call->incy );
+            break;
+
+        case REPLAY_SCAL:
+            REPLAY_DISPATCH( dt, scal, &n, alpha, call->c, &call->incx );
+            break;
+
+        case REPLAY_COPY:
+            REPLAY_DISPATCH( dt, copy, &n, call->b, &call->incx, call->c, &call->incy );
+            break;
+
+        case REPLAY_SWAP:
+            REPLAY_DISPATCH( dt, swap, &n, call->b, &call->incx, call->c, &call->incy );
+            break;
+
+        default:
+            break;
+    }
+}
+
+// Evict the operands from the caches by streaming through a buffer that is
+// larger than the last level cache.
+static void replay_flush( char* flush_buf, siz_t flush_size )
+{
+    siz_t i;
+
+    if ( flush_buf == NULL ) return;
+
+    for ( i = 0; i < flush_size; i += 64 ) flush_buf[ i ] += 1;
+}
+
+static int replay_run( replay_rec_t* rec, int n_repeats, dim_t nt,
+                       char* flush_buf, siz_t flush_size )
+{
+    replay_call_t call;
+    replay_op_t   op;
+    void*         alpha;
+    void*         beta;
+    double        dtime, dtime_save;
+    int           r;
+
+    if ( !replay_find_op( rec->api, &op ) ) return FALSE;
+    if ( !replay_parse_call( op, rec->args, &call ) ) return FALSE;
+    if ( !replay_setup( &call ) )
+    {
+        replay_cleanup( &call );
+        return FALSE;
+    }
+
+    alpha = replay_scalar( call.dt, call.alpha_r, call.alpha_i, &call.alpha_s, &call.alpha_d );
+    beta  = replay_scalar( call.dt, call.beta_r,  call.beta_i,  &call.beta_s,  &call.beta_d );
+
+    // A thread count of zero requests the count recorded in the log.
+    if ( nt == 0 && rec->nt > 0 ) bli_thread_set_num_threads( rec->nt );
+
+    dtime_save = DBL_MAX;
+
+    for ( r = 0; r < n_repeats; ++r )
+    {
+        memcpy( call.c, call.c_save, call.c_size );
+
+        replay_flush( flush_buf, flush_size );
+
+        dtime = bli_clock();
+
+        replay_call( &call, alpha, beta );
+
+        dtime_save = bli_clock_min_diff( dtime_save, dtime );
+    }
+
+    rec->replayed = TRUE;
+    rec->time     = dtime_save;
+    rec->gflops   = ( dtime_save > 0.0 ? call.flops / ( dtime_save * 1.0e9 ) : 0.0 );
+
+    replay_cleanup( &call );
+
+    return TRUE;
+}
+
+
+// -- Baseline and report ------------------------------------------------------
+
+static void replay_load_baseline( replay_tab_t* tab, FILE* fb )
+{
+    char   line[ BUFFER_SIZE ];
+    char   api[ API_SIZE ];
+    char   args[ ARGS_SIZE ];
+    dim_t  calls, nt;
+    double time;
+
+    while ( fgets( line, BUFFER_SIZE, fb ) != NULL )
+    {
+        replay_rec_t* rec;
+
+        if ( sscanf( line, " { \"api\": \"%31[^\"]\", \"args\": \"%255[^\"]\", \"calls\": "
+                     INT_FS ", \"threads\": " INT_FS ", \"time_s\": %lf",
+                     api, args, &calls, &nt, &time ) != 5 ) continue;
+
+        rec = replay_tab_find( tab, api, args );
+
+        if ( rec != NULL ) rec->base_time = time;
+    }
+}
+
+static void replay_usage( const char* prog )
+{
+    printf( "Usage: %s [options] dtl_log.txt report.json\n", prog );
+    printf( "  -t <nt>      number of threads (0: use the nt= recorded in the log)\n" );
+    printf( "  -r <n>       repetitions per shape (default %d)\n", N_REPEAT );
+    printf( "  -c           cold cache: flush the caches before every repetition\n" );
+    printf( "  -f <MB>      size of the flush buffer for -c (default %d)\n", REPLAY_FLUSH_MB );
+    printf( "  -b <file>    baseline report to compare against\n" );
+    printf( "  -x <pct>     tolerated slowdown versus baseline (default %.1f)\n", REPLAY_TOL_PCT );
+}
+
+int main( int argc, char** argv )
+{
+    replay_tab_t tab;
+    char         line[ BUFFER_SIZE ];
+    char         api[ API_SIZE ];
+    char         args[ ARGS_SIZE ];
+    dim_t        nt = -1;
+    int          n_repeats = N_REPEAT;
+    bool         cold = FALSE;
+    dim_t        flush_mb = REPLAY_FLUSH_MB;
+    double       tol = REPLAY_TOL_PCT;
+    const char*  base_name = NULL;
+    char*        flush_buf = NULL;
+    siz_t        flush_size = 0;
+    dim_t        i, n_lines = 0, n_skipped = 0, n_regress = 0, n_compared = 0;
+    double       total = 0.0, total_base = 0.0;
+    int          argi;
+    bool         first;
+
+    FILE* fin  = NULL;
+    FILE* fout = NULL;
+    FILE* fb   = NULL;
+
+    for ( argi = 1; argi < argc && argv[ argi ][ 0 ] == '-'; ++argi )
+    {
+        char opt = argv[ argi ][ 1 ];
+
+        if ( opt == 'c' ) { cold = TRUE; continue; }
+
+        if ( argi + 1 >= argc ) { replay_usage( argv[ 0 ] ); exit( 1 ); }
+
+        if      ( opt == 't' ) nt        = atol( argv[ ++argi ] );
+        else if ( opt == 'r' ) n_repeats = atoi( argv[ ++argi ] );
+        else if ( opt == 'f' ) flush_mb  = atol( argv[ ++argi ] );
+        else if ( opt == 'b' ) base_name = argv[ ++argi ];
+        else if ( opt == 'x' ) tol       = atof( argv[ ++argi ] );
+        else { replay_usage( argv[ 0 ] ); exit( 1 ); }
+    }
+
+    if ( argc - argi < 2 || n_repeats < 1 )
+    {
+        replay_usage( argv[ 0 ] );
+        exit( 1 );
+    }
+
+    fin = fopen( argv[ argi ], "r" );
+    if ( fin == NULL )
+    {
+        printf( "Error opening the file %s\n", argv[ argi ] );
+        exit( 1 );
+    }
+    fout = fopen( argv[ argi + 1 ], "w" );
+    if ( fout == NULL )
+    {
+        printf( "Error opening output file %s\n", argv[ argi + 1 ] );
+        exit( 1 );
+    }
+
+    memset( &tab, 0, sizeof( replay_tab_t ) );
+
+    // Group the calls of the log into unique shapes, in order of first
+    // appearance.
+    while ( fgets( line, BUFFER_SIZE, fin ) != NULL )
+    {
+        replay_rec_t* rec;
+        dim_t         lnt;
+
+        if ( !replay_parse_line( line, api, args, &lnt ) ) continue;
+
+        rec = replay_tab_insert( &tab, api, args );
+        rec->calls += 1;
+        if ( lnt > 0 ) rec->nt = lnt;
+        n_lines += 1;
+    }
+    fclose( fin );
+
+    if ( base_name != NULL )
+    {
+        fb = fopen( base_name, "r" );
+        if ( fb == NULL )
+        {
+            printf( "Error opening baseline file %s\n", base_name );
+            exit( 1 );
+        }
+        replay_load_baseline( &tab, fb );
+        fclose( fb );
+    }
+
+    if ( nt > 0 ) bli_thread_set_num_threads( nt );
+
+    if ( cold )
+    {
+        flush_size = ( siz_t )flush_mb * 1024 * 1024;
+        flush_buf  = calloc( flush_size, 1 );
+    }
+
+    for ( i = 0; i < tab.n_recs; ++i )
+    {
+        replay_rec_t* rec = &tab.recs[ i ];
+
+        if ( !replay_run( rec, n_repeats, nt, flush_buf, flush_size ) )
+        {
+            printf( "skipping %s %s\n", rec->api, rec->args );
+            n_skipped += 1;
+            continue;
+        }
+
+        printf( "data_replay_%s( %2lu ) = [ %s %s %8.3f ms %7.2f GFLOPS ]",
+                BLAS, ( unsigned long )( i + 1 ), rec->api, rec->args,
+                rec->time * 1.0e3, rec->gflops );
+
+        total += rec->calls * rec->time;
+
+        if ( rec->base_time > 0.0 )
+        {
+            n_compared += 1;
+            total_base += rec->calls * rec->base_time;
+
+            printf( " %+6.1f%%", 100.0 * ( rec->base_time / rec->time - 1.0 ) );
+
+            if ( rec->time > rec->base_time * ( 1.0 + tol / 100.0 ) )
+            {
+                n_regress += 1;
+                printf( " REGRESSION" );
+            }
+        }
+        printf( "\n" );
+    }
+
+    free( flush_buf );
+
+    // One shape per line, so that the report can be read back as a baseline.
+    fprintf( fout, "{\n" );
+    fprintf( fout, "  \"blas\": \"%s\",\n", BLAS );
+    fprintf( fout, "  \"threads\": %ld,\n", ( long )nt );
+    fprintf( fout, "  \"cache\": \"%s\",\n", cold ? "cold" : "warm" );
+    fprintf( fout, "  \"repeats\": %d,\n", n_repeats );
+    fprintf( fout, "  \"shapes\": [" );
+    for ( i = 0, first = TRUE; i < tab.n_recs; ++i )
+    {
+        replay_rec_t* rec = &tab.recs[ i ];
+
+        if ( !rec->replayed ) continue;
+
+        fprintf( fout, "%s\n    { ", first ? "" : "," );
+        first = FALSE;
+        fprintf( fout, "\"api\": \"%s\", \"args\": \"%s\", \"calls\": %ld, \"threads\": %ld, "
+                       "\"time_s\": %.9e, \"gflops\": %.3f",
+                 rec->api, rec->args, ( long )rec->calls, ( long )rec->nt,
+                 rec->time, rec->gflops );
+        if ( rec->base_time > 0.0 )
+            fprintf( fout, ", \"baseline_time_s\": %.9e, \"speedup\": %.4f, \"regression\": %s",
+                     rec->base_time, rec->base_time / rec->time,
+                     rec->time > rec->base_time * ( 1.0 + tol / 100.0 ) ? "true" : "false" );
+        fprintf( fout, " }" );
+    }
+    fprintf( fout, "\n  ],\n" );
+    fprintf( fout, "  \"summary\": { \"calls\": %ld, \"shapes\": %ld, \"skipped\": %ld, "
+                   "\"compared\": %ld, \"regressions\": %ld, \"weighted_time_s\": %.9e",
+             ( long )n_lines, ( long )tab.n_recs, ( long )n_skipped,
+             ( long )n_compared, ( long )n_regress, total );
+    if ( n_compared > 0 )
+        fprintf( fout, ", \"baseline_weighted_time_s\": %.9e", total_base );
+    fprintf( fout, " }\n" );
+    fprintf( fout, "}\n" );
+    fclose( fout );
+
+    printf( "%ld calls, %ld shapes, %ld skipped, %ld regressions\n",
+            ( long )n_lines, ( long )tab.n_recs, ( long )n_skipped, ( long )n_regress );
+
+    free( tab.recs );
+    free( tab.hash );
+
+    // A non-zero exit status lets scripts gate on regressions.
+    return ( n_regress > 0 ? 2 : 0 );
+}
@@ -45,6 +45,7 @@
 
 #define BLIS_ENABLE_SMALL_MATRIX
 #define BLIS_ENABLE_SMALL_MATRIX_TRSM
+#define BLIS_ENABLE_SMALL_MATRIX_TRMM
 
 
 // This will select the threshold below which small matrix code will be called.
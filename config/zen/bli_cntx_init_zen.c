@@ -51,7 +51,7 @@ void bli_cntx_init_zen( cntx_t* cntx )
     // their storage preferences.
     bli_cntx_set_l3_nat_ukrs
     (
-      8,
+      10,
       // gemm
       BLIS_GEMM_UKR,       BLIS_FLOAT,    bli_sgemm_haswell_asm_6x16,       TRUE,
       BLIS_GEMM_UKR,       BLIS_DOUBLE,   bli_dgemm_haswell_asm_6x8,        TRUE,
@@ -63,6 +63,9 @@ void bli_cntx_init_zen( cntx_t* cntx )
       // gemmtrsm_u
       BLIS_GEMMTRSM_U_UKR, BLIS_FLOAT,    bli_sgemmtrsm_u_haswell_asm_6x16, TRUE,
       BLIS_GEMMTRSM_U_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_u_haswell_asm_6x8,  TRUE,
+      // trmm diagonal micro-panels (must match the 6x8 gemm ukernel)
+      BLIS_TRMM_L_UKR,     BLIS_DOUBLE,   bli_dtrmm_l_zen_int_6x8,          TRUE,
+      BLIS_TRMM_U_UKR,     BLIS_DOUBLE,   bli_dtrmm_u_zen_int_6x8,          TRUE,
       cntx
     );
 
@@ -103,7 +106,7 @@ void bli_cntx_init_zen( cntx_t* cntx )
     // Update the context with optimized level-1v kernels.
     bli_cntx_set_l1v_kers
     (
-      26,
+      32,
       
       // amaxv
       BLIS_AMAXV_KER,  BLIS_FLOAT,  bli_samaxv_zen_int,
@@ -132,6 +135,16 @@ void bli_cntx_init_zen( cntx_t* cntx )
       BLIS_DOTXV_KER,  BLIS_DOUBLE, bli_ddotxv_zen_int,
       BLIS_DOTXV_KER,  BLIS_DCOMPLEX, bli_zdotxv_zen_int,
       BLIS_DOTXV_KER,  BLIS_SCOMPLEX, bli_cdotxv_zen_int,
+      // rotv
+      BLIS_ROTV_KER,   BLIS_FLOAT,    bli_srotv_zen_int,
+      BLIS_ROTV_KER,   BLIS_DOUBLE,   bli_drotv_zen_int,
+      BLIS_ROTV_KER,   BLIS_SCOMPLEX, bli_crotv_zen_int,
+      BLIS_ROTV_KER,   BLIS_DCOMPLEX, bli_zrotv_zen_int,
+
+      // rotmv
+      BLIS_ROTMV_KER,  BLIS_FLOAT,    bli_srotmv_zen_int,
+      BLIS_ROTMV_KER,  BLIS_DOUBLE,   bli_drotmv_zen_int,
+
       // scalv
 
       BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int10,
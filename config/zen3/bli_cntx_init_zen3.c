@@ -35,6 +35,20 @@
 
 #include "blis.h"
 
+// Cache sizes of the parts the blocksizes below were tuned on: per-core L1
+// data and L2 caches, and the L3 shared by one CCX. The cache blocksizes are
+// rescaled to the caches detected at runtime (see bli_cache_scale_blkszs()).
+#define BLIS_ZEN3_L1D_SIZE  (   32 * 1024 )
+#define BLIS_ZEN3_L2_SIZE   (  512 * 1024 )
+#define BLIS_ZEN3_L3_SIZE   (   32 * 1024 * 1024 )
+
+#define BLIS_ZEN3_SCALE_BLKSZS( blkszs ) \
+    bli_cache_scale_blkszs( BLIS_ZEN3_L1D_SIZE, BLIS_ZEN3_L2_SIZE, \
+                            BLIS_ZEN3_L3_SIZE, \
+                            &blkszs[ BLIS_MR ], &blkszs[ BLIS_NR ], \
+                            &blkszs[ BLIS_MC ], &blkszs[ BLIS_KC ], \
+                            &blkszs[ BLIS_NC ] )
+
 void bli_cntx_init_zen3( cntx_t* cntx )
 {
     blksz_t blkszs[ BLIS_NUM_BLKSZS ];
@@ -48,7 +62,7 @@ void bli_cntx_init_zen3( cntx_t* cntx )
     // their storage preferences.
     bli_cntx_set_l3_nat_ukrs
     (
-      8,
+      10,
       // gemm
       BLIS_GEMM_UKR,       BLIS_FLOAT,    bli_sgemm_haswell_asm_6x16,       TRUE,
       BLIS_GEMM_UKR,       BLIS_DOUBLE,   bli_dgemm_haswell_asm_6x8,        TRUE,
@@ -60,6 +74,9 @@ void bli_cntx_init_zen3( cntx_t* cntx )
       // gemmtrsm_u
       BLIS_GEMMTRSM_U_UKR, BLIS_FLOAT,    bli_sgemmtrsm_u_haswell_asm_6x16, TRUE,
       BLIS_GEMMTRSM_U_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_u_haswell_asm_6x8,  TRUE,
+      // trmm diagonal micro-panels (must match the 6x8 gemm ukernel)
+      BLIS_TRMM_L_UKR,     BLIS_DOUBLE,   bli_dtrmm_l_zen_int_6x8,          TRUE,
+      BLIS_TRMM_U_UKR,     BLIS_DOUBLE,   bli_dtrmm_u_zen_int_6x8,          TRUE,
       cntx
     );
 
@@ -115,7 +132,7 @@ void bli_cntx_init_zen3( cntx_t* cntx )
     // Update the context with optimized level-1v kernels.
     bli_cntx_set_l1v_kers
     (
-      26,
+      32,
 
       // amaxv
       BLIS_AMAXV_KER,  BLIS_FLOAT,  bli_samaxv_zen_int,
@@ -145,6 +162,16 @@ void bli_cntx_init_zen3( cntx_t* cntx )
       BLIS_DOTXV_KER,  BLIS_DCOMPLEX, bli_zdotxv_zen_int,
       BLIS_DOTXV_KER,  BLIS_SCOMPLEX, bli_cdotxv_zen_int,
 
+      // rotv
+      BLIS_ROTV_KER,   BLIS_FLOAT,    bli_srotv_zen_int,
+      BLIS_ROTV_KER,   BLIS_DOUBLE,   bli_drotv_zen_int,
+      BLIS_ROTV_KER,   BLIS_SCOMPLEX, bli_crotv_zen_int,
+      BLIS_ROTV_KER,   BLIS_DCOMPLEX, bli_zrotv_zen_int,
+
+      // rotmv
+      BLIS_ROTMV_KER,  BLIS_FLOAT,    bli_srotmv_zen_int,
+      BLIS_ROTMV_KER,  BLIS_DOUBLE,   bli_drotmv_zen_int,
+
       // scalv
       BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int10,
       BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int10,
@@ -177,6 +204,8 @@ void bli_cntx_init_zen3( cntx_t* cntx )
     bli_blksz_init_easy( &blkszs[ BLIS_AF ],     5,     5,    -1,    -1 );
     bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,    -1,    -1 );
 
+    BLIS_ZEN3_SCALE_BLKSZS( blkszs );
+
     // Update the context with the current architecture's register and cache
     // blocksizes (and multiples) for native execution.
     bli_cntx_set_blkszs
@@ -203,6 +232,8 @@ void bli_cntx_init_zen3( cntx_t* cntx )
     bli_blksz_init_easy( &blkszs[ BLIS_KC ],   256,   492,   256,   256 );
     bli_blksz_init_easy( &blkszs[ BLIS_NC ],  4080,  1600,  4080,  4080 );
 
+    BLIS_ZEN3_SCALE_BLKSZS( blkszs );
+
     // Update the context with the current architecture's register and cache
     // blocksizes for level-3 TRSM problems.
     bli_cntx_set_trsm_blkszs
@@ -286,6 +317,8 @@ void bli_cntx_init_zen3( cntx_t* cntx )
     bli_blksz_init_easy( &blkszs[ BLIS_KC ],    512,   256,   128,    64   );
     bli_blksz_init_easy( &blkszs[ BLIS_NC ],    8160,  4080,  2040,   1020 );
 
+    BLIS_ZEN3_SCALE_BLKSZS( blkszs );
+
     // Update the context with the current architecture's register and cache
     // blocksizes for small/unpacked level-3 problems.
     bli_cntx_set_l3_sup_blkszs
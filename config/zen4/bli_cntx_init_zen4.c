@@ -34,6 +34,22 @@
 
 #include "blis.h"
 
+/*
+ * Cache sizes of the parts the blocksizes below were tuned on: per-core L1
+ * data and L2 caches, and the L3 shared by one CCX. The cache blocksizes are
+ * rescaled to the caches detected at runtime (see bli_cache_scale_blkszs()).
+ */
+#define BLIS_ZEN4_L1D_SIZE  (   32 * 1024 )
+#define BLIS_ZEN4_L2_SIZE   ( 1024 * 1024 )
+#define BLIS_ZEN4_L3_SIZE   (   32 * 1024 * 1024 )
+
+#define BLIS_ZEN4_SCALE_BLKSZS( blkszs ) \
+    bli_cache_scale_blkszs( BLIS_ZEN4_L1D_SIZE, BLIS_ZEN4_L2_SIZE, \
+                            BLIS_ZEN4_L3_SIZE, \
+                            &blkszs[ BLIS_MR ], &blkszs[ BLIS_NR ], \
+                            &blkszs[ BLIS_MC ], &blkszs[ BLIS_KC ], \
+                            &blkszs[ BLIS_NC ] )
+
 /*
  * List of default block sizes for zen4.
  * Converted it to macro as this list is used at multiple places in this file.
@@ -50,6 +66,8 @@
                                                                             \
     bli_blksz_init_easy( &blkszs[ BLIS_AF ],     8,     8,    -1,    -1 );  \
     bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,    -1,    -1 );  \
+                                                                            \
+    BLIS_ZEN4_SCALE_BLKSZS( blkszs );                                       \
 
 
 void bli_cntx_init_zen4( cntx_t* cntx )
@@ -65,7 +83,7 @@ void bli_cntx_init_zen4( cntx_t* cntx )
     // their storage preferences.
     bli_cntx_set_l3_nat_ukrs
     (
-      10,
+      14,
       // gemm
       BLIS_GEMM_UKR,       BLIS_FLOAT ,   bli_sgemm_skx_asm_32x12_l2,   FALSE,
       BLIS_GEMM_UKR,       BLIS_DOUBLE,   bli_dgemm_skx_asm_16x14,      FALSE,
@@ -81,6 +99,12 @@ void bli_cntx_init_zen4( cntx_t* cntx )
       // gemmtrsm_u
       BLIS_GEMMTRSM_U_UKR, BLIS_FLOAT,    bli_sgemmtrsm_u_haswell_asm_6x16, TRUE,
       BLIS_GEMMTRSM_U_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_u_zen_asm_16x14,  TRUE,
+      // gemmt diagonal micro-tiles (must match the 16x14 gemm ukernel)
+      BLIS_GEMMT_L_UKR,    BLIS_DOUBLE,   bli_dgemmt_l_zen_int_16x14,     FALSE,
+      BLIS_GEMMT_U_UKR,    BLIS_DOUBLE,   bli_dgemmt_u_zen_int_16x14,     FALSE,
+      // trmm diagonal micro-panels (must match the 16x14 gemm ukernel)
+      BLIS_TRMM_L_UKR,     BLIS_DOUBLE,   bli_dtrmm_l_zen_int_16x14,      FALSE,
+      BLIS_TRMM_U_UKR,     BLIS_DOUBLE,   bli_dtrmm_u_zen_int_16x14,      FALSE,
 
       cntx
     );
@@ -133,7 +157,7 @@ void bli_cntx_init_zen4( cntx_t* cntx )
     // Update the context with optimized level-1v kernels.
     bli_cntx_set_l1v_kers
     (
-      24,
+      30,
 
       // amaxv
       BLIS_AMAXV_KER,  BLIS_FLOAT,  bli_samaxv_zen_int_avx512,
@@ -161,6 +185,16 @@ void bli_cntx_init_zen4( cntx_t* cntx )
       BLIS_DOTXV_KER,  BLIS_FLOAT,  bli_sdotxv_zen_int,
       BLIS_DOTXV_KER,  BLIS_DOUBLE, bli_ddotxv_zen_int,
 
+      // rotv
+      BLIS_ROTV_KER,   BLIS_FLOAT,    bli_srotv_zen_int_avx512,
+      BLIS_ROTV_KER,   BLIS_DOUBLE,   bli_drotv_zen_int_avx512,
+      BLIS_ROTV_KER,   BLIS_SCOMPLEX, bli_crotv_zen_int_avx512,
+      BLIS_ROTV_KER,   BLIS_DCOMPLEX, bli_zrotv_zen_int_avx512,
+
+      // rotmv
+      BLIS_ROTMV_KER,  BLIS_FLOAT,    bli_srotmv_zen_int_avx512,
+      BLIS_ROTMV_KER,  BLIS_DOUBLE,   bli_drotmv_zen_int_avx512,
+
       // scalv
       BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int10,
       BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int10,
@@ -274,6 +308,8 @@ void bli_cntx_init_zen4( cntx_t* cntx )
     bli_blksz_init_easy( &blkszs[ BLIS_KC ],    512,   256,   128,    64   );
     bli_blksz_init_easy( &blkszs[ BLIS_NC ],    8160,  4080,  2040,   1020 );
 
+    BLIS_ZEN4_SCALE_BLKSZS( blkszs );
+
     // Update the context with the current architecture's register and cache
     // blocksizes for small/unpacked level-3 problems.
     bli_cntx_set_l3_sup_blkszs
@@ -308,6 +344,7 @@ void bli_zen4_override_trsm_blkszs (cntx_t* cntx)
     bli_blksz_init_easy( &blkszs[ BLIS_KC ],   256,    512,   256,   256 );
     bli_blksz_init_easy( &blkszs[ BLIS_NC ],  4080,   4004,  4080,  4080 );
 
+    BLIS_ZEN4_SCALE_BLKSZS( blkszs );
 
     // Update the context with the current architecture's register and cache
     // blocksizes (and multiples) for native execution.
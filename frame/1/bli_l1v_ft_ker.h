@@ -163,6 +163,39 @@ typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
 
 INSERT_GENTDEF( invertv )
 
+// rotv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       ctype_r* restrict c, \
+       ctype*   restrict s, \
+       cntx_t*           cntx  \
+     );
+
+INSERT_GENTDEFR( rotv )
+
+// rotmv
+
+#undef  GENTDEF
+#define GENTDEF( ctype, ch, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       dim_t           n, \
+       ctype* restrict x, inc_t incx, \
+       ctype* restrict y, inc_t incy, \
+       ctype* restrict h, \
+       cntx_t*         cntx  \
+     );
+
+INSERT_GENTDEF( rotmv )
+
 // scalv, setv
 
 #undef  GENTDEF
@@ -139,3 +139,22 @@ void PASTEMAC(ch,varname) \
        cntx_t* restrict cntx  \
      );
 
+
+// out-of-place transpose kernels
+// NOTE: These kernels compute b := beta * b + alpha * conja( a )^T, where a
+// is m x n and b is n x m, both stored in column-major order. When beta is
+// zero, b is overwritten without being read.
+
+#define TRANSPOSEM_KER_PROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t           conja, \
+       dim_t            m, \
+       dim_t            n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t lda, \
+       ctype*  restrict beta, \
+       ctype*  restrict b, inc_t ldb  \
+     );
+
@@ -35,6 +35,16 @@
 
 #include "blis.h"
 
+// The minimum length of the part of a micropanel that a thread packs when
+// the micropanels of a general matrix are split among several threads.
+#ifndef BLIS_PACKM_SPLIT_MIN_LEN
+#define BLIS_PACKM_SPLIT_MIN_LEN 32
+#endif
+
+// The ends of the parts of a split micropanel are aligned to this many
+// columns (or rows).
+#define BLIS_PACKM_SPLIT_ALIGN 8
+
 #define FUNCPTR_T packm_fp
 
 typedef void (*FUNCPTR_T)
@@ -456,6 +466,20 @@ void PASTEMAC(ch,varname) \
 	   will depend on whether slab or round-robin partitioning was requested
 	   at configure-time. */ \
 	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &it_start, &it_end, &it_inc ); \
+\
+	/* If there are fewer micropanels than threads, as when packing the block
+	   of A of a problem with a small m dimension, most threads would have
+	   nothing to pack. In that case, split the length of each micropanel of
+	   a general matrix among n_split threads. Thread tid then packs part
+	   tid % n_split of micropanel tid / n_split. This is not done for the
+	   induced methods, whose micropanels are not laid out column by column
+	   (or row by row). */ \
+	dim_t n_split = 1; \
+\
+	if ( n_iter > 0 && nt > n_iter && \
+	     bli_is_general( strucc ) && bli_is_nat_packed( schema ) ) \
+		n_split = bli_max( bli_min( nt / n_iter, \
+		                            panel_len_full / BLIS_PACKM_SPLIT_MIN_LEN ), 1 ); \
 \
 	/* Iterate over every logical micropanel in the source matrix. */ \
 	for ( ic  = ic0,    ip  = ip0,    it  = 0; it < n_iter; \
@@ -604,9 +628,45 @@ void PASTEMAC(ch,varname) \
 \
 			is_p_use = is_p; \
 \
+			if ( n_split > 1 ) \
+			{ \
+				/* Pack this thread's part of the micropanel, if any. Only the
+				   last part is padded up to panel_len_max. */ \
+				const dim_t part = tid % n_split; \
+\
+				if ( tid / n_split == it ) \
+				{ \
+					const dim_t off_i = ( ( part * panel_len_full ) / n_split ) / \
+					                    BLIS_PACKM_SPLIT_ALIGN * BLIS_PACKM_SPLIT_ALIGN; \
+					const dim_t end_i = ( part == n_split - 1 ? panel_len_full : \
+					                      ( ( ( part + 1 ) * panel_len_full ) / n_split ) / \
+					                      BLIS_PACKM_SPLIT_ALIGN * BLIS_PACKM_SPLIT_ALIGN ); \
+\
+					panel_len_i     = end_i - off_i; \
+					panel_len_max_i = ( part == n_split - 1 ? panel_len_max - off_i \
+					                                        : panel_len_i ); \
+\
+					packm_ker_cast( BLIS_GENERAL, \
+					                0, \
+					                diagc, \
+					                BLIS_DENSE, \
+					                conjc, \
+					                schema, \
+					                invdiag, \
+					                *m_panel_use, \
+					                *n_panel_use, \
+					                *m_panel_max, \
+					                *n_panel_max, \
+					                kappa_cast, \
+					                c_use + off_i*ldc, rs_c, cs_c, \
+					                p_use + off_i*ldp, rs_p, cs_p, \
+				                               is_p_use, \
+					                cntx ); \
+				} \
+			} \
 			/* The definition of bli_packm_my_iter() will depend on whether slab
 			   or round-robin partitioning was requested at configure-time. */ \
-			if ( bli_packm_my_iter( it, it_start, it_end, tid, nt ) ) \
+			else if ( bli_packm_my_iter( it, it_start, it_end, tid, nt ) ) \
 			{ \
 				packm_ker_cast( BLIS_GENERAL, \
 				                0, \
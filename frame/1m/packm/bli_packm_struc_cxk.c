@@ -276,6 +276,72 @@ INSERT_GENTFUNC_BASIC( packm_struc_cxk, packm_cxk )
 
 
 
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       struc_t         strucc, \
+       uplo_t          uploc, \
+       conj_t          conjc, \
+       pack_t          schema, \
+       dim_t           panel_dim, \
+       ctype* restrict kappa, \
+       ctype* restrict c, inc_t rs_c, inc_t cs_c, \
+       ctype* restrict p,             inc_t ldp  \
+     ) \
+{ \
+	const bool   is_herm  = bli_is_hermitian( strucc ); \
+	const bool   is_lower = bli_is_lower( uploc ); \
+	const conj_t conjc_r  = ( is_herm ? bli_apply_conj( BLIS_CONJUGATE, conjc ) \
+	                                  : conjc ); \
+\
+	/* Conjugation is a no-op for real datatypes. */ \
+	( void )conjc_r; \
+\
+	/* Express the strides of c along the panel dimension (which is
+	   contiguous in p) and along the panel length, as well as those of
+	   the reflected (transposed) image of c. */ \
+	const bool   row_pack = bli_is_row_packed( schema ); \
+	const inc_t  incc     = ( row_pack ? rs_c : cs_c ); \
+	const inc_t  ldc      = ( row_pack ? cs_c : rs_c ); \
+\
+	for ( dim_t l = 0; l < panel_dim; ++l ) \
+	{ \
+		ctype* restrict pl = p + l*ldp; \
+\
+		for ( dim_t d = 0; d < panel_dim; ++d ) \
+		{ \
+			/* Map (d,l) to the row and column indices of c. */ \
+			const dim_t r      = ( row_pack ? d : l ); \
+			const dim_t cl     = ( row_pack ? l : d ); \
+			const bool  stored = ( is_lower ? r >= cl : r <= cl ); \
+			ctype       x; \
+\
+			if ( stored ) \
+			{ \
+				PASTEMAC(ch,copycjs)( conjc, *(c + d*incc + l*ldc), x ); \
+			} \
+			else \
+			{ \
+				PASTEMAC(ch,copycjs)( conjc_r, *(c + l*incc + d*ldc), x ); \
+			} \
+\
+			if ( is_herm && d == l ) \
+			{ \
+				PASTEMAC(ch,seti0s)( x ); \
+			} \
+\
+			PASTEMAC(ch,scal2s)( *kappa, x, pl[ d ] ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( packm_herm_diag_cxk )
+
+
+
+
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, varname, kername ) \
 \
@@ -303,7 +369,7 @@ void PASTEMAC(ch,varname) \
      ) \
 { \
 	doff_t  diagoffc_abs; \
-	dim_t   i, j; \
+	dim_t   j; \
 	bool    row_stored; \
 	bool    col_stored; \
 \
@@ -363,7 +429,6 @@ void PASTEMAC(ch,varname) \
 		ctype* restrict p12; \
 		dim_t           p12_dim, p12_len; \
 		inc_t           incc12, ldc12; \
-		doff_t          diagoffc12; \
 		conj_t          conjc12; \
 \
 		/* Sanity check. Diagonals should not intersect the short end of
@@ -388,13 +453,13 @@ void PASTEMAC(ch,varname) \
 			conjc10    = conjc; \
 \
 			p12_dim    = panel_dim; \
-			p12_len    = panel_len - p10_len; \
-			j          = p10_len; \
-			diagoffc12 = diagoffc_abs - j; \
+			j          = diagoffc_abs + panel_dim; \
+			p12_len    = panel_len - j; \
 			p12        = p + (j  )*ldp; \
-			c12        = c + (j  )*ldc; \
-			c12        = c12 + diagoffc12 * ( doff_t )cs_c + \
-			                  -diagoffc12 * ( doff_t )rs_c;  \
+			/* The reflected image of the region to the right of the
+			   diagonal block begins panel_dim elements past the diagonal
+			   block along the panel dimension. */ \
+			c12        = c + (diagoffc_abs )*ldc + (panel_dim )*incc; \
 			incc12     = ldc; \
 			ldc12      = incc; \
 			conjc12    = conjc; \
@@ -406,7 +471,7 @@ void PASTEMAC(ch,varname) \
 		             ( col_stored && bli_is_upper( uploc ) ) ) */ \
 		{ \
 			p10_dim    = panel_dim; \
-			p10_len    = diagoffc_abs + panel_dim; \
+			p10_len    = diagoffc_abs; \
 			diagoffc10 = diagoffc; \
 			p10        = p; \
 			c10        = c; \
@@ -417,8 +482,8 @@ void PASTEMAC(ch,varname) \
 			conjc10    = conjc; \
 \
 			p12_dim    = panel_dim; \
-			p12_len    = panel_len - p10_len; \
-			j          = p10_len; \
+			j          = diagoffc_abs + panel_dim; \
+			p12_len    = panel_len - j; \
 			p12        = p + (j  )*ldp; \
 			c12        = c + (j  )*ldc; \
 			incc12     = incc; \
@@ -429,12 +494,13 @@ void PASTEMAC(ch,varname) \
 				bli_toggle_conj( &conjc10 ); \
 		} \
 \
-		/* Pack to p10. For upper storage, this includes the unstored
-		   triangle of c11. */ \
+		/* Pack to p10, the part of the micro-panel to the left of the
+		   diagonal block. */ \
 		/* NOTE: Since we're only packing partial panels here, we pass in
 		   p1x_len as panel_len_max; otherwise, the packm kernel will zero-
 		   fill the columns up to panel_len_max, which is not what we need
 		   or want to happen. */ \
+		if ( p10_len > 0 ) \
 		PASTEMAC(ch,kername) \
 		( \
 		  conjc10, \
@@ -449,12 +515,9 @@ void PASTEMAC(ch,varname) \
 		  cntx  \
 		); \
 \
-		/* Pack to p12. For lower storage, this includes the unstored
-		   triangle of c11. */ \
-		/* NOTE: Since we're only packing partial panels here, we pass in
-		   p1x_len as panel_len_max; otherwise, the packm kernel will zero-
-		   fill the columns up to panel_len_max, which is not what we need
-		   or want to happen. */ \
+		/* Pack to p12, the part of the micro-panel to the right of the
+		   diagonal block. */ \
+		if ( p12_len > 0 ) \
 		PASTEMAC(ch,kername) \
 		( \
 		  conjc12, \
@@ -469,59 +532,24 @@ void PASTEMAC(ch,varname) \
 		  cntx  \
 		); \
 \
-		/* Pack the stored triangle of c11 to p11. */ \
+		/* Pack the diagonal block c11 to p11 in a single pass, reading
+		   the stored triangle directly and the unstored triangle from its
+		   (conjugate-)transposed image. */ \
 		{ \
-			dim_t           p11_m  = panel_dim; \
-			dim_t           p11_n  = panel_dim; \
 			dim_t           j2     = diagoffc_abs; \
 			ctype* restrict c11    = c + (j2 )*ldc; \
 			ctype* restrict p11    = p + (j2 )*ldp; \
-			trans_t         transc = ( trans_t )conjc; \
 \
-			PASTEMAC2(ch,copym,BLIS_TAPI_EX_SUF) \
+			PASTEMAC(ch,packm_herm_diag_cxk) \
 			( \
-			  0, \
-			  BLIS_NONUNIT_DIAG, \
+			  strucc, \
 			  uploc, \
-			  transc, \
-			  p11_m, \
-			  p11_n, \
-			  c11, rs_c, cs_c, \
-			  p11, rs_p, cs_p, \
-			  cntx, \
-			  NULL  \
-			); \
-\
-			/* If source matrix c is Hermitian, we have to zero out the
-			   imaginary components of the diagonal of p11 in case the
-			   corresponding elements in c11 were not already zero. */ \
-			if ( bli_is_hermitian( strucc ) ) \
-			{ \
-				ctype* restrict pi11 = p11; \
-\
-				for ( i = 0; i < p11_m; ++i ) \
-				{ \
-					PASTEMAC(ch,seti0s)( *pi11 ); \
-\
-					pi11 += rs_p + cs_p; \
-				} \
-			} \
-\
-			/* Now that the diagonal has been made explicitly Hermitian
-			   (if applicable), we can now safely scale the stored
-			   triangle specified by uploc. */ \
-			PASTEMAC2(ch,scalm,BLIS_TAPI_EX_SUF) \
-			( \
-			  BLIS_NO_CONJUGATE, \
-			  0, \
-			  BLIS_NONUNIT_DIAG, \
-			  uploc, \
-			  p11_m, \
-			  p11_n, \
+			  conjc, \
+			  schema, \
+			  panel_dim, \
 			  kappa, \
-			  p11, rs_p, cs_p, \
-			  cntx, \
-			  NULL  \
+			  c11, rs_c, cs_c, \
+			  p11, ldp  \
 			); \
 		} \
 	} \
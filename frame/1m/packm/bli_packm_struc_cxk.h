@@ -89,6 +89,25 @@ INSERT_GENTPROT_BASIC0( packm_herm_cxk )
 
 
 
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       struc_t         strucc, \
+       uplo_t          uploc, \
+       conj_t          conjc, \
+       pack_t          schema, \
+       dim_t           panel_dim, \
+       ctype* restrict kappa, \
+       ctype* restrict c, inc_t rs_c, inc_t cs_c, \
+       ctype* restrict p,             inc_t ldp  \
+     );
+
+INSERT_GENTPROT_BASIC0( packm_herm_diag_cxk )
+
+
+
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, varname ) \
 \
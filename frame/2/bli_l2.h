@@ -57,14 +57,19 @@
 #include "bli_l2_fpa.h"
 
 // Operation-specific headers
+#include "bli_gbmv.h"
 #include "bli_gemv.h"
 #include "bli_ger.h"
+#include "bli_hbmv.h"
 #include "bli_hemv.h"
 #include "bli_her.h"
 #include "bli_her2.h"
+#include "bli_hpmv.h"
 #include "bli_symv.h"
 #include "bli_syr.h"
 #include "bli_syr2.h"
+#include "bli_tbsv.h"
+#include "bli_tpsv.h"
 #include "bli_trmv.h"
 #include "bli_trsv.h"
 
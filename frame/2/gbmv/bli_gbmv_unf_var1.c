@@ -0,0 +1,448 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Bands holding fewer elements than this are computed by a single thread;
+// below it the cost of forking a team outweighs the work.
+#define BLIS_GBMV_MT_THRESH ( 256 * 256 )
+
+//
+// A band is addressed through the BLAS band storage: element ( i, j ) is
+// a[ ( ku + i - j ) + j*lda ] for -kl <= j - i <= ku. Equivalently, with
+// a_d = a + ku and cs = lda - 1, it is a_d[ i + j*cs ], which lets any
+// rectangle of the band be handed to a fused level-1f kernel as an ordinary
+// column-major matrix with unit row stride and column stride cs.
+//
+// The diagonal offsets kl and ku may be negative, which describes bands that
+// exclude the main diagonal (e.g. kl = -1 is the strictly upper part).
+// Sub-bands are formed the same way as sub-matrices: rows starting at r0
+// and columns starting at c0 are the band at a + c0*lda with offsets
+// kl + ( c0 - r0 ) and ku - ( c0 - r0 ).
+//
+
+// Query the context for the fused kernel used on the interior of the band
+// and the fusing factor that goes with it.
+static void bli_gbmv_ker_query
+     (
+       num_t    dt,
+       bool     trans,
+       cntx_t*  cntx,
+       void_fp* ker,
+       dim_t*   b_fuse
+     )
+{
+	*ker    = bli_cntx_get_l1f_ker_dt( dt, trans ? BLIS_DOTXF_KER
+	                                             : BLIS_AXPYF_KER, cntx );
+	*b_fuse = bli_cntx_get_blksz_def_dt( dt, trans ? BLIS_DF : BLIS_AF, cntx );
+}
+
+//
+// y := y + alpha * conja( A ) * x, or y := y + alpha * conja( A )^T * x,
+// over the whole band. Columns are taken in blocks of the fusing factor;
+// the rows that every column of a block touches form a rectangle that goes
+// to axpyf (or dotxf), and the two small triangles left over at the ends of
+// the block are done element-wise. Bands less than twice as wide as a block
+// are done element-wise in full, as are blocks whose columns share no rows.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       dim_t   m, \
+       dim_t   n, \
+       doff_t  kl, \
+       doff_t  ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t  dt    = PASTEMAC(ch,type); \
+	const conj_t conja = bli_extract_conj( transa ); \
+	const bool   trans = bli_does_trans( transa ); \
+\
+	if ( kl + ku + 1 <= 0 ) return; \
+\
+	ctype* restrict a_d = a + ku; \
+	const inc_t     cs  = lda - 1; \
+\
+	void_fp ker; \
+	dim_t   b_fuse; \
+\
+	bli_gbmv_ker_query( dt, trans, cntx, &ker, &b_fuse ); \
+\
+	/* Below this width the shared rectangles are too short to pay for
+	   the kernel calls. */ \
+	const bool use_ker = ( kl + ku + 1 >= 2 * b_fuse ); \
+\
+	/* Columns outside [j_beg, j_end) hold no element of the band. */ \
+	const dim_t j_beg = bli_max( 0, -kl ); \
+	const dim_t j_end = bli_min( n, m + ku ); \
+\
+	dim_t f; \
+\
+	for ( dim_t j0 = j_beg; j0 < j_end; j0 += f ) \
+	{ \
+		f = bli_min( b_fuse, j_end - j0 ); \
+\
+		/* Rows touched by every column of the block. */ \
+		const dim_t r0     = bli_max( 0, j0 + f - 1 - ku ); \
+		const dim_t r1     = bli_min( m, j0 + kl + 1 ); \
+		const bool  shared = ( use_ker && r0 < r1 ); \
+\
+		if ( shared ) \
+		{ \
+			if ( trans ) \
+			{ \
+				( ( PASTECH(ch,dotxf_ker_ft) )ker ) \
+				( \
+				  conja, \
+				  BLIS_NO_CONJUGATE, \
+				  r1 - r0, \
+				  f, \
+				  alpha, \
+				  a_d + r0 + j0*cs, 1, cs, \
+				  x + r0*incx, incx, \
+				  PASTEMAC(ch,1), \
+				  y + j0*incy, incy, \
+				  cntx  \
+				); \
+			} \
+			else \
+			{ \
+				( ( PASTECH(ch,axpyf_ker_ft) )ker ) \
+				( \
+				  conja, \
+				  BLIS_NO_CONJUGATE, \
+				  r1 - r0, \
+				  f, \
+				  alpha, \
+				  a_d + r0 + j0*cs, 1, cs, \
+				  x + j0*incx, incx, \
+				  y + r0*incy, incy, \
+				  cntx  \
+				); \
+			} \
+		} \
+\
+		for ( dim_t j = j0; j < j0 + f; ++j ) \
+		{ \
+			ctype* restrict a_j = a_d + j*cs; \
+			const dim_t     i0  = bli_max( 0, j - ku ); \
+			const dim_t     i1  = bli_min( m, j + kl + 1 ); \
+\
+			/* The segments [i0,r0) and [r1,i1) of the column remain, or
+			   all of [i0,i1) if there was no shared rectangle. */ \
+			const dim_t s0 = ( shared ? r0 : i1 ); \
+			const dim_t s1 = ( shared ? r1 : i1 ); \
+\
+			if ( trans ) \
+			{ \
+				ctype rho; \
+\
+				PASTEMAC(ch,set0s)( rho ); \
+\
+				if ( bli_is_conj( conja ) ) \
+				{ \
+					for ( dim_t i = i0; i < s0; ++i ) \
+						PASTEMAC(ch,dotjs)( a_j[ i ], x[ i*incx ], rho ); \
+					for ( dim_t i = s1; i < i1; ++i ) \
+						PASTEMAC(ch,dotjs)( a_j[ i ], x[ i*incx ], rho ); \
+				} \
+				else \
+				{ \
+					for ( dim_t i = i0; i < s0; ++i ) \
+						PASTEMAC(ch,dots)( a_j[ i ], x[ i*incx ], rho ); \
+					for ( dim_t i = s1; i < i1; ++i ) \
+						PASTEMAC(ch,dots)( a_j[ i ], x[ i*incx ], rho ); \
+				} \
+\
+				PASTEMAC(ch,axpys)( *alpha, rho, y[ j*incy ] ); \
+			} \
+			else \
+			{ \
+				ctype chi; \
+\
+				PASTEMAC(ch,scal2s)( *alpha, x[ j*incx ], chi ); \
+\
+				if ( bli_is_conj( conja ) ) \
+				{ \
+					for ( dim_t i = i0; i < s0; ++i ) \
+						PASTEMAC(ch,axpyjs)( chi, a_j[ i ], y[ i*incy ] ); \
+					for ( dim_t i = s1; i < i1; ++i ) \
+						PASTEMAC(ch,axpyjs)( chi, a_j[ i ], y[ i*incy ] ); \
+				} \
+				else \
+				{ \
+					for ( dim_t i = i0; i < s0; ++i ) \
+						PASTEMAC(ch,axpys)( chi, a_j[ i ], y[ i*incy ] ); \
+					for ( dim_t i = s1; i < i1; ++i ) \
+						PASTEMAC(ch,axpys)( chi, a_j[ i ], y[ i*incy ] ); \
+				} \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( gbmv_unf_ker )
+
+//
+// Scale the elements [y0,y1) of y by beta and accumulate their part of the
+// product. For the non-transposed case those are rows of A, so only the
+// columns whose band reaches them are read; for the transposed case they
+// are columns of A, and only the rows in their band are read.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       dim_t   m, \
+       dim_t   n, \
+       doff_t  kl, \
+       doff_t  ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       dim_t   y0, \
+       dim_t   y1, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	if ( y0 >= y1 ) return; \
+\
+	PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  y1 - y0, \
+	  beta, \
+	  y + y0*incy, incy, \
+	  cntx, \
+	  NULL  \
+	); \
+\
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) return; \
+\
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		const dim_t c0 = bli_max( 0, y0 - kl ); \
+		const dim_t c1 = bli_min( n, y1 + ku ); \
+\
+		if ( c0 >= c1 ) return; \
+\
+		PASTEMAC(ch,gbmv_unf_ker) \
+		( \
+		  transa, \
+		  y1 - y0, \
+		  c1 - c0, \
+		  kl + ( c0 - y0 ), \
+		  ku - ( c0 - y0 ), \
+		  alpha, \
+		  a + c0*lda, lda, \
+		  x + c0*incx, incx, \
+		  y + y0*incy, incy, \
+		  cntx  \
+		); \
+	} \
+	else \
+	{ \
+		const dim_t r0 = bli_max( 0, y0 - ku ); \
+		const dim_t r1 = bli_min( m, y1 + kl ); \
+\
+		if ( r0 >= r1 ) return; \
+\
+		PASTEMAC(ch,gbmv_unf_ker) \
+		( \
+		  transa, \
+		  r1 - r0, \
+		  y1 - y0, \
+		  kl + ( y0 - r0 ), \
+		  ku - ( y0 - r0 ), \
+		  alpha, \
+		  a + y0*lda, lda, \
+		  x + r0*incx, incx, \
+		  y + y0*incy, incy, \
+		  cntx  \
+		); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( gbmv_unf_range )
+
+
+#ifdef BLIS_ENABLE_OPENMP
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       dim_t   m, \
+       dim_t   n, \
+       doff_t  kl, \
+       doff_t  ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       dim_t   n_elem, \
+       dim_t   n_threads, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	if ( n_threads == 1 ) \
+	{ \
+		PASTEMAC(ch,gbmv_unf_range) \
+		( \
+		  transa, m, n, kl, ku, alpha, a, lda, x, incx, \
+		  beta, y, incy, 0, n_elem, cntx \
+		); \
+		return; \
+	} \
+\
+	_Pragma( "omp parallel num_threads(n_threads)" ) \
+	{ \
+		thrinfo_t thread; \
+		dim_t     y0; \
+		dim_t     y1; \
+\
+		thread.n_way   = omp_get_num_threads(); \
+		thread.work_id = omp_get_thread_num(); \
+\
+		/* Each thread owns a contiguous piece of y, so no two threads
+		   write the same element. */ \
+		bli_thread_range_sub( &thread, n_elem, 8, FALSE, &y0, &y1 ); \
+\
+		PASTEMAC(ch,gbmv_unf_range) \
+		( \
+		  transa, m, n, kl, ku, alpha, a, lda, x, incx, \
+		  beta, y, incy, y0, y1, cntx \
+		); \
+	} \
+}
+
+#else
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       dim_t   m, \
+       dim_t   n, \
+       doff_t  kl, \
+       doff_t  ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       dim_t   n_elem, \
+       dim_t   n_threads, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	PASTEMAC(ch,gbmv_unf_range) \
+	( \
+	  transa, m, n, kl, ku, alpha, a, lda, x, incx, \
+	  beta, y, incy, 0, n_elem, cntx \
+	); \
+}
+
+#endif
+
+INSERT_GENTFUNC_BASIC0( gbmv_unf_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       trans_t transa, \
+       dim_t   m, \
+       dim_t   n, \
+       doff_t  kl, \
+       doff_t  ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_3); \
+\
+	bli_init_once(); \
+\
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	const dim_t n_elem = ( bli_does_notrans( transa ) ? m : n ); \
+	const dim_t w      = bli_max( 0, kl + ku + 1 ); \
+\
+	dim_t n_threads = 1; \
+\
+	if ( bli_min( m, n ) * w >= BLIS_GBMV_MT_THRESH ) \
+	{ \
+		rntm_t rntm; \
+		bli_rntm_init_from_global( &rntm ); \
+\
+		n_threads = bli_rntm_num_threads( &rntm ); \
+		n_threads = bli_max( 1, bli_min( n_threads, n_elem / 64 ) ); \
+	} \
+\
+	PASTEMAC(ch,gbmv_unf_mt) \
+	( \
+	  transa, m, n, kl, ku, alpha, a, lda, x, incx, \
+	  beta, y, incy, n_elem, n_threads, cntx \
+	); \
+\
+	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3); \
+}
+
+INSERT_GENTFUNC_BASIC0( gbmv_unf_var1 )
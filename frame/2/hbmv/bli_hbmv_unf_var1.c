@@ -0,0 +1,363 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Bands holding fewer elements than this are computed by a single thread.
+// Matches the threshold of the general band variant, which does the work
+// when more than one thread is used.
+#define BLIS_HBMV_MT_THRESH ( 256 * 256 )
+
+// Query the fused dotxaxpyf kernel used on the interior of the band along
+// with the fusing factor it was written for.
+static void bli_hbmv_ker_query
+     (
+       num_t    dt,
+       cntx_t*  cntx,
+       void_fp* ker,
+       dim_t*   b_fuse
+     )
+{
+#if defined(BLIS_KERNELS_ZEN)
+	if ( bli_cpuid_is_avx_supported() == TRUE )
+	{
+		switch ( dt )
+		{
+			case BLIS_DOUBLE:
+				*ker    = ( void_fp )bli_ddotxaxpyf_zen_int_8;
+				*b_fuse = 8;
+				return;
+			case BLIS_SCOMPLEX:
+				*ker    = ( void_fp )bli_cdotxaxpyf_zen_int_8;
+				*b_fuse = 4;
+				return;
+			case BLIS_DCOMPLEX:
+				*ker    = ( void_fp )bli_zdotxaxpyf_zen_int_8;
+				*b_fuse = 4;
+				return;
+			default:
+				break;
+		}
+	}
+#endif
+
+	*ker    = bli_cntx_get_l1f_ker_dt( dt, BLIS_DOTXAXPYF_KER, cntx );
+	*b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_XF, cntx );
+}
+
+//
+// y := y + alpha * ( S + conjh( S )^T ) * x, where S is a band that excludes
+// the main diagonal (kl or ku is -1; see bli_gbmv_unf_var1.c for how bands
+// are addressed). Each element of S is read once: the columns are taken in
+// blocks of the fusing factor as in the general band variant, and both
+// products are formed together, by dotxaxpyf on the rectangle shared by the
+// columns of a block and element-wise on the triangles at its ends. The
+// shared rows never overlap the columns of their block, so the two parts of
+// y the kernel updates are disjoint.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conjh, \
+       dim_t   m, \
+       doff_t  kl, \
+       doff_t  ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	if ( kl + ku + 1 <= 0 ) return; \
+\
+	ctype* restrict a_d = a + ku; \
+	const inc_t     cs  = lda - 1; \
+\
+	PASTECH(ch,dotxaxpyf_ker_ft) kfp_xf; \
+	void_fp                      ker; \
+	dim_t                        b_fuse; \
+\
+	bli_hbmv_ker_query( dt, cntx, &ker, &b_fuse ); \
+\
+	kfp_xf = ( PASTECH(ch,dotxaxpyf_ker_ft) )ker; \
+\
+	const bool  use_ker = ( kl + ku + 1 >= 2 * b_fuse ); \
+	const dim_t j_beg   = bli_max( 0, -kl ); \
+	const dim_t j_end   = bli_min( m, m + ku ); \
+\
+	dim_t f; \
+\
+	for ( dim_t j0 = j_beg; j0 < j_end; j0 += f ) \
+	{ \
+		f = bli_min( b_fuse, j_end - j0 ); \
+\
+		const dim_t r0     = bli_max( 0, j0 + f - 1 - ku ); \
+		const dim_t r1     = bli_min( m, j0 + kl + 1 ); \
+		const bool  shared = ( use_ker && r0 < r1 ); \
+\
+		if ( shared ) \
+		{ \
+			/* y1 = y1 + alpha * conjh( S )^T * x_r;
+			   y_r = y_r + alpha * S * x1; */ \
+			kfp_xf \
+			( \
+			  conjh, \
+			  BLIS_NO_CONJUGATE, \
+			  BLIS_NO_CONJUGATE, \
+			  BLIS_NO_CONJUGATE, \
+			  r1 - r0, \
+			  f, \
+			  alpha, \
+			  a_d + r0 + j0*cs, 1, cs, \
+			  x + r0*incx, incx, \
+			  x + j0*incx, incx, \
+			  PASTEMAC(ch,1), \
+			  y + j0*incy, incy, \
+			  y + r0*incy, incy, \
+			  cntx  \
+			); \
+		} \
+\
+		for ( dim_t j = j0; j < j0 + f; ++j ) \
+		{ \
+			ctype* restrict a_j = a_d + j*cs; \
+			const dim_t     i0  = bli_max( 0, j - ku ); \
+			const dim_t     i1  = bli_min( m, j + kl + 1 ); \
+			const dim_t     s0  = ( shared ? r0 : i1 ); \
+			const dim_t     s1  = ( shared ? r1 : i1 ); \
+			ctype           alpha_chi; \
+			ctype           rho; \
+\
+			PASTEMAC(ch,scal2s)( *alpha, x[ j*incx ], alpha_chi ); \
+			PASTEMAC(ch,set0s)( rho ); \
+\
+			if ( bli_is_conj( conjh ) ) \
+			{ \
+				for ( dim_t i = i0; i < s0; ++i ) \
+				{ \
+					PASTEMAC(ch,dotjs)( a_j[ i ], x[ i*incx ], rho ); \
+					PASTEMAC(ch,axpys)( alpha_chi, a_j[ i ], y[ i*incy ] ); \
+				} \
+				for ( dim_t i = s1; i < i1; ++i ) \
+				{ \
+					PASTEMAC(ch,dotjs)( a_j[ i ], x[ i*incx ], rho ); \
+					PASTEMAC(ch,axpys)( alpha_chi, a_j[ i ], y[ i*incy ] ); \
+				} \
+			} \
+			else \
+			{ \
+				for ( dim_t i = i0; i < s0; ++i ) \
+				{ \
+					PASTEMAC(ch,dots)( a_j[ i ], x[ i*incx ], rho ); \
+					PASTEMAC(ch,axpys)( alpha_chi, a_j[ i ], y[ i*incy ] ); \
+				} \
+				for ( dim_t i = s1; i < i1; ++i ) \
+				{ \
+					PASTEMAC(ch,dots)( a_j[ i ], x[ i*incx ], rho ); \
+					PASTEMAC(ch,axpys)( alpha_chi, a_j[ i ], y[ i*incy ] ); \
+				} \
+			} \
+\
+			PASTEMAC(ch,axpys)( *alpha, rho, y[ j*incy ] ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( hbmv_unf_ker )
+
+//
+// y := beta * y + alpha * A * x, where A is a symmetric (conjh = no conjugate)
+// or Hermitian (conjh = conjugate) band matrix with k off-diagonals, of which
+// only the triangle selected by uploa is stored in BLAS band storage.
+//
+// The stored triangle without its diagonal, S, is a band of its own. A single
+// thread applies S and conjh( S )^T together in one pass over the band. When
+// several threads are used, each thread owns a piece of y, so S and
+// conjh( S )^T are instead applied one after the other through the threaded
+// general band variant. The diagonal is applied last. For the Hermitian case
+// the imaginary parts of the diagonal are assumed to be zero and are not
+// read.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjh, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_3); \
+\
+	bli_init_once(); \
+\
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	const trans_t transs = ( bli_is_conj( conjh ) ? BLIS_CONJ_TRANSPOSE \
+	                                              : BLIS_TRANSPOSE ); \
+	ctype*  s; \
+	ctype*  a_diag; \
+	doff_t  kl, ku; \
+\
+	if ( bli_is_upper( uploa ) ) \
+	{ \
+		/* The diagonal is row k of the storage; the strictly upper part
+		   keeps the storage as is. */ \
+		s      = a; \
+		kl     = -1; \
+		ku     = k; \
+		a_diag = a + k; \
+	} \
+	else \
+	{ \
+		/* The diagonal is row 0 of the storage; the strictly lower part
+		   is addressed with ku = -1, which moves its origin down by one. */ \
+		s      = a + 1; \
+		kl     = k; \
+		ku     = -1; \
+		a_diag = a; \
+	} \
+\
+	dim_t n_threads = 1; \
+\
+	if ( m * k >= BLIS_HBMV_MT_THRESH ) \
+	{ \
+		rntm_t rntm; \
+		bli_rntm_init_from_global( &rntm ); \
+\
+		n_threads = bli_rntm_num_threads( &rntm ); \
+	} \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		/* y = beta * y + alpha * S * x; */ \
+		PASTEMAC(ch,gbmv_unf_var1) \
+		( \
+		  BLIS_NO_TRANSPOSE, \
+		  m, m, kl, ku, \
+		  alpha, \
+		  s, lda, \
+		  x, incx, \
+		  beta, \
+		  y, incy, \
+		  cntx  \
+		); \
+\
+		/* y = y + alpha * conjh( S )^T * x; */ \
+		if ( PASTEMAC(ch,eq0)( *alpha ) == FALSE ) \
+		{ \
+			PASTEMAC(ch,gbmv_unf_var1) \
+			( \
+			  transs, \
+			  m, m, kl, ku, \
+			  alpha, \
+			  s, lda, \
+			  x, incx, \
+			  PASTEMAC(ch,1), \
+			  y, incy, \
+			  cntx  \
+			); \
+		} \
+	} \
+	else \
+	{ \
+		/* y = beta * y; */ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+\
+		/* y = y + alpha * ( S + conjh( S )^T ) * x; */ \
+		if ( PASTEMAC(ch,eq0)( *alpha ) == FALSE ) \
+		{ \
+			PASTEMAC(ch,hbmv_unf_ker) \
+			( \
+			  conjh, \
+			  m, kl, ku, \
+			  alpha, \
+			  s, lda, \
+			  x, incx, \
+			  y, incy, \
+			  cntx  \
+			); \
+		} \
+	} \
+\
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3); \
+		return; \
+	} \
+\
+	/* y = y + alpha * D * x; */ \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ctype alpha_chi; \
+		ctype delta; \
+\
+		PASTEMAC(ch,scal2s)( *alpha, x[ i*incx ], alpha_chi ); \
+		PASTEMAC(ch,copys)( a_diag[ i*lda ], delta ); \
+\
+		if ( bli_is_conj( conjh ) ) \
+		{ \
+			PASTEMAC(ch,seti0s)( delta ); \
+		} \
+\
+		PASTEMAC(ch,axpys)( alpha_chi, delta, y[ i*incy ] ); \
+	} \
+\
+	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3); \
+}
+
+INSERT_GENTFUNC_BASIC0( hbmv_unf_var1 )
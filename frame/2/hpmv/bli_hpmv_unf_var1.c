@@ -0,0 +1,161 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// y := beta * y + alpha * A * x, where A is a symmetric (conjh = no conjugate)
+// or Hermitian (conjh = conjugate) matrix of which only the triangle selected
+// by uploa is stored, packed by columns.
+//
+// Each stored column is read once: the dotaxpyv kernel forms its dot product
+// with x, which completes one element of y, while scattering the same column
+// into y as the reflected row. For the Hermitian case the imaginary parts of
+// the diagonal are assumed to be zero and are not read.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjh, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  ap, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_3); \
+\
+	bli_init_once(); \
+\
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* y = beta * y; */ \
+	PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  m, \
+	  beta, \
+	  y, incy, \
+	  cntx, \
+	  NULL  \
+	); \
+\
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3); \
+		return; \
+	} \
+\
+	PASTECH(ch,dotaxpyv_ker_ft) kfp_vf; \
+\
+	kfp_vf = bli_cntx_get_l1f_ker_dt( dt, BLIS_DOTAXPYV_KER, cntx ); \
+\
+	ctype* a_j = ap; \
+\
+	for ( dim_t j = 0; j < m; ++j ) \
+	{ \
+		ctype*  a_off; \
+		ctype*  alpha11; \
+		ctype*  x_off; \
+		ctype*  y_off; \
+		dim_t   n_off; \
+		ctype   alpha_chi; \
+		ctype   delta; \
+		ctype   rho; \
+\
+		if ( bli_is_upper( uploa ) ) \
+		{ \
+			/* Column j holds rows 0..j, the diagonal last. */ \
+			a_off   = a_j; \
+			alpha11 = a_j + j; \
+			x_off   = x; \
+			y_off   = y; \
+			n_off   = j; \
+			a_j    += j + 1; \
+		} \
+		else \
+		{ \
+			/* Column j holds rows j..m-1, the diagonal first. */ \
+			a_off   = a_j + 1; \
+			alpha11 = a_j; \
+			x_off   = x + ( j + 1 )*incx; \
+			y_off   = y + ( j + 1 )*incy; \
+			n_off   = m - j - 1; \
+			a_j    += m - j; \
+		} \
+\
+		PASTEMAC(ch,scal2s)( *alpha, x[ j*incx ], alpha_chi ); \
+		PASTEMAC(ch,copys)( *alpha11, delta ); \
+\
+		if ( bli_is_conj( conjh ) ) \
+		{ \
+			PASTEMAC(ch,seti0s)( delta ); \
+		} \
+\
+		/* rho = conjh( a_off )^T * x_off;
+		   y_off = y_off + alpha * chi * a_off; */ \
+		PASTEMAC(ch,set0s)( rho ); \
+\
+		kfp_vf \
+		( \
+		  conjh, \
+		  BLIS_NO_CONJUGATE, \
+		  BLIS_NO_CONJUGATE, \
+		  n_off, \
+		  &alpha_chi, \
+		  a_off, 1, \
+		  x_off, incx, \
+		  &rho, \
+		  y_off, incy, \
+		  cntx  \
+		); \
+\
+		/* psi = psi + alpha * ( rho + delta * chi ); */ \
+		PASTEMAC(ch,axpys)( *alpha, rho, y[ j*incy ] ); \
+		PASTEMAC(ch,axpys)( alpha_chi, delta, y[ j*incy ] ); \
+	} \
+\
+	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3); \
+}
+
+INSERT_GENTFUNC_BASIC0( hpmv_unf_var1 )
@@ -0,0 +1,173 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Number of unknowns solved per block. The coupling of a block to the
+// unknowns solved before it goes through the general band variant, and
+// only the triangle on the diagonal of the block is solved element-wise.
+#define BLIS_TBSV_BLK 64
+
+//
+// Solve transa( A ) * x = b for x, where A is a triangular band matrix with
+// k off-diagonals stored in BLAS band storage and b is given in x.
+//
+// The unknowns are processed in blocks, in the order implied by the shape of
+// transa( A ). Before a block is solved, its right-hand side is updated with
+// the (at most k) unknowns that precede it and couple to it, which is a
+// band matrix-vector product on a sub-band of A.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  a, inc_t lda, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_3); \
+\
+	bli_init_once(); \
+\
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	ctype*       minus_one = PASTEMAC(ch,m1); \
+	ctype*       one       = PASTEMAC(ch,1); \
+	const conj_t conja     = bli_extract_conj( transa ); \
+	const doff_t kl        = ( bli_is_upper( uploa ) ? 0 : k ); \
+	const doff_t ku        = ( bli_is_upper( uploa ) ? k : 0 ); \
+\
+	/* Element ( i, j ) of transa( A ) is at a_d[ i*rs + j*cs ]. */ \
+	ctype* restrict a_d = a + ku; \
+	const inc_t     rs  = ( bli_does_notrans( transa ) ? 1 : lda - 1 ); \
+	const inc_t     cs  = ( bli_does_notrans( transa ) ? lda - 1 : 1 ); \
+\
+	/* transa( A ) is lower triangular if exactly one of "A is lower" and
+	   "A is transposed" holds; then the solve runs forward. */ \
+	const bool forward = ( bli_is_lower( uploa ) == bli_does_notrans( transa ) ); \
+\
+	const dim_t b_n = ( m + BLIS_TBSV_BLK - 1 ) / BLIS_TBSV_BLK; \
+\
+	for ( dim_t b = 0; b < b_n; ++b ) \
+	{ \
+		dim_t j0, j1; \
+\
+		if ( forward ) \
+		{ \
+			j0 = b * BLIS_TBSV_BLK; \
+			j1 = bli_min( m, j0 + BLIS_TBSV_BLK ); \
+		} \
+		else \
+		{ \
+			j1 = m - b * BLIS_TBSV_BLK; \
+			j0 = bli_max( 0, j1 - BLIS_TBSV_BLK ); \
+		} \
+\
+		/* The solved unknowns [p0,p1) that couple to this block. */ \
+		const dim_t p0 = ( forward ? bli_max( 0, j0 - k ) : j1 ); \
+		const dim_t p1 = ( forward ? j0 : bli_min( m, j1 + k ) ); \
+\
+		if ( p0 < p1 ) \
+		{ \
+			/* Rows and columns of A where the coupling block starts. */ \
+			const dim_t r0 = ( bli_does_notrans( transa ) ? j0 : p0 ); \
+			const dim_t c0 = ( bli_does_notrans( transa ) ? p0 : j0 ); \
+			const dim_t mr = ( bli_does_notrans( transa ) ? j1 - j0 : p1 - p0 ); \
+			const dim_t nc = ( bli_does_notrans( transa ) ? p1 - p0 : j1 - j0 ); \
+\
+			/* x1 = x1 - transa( A( r, c ) ) * x_p; */ \
+			PASTEMAC(ch,gbmv_unf_var1) \
+			( \
+			  transa, \
+			  mr, nc, \
+			  kl + ( c0 - r0 ), \
+			  ku - ( c0 - r0 ), \
+			  minus_one, \
+			  a + c0*lda, lda, \
+			  x + p0*incx, incx, \
+			  one, \
+			  x + j0*incx, incx, \
+			  cntx  \
+			); \
+		} \
+\
+		/* Solve the triangle on the diagonal of the block. */ \
+		for ( dim_t l = 0; l < j1 - j0; ++l ) \
+		{ \
+			const dim_t i  = ( forward ? j0 + l : j1 - 1 - l ); \
+			const dim_t q0 = ( forward ? bli_max( j0, i - k ) : i + 1 ); \
+			const dim_t q1 = ( forward ? i : bli_min( j1, i + k + 1 ) ); \
+			ctype       rho; \
+\
+			PASTEMAC(ch,set0s)( rho ); \
+\
+			if ( bli_is_conj( conja ) ) \
+			{ \
+				for ( dim_t j = q0; j < q1; ++j ) \
+					PASTEMAC(ch,dotjs)( a_d[ i*rs + j*cs ], x[ j*incx ], rho ); \
+			} \
+			else \
+			{ \
+				for ( dim_t j = q0; j < q1; ++j ) \
+					PASTEMAC(ch,dots)( a_d[ i*rs + j*cs ], x[ j*incx ], rho ); \
+			} \
+\
+			PASTEMAC(ch,subs)( rho, x[ i*incx ] ); \
+\
+			if ( bli_is_nonunit_diag( diaga ) ) \
+			{ \
+				if ( bli_is_conj( conja ) ) \
+				{ \
+					PASTEMAC(ch,invscaljs)( a_d[ i*rs + i*cs ], x[ i*incx ] ); \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,invscals)( a_d[ i*rs + i*cs ], x[ i*incx ] ); \
+				} \
+			} \
+		} \
+	} \
+\
+	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3); \
+}
+
+INSERT_GENTFUNC_BASIC0( tbsv_unf_var1 )
@@ -0,0 +1,181 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Solve transa( A ) * x = b for x, where A is a triangular matrix packed by
+// columns and b is given in x.
+//
+// A packed column is contiguous, so the column-oriented algorithm is used
+// when transa( A ) is A (each solved unknown is eliminated from the rest of
+// x with axpyv) and the row-oriented one when it is A^T (each unknown is
+// finished with a dotxv against the unknowns solved before it). Either way
+// the kernels stream the stored columns with unit stride.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       ctype*  ap, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_3); \
+\
+	bli_init_once(); \
+\
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	const num_t  dt        = PASTEMAC(ch,type); \
+	ctype*       minus_one = PASTEMAC(ch,m1); \
+	ctype*       one       = PASTEMAC(ch,1); \
+	const conj_t conja     = bli_extract_conj( transa ); \
+	const bool   upper     = bli_is_upper( uploa ); \
+\
+	/* transa( A ) is lower triangular if exactly one of "A is lower" and
+	   "A is transposed" holds; then the solve runs forward. */ \
+	const bool forward = ( !upper == bli_does_notrans( transa ) ); \
+\
+	PASTECH(ch,axpyv_ker_ft) kfp_av; \
+	PASTECH(ch,dotxv_ker_ft) kfp_dv; \
+\
+	kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+	for ( dim_t l = 0; l < m; ++l ) \
+	{ \
+		const dim_t j = ( forward ? l : m - 1 - l ); \
+\
+		/* Column j of A holds rows 0..j (upper, diagonal last) or rows
+		   j..m-1 (lower, diagonal first). a_off is its off-diagonal part
+		   and [i0,i0+n_off) the rows it covers. */ \
+		ctype*  a_j; \
+		ctype*  alpha11; \
+		ctype*  a_off; \
+		dim_t   i0; \
+		dim_t   n_off; \
+\
+		if ( upper ) \
+		{ \
+			a_j     = ap + ( j * ( j + 1 ) ) / 2; \
+			alpha11 = a_j + j; \
+			a_off   = a_j; \
+			i0      = 0; \
+			n_off   = j; \
+		} \
+		else \
+		{ \
+			a_j     = ap + ( j * ( 2 * m - j + 1 ) ) / 2; \
+			alpha11 = a_j; \
+			a_off   = a_j + 1; \
+			i0      = j + 1; \
+			n_off   = m - j - 1; \
+		} \
+\
+		ctype* chi1 = x + j*incx; \
+		ctype* x_off = x + i0*incx; \
+\
+		if ( bli_does_notrans( transa ) ) \
+		{ \
+			/* chi1 = chi1 / conja( alpha11 ); */ \
+			if ( bli_is_nonunit_diag( diaga ) ) \
+			{ \
+				if ( bli_is_conj( conja ) ) \
+				{ \
+					PASTEMAC(ch,invscaljs)( *alpha11, *chi1 ); \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,invscals)( *alpha11, *chi1 ); \
+				} \
+			} \
+\
+			/* x_off = x_off - chi1 * conja( a_off ); */ \
+			ctype minus_chi1; \
+\
+			PASTEMAC(ch,scal2s)( *minus_one, *chi1, minus_chi1 ); \
+\
+			kfp_av \
+			( \
+			  conja, \
+			  n_off, \
+			  &minus_chi1, \
+			  a_off, 1, \
+			  x_off, incx, \
+			  cntx  \
+			); \
+		} \
+		else \
+		{ \
+			/* chi1 = chi1 - conja( a_off )^T * x_off; */ \
+			kfp_dv \
+			( \
+			  conja, \
+			  BLIS_NO_CONJUGATE, \
+			  n_off, \
+			  minus_one, \
+			  a_off, 1, \
+			  x_off, incx, \
+			  one, \
+			  chi1, \
+			  cntx  \
+			); \
+\
+			/* chi1 = chi1 / conja( alpha11 ); */ \
+			if ( bli_is_nonunit_diag( diaga ) ) \
+			{ \
+				if ( bli_is_conj( conja ) ) \
+				{ \
+					PASTEMAC(ch,invscaljs)( *alpha11, *chi1 ); \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,invscals)( *alpha11, *chi1 ); \
+				} \
+			} \
+		} \
+	} \
+\
+	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3); \
+}
+
+INSERT_GENTFUNC_BASIC0( tpsv_unf_var1 )
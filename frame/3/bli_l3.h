@@ -34,6 +34,8 @@
 */
 
 #include "bli_l3_cntl.h"
+#include "bli_l3_plan.h"
+#include "bli_l3_tune.h"
 #include "bli_l3_check.h"
 
 // Define function types.
@@ -75,6 +77,7 @@
 #include "bli_l3_sup_ref.h"
 #include "bli_l3_sup_int.h"
 #include "bli_l3_sup_vars.h"
+#include "bli_l3_sup_direct.h"
 #include "bli_l3_sup_packm_a.h"
 #include "bli_l3_sup_packm_b.h"
 #include "bli_l3_sup_packm_var.h"
@@ -35,47 +35,21 @@
 
 #include "blis.h"
 
-void bli_l3_packm
+// Make sure that the block in mem is at least size_needed bytes, acquiring
+// (or re-acquiring) it from the memory broker and broadcasting it to all
+// threads in the chief's thread group if needed. Return TRUE if a block was
+// acquired, in which case the threads were synchronized by the broadcast.
+static bool bli_l3_packm_acquire
      (
-       obj_t*  x,
-       obj_t*  x_pack,
-       cntx_t* cntx,
-       rntm_t* rntm,
-       cntl_t* cntl,
+       siz_t      size_needed,
+       packbuf_t  pack_buf_type,
+       mem_t*     cntl_mem_p,
+       rntm_t*    rntm,
        thrinfo_t* thread
      )
 {
-	packbuf_t pack_buf_type;
-	mem_t*    cntl_mem_p;
-	mem_t*    local_mem_p;
-	mem_t     local_mem_s;
-	siz_t     size_needed;
-
-	// FGVZ: Not sure why we need this barrier, but we do.
-	bli_thread_barrier( thread );
-
-	// Every thread initializes x_pack and determines the size of memory
-	// block needed (which gets embedded into the otherwise "blank" mem_t
-	// entry in the control tree node).
-	size_needed
-	=
-	bli_packm_init
-	(
-	  x,
-	  x_pack,
-	  cntx,
-	  cntl
-	);
-
-	// If zero was returned, no memory needs to be allocated and so we can
-	// return early.
-	if ( size_needed == 0 ) return;
-
-	// Query the pack buffer type from the control tree node.
-	pack_buf_type = bli_cntl_packm_params_pack_buf_type( cntl );
-
-	// Query the address of the mem_t entry within the control tree node.
-	cntl_mem_p = bli_cntl_pack_mem( cntl );
+	mem_t* local_mem_p;
+	mem_t  local_mem_s;
 
 	// Check the mem_t field in the control tree. If it is unallocated, then
 	// we need to acquire a block from the memory broker and broadcast it to
@@ -106,73 +80,82 @@ void bli_l3_packm
 		// Save the contents of the chief thread's local mem_t entry to the
 		// mem_t field in this thread's control tree node.
 		*cntl_mem_p = *local_mem_p;
+
+		return TRUE;
 	}
-	else // ( bli_mem_is_alloc( cntl_mem_p ) )
-	{
-		// If the mem_t entry in the control tree does NOT contain a NULL
-		// buffer, then a block has already been acquired from the memory
-		// broker and cached in the control tree.
 
-		// As a sanity check, we should make sure that the mem_t object isn't
-		// associated with a block that is too small compared to the size of
-		// the packed matrix buffer that is needed, according to the return
-		// value from packm_init().
-		siz_t cntl_mem_size = bli_mem_size( cntl_mem_p );
+	// If the mem_t entry in the control tree does NOT contain a NULL
+	// buffer, then a block has already been acquired from the memory
+	// broker and cached in the control tree.
+
+	// As a sanity check, we should make sure that the mem_t object isn't
+	// associated with a block that is too small compared to the size of
+	// the packed matrix buffer that is needed, according to the return
+	// value from packm_init().
+	siz_t cntl_mem_size = bli_mem_size( cntl_mem_p );
 
-		if ( cntl_mem_size < size_needed )
+	if ( cntl_mem_size < size_needed )
+	{
+		if ( bli_thread_am_ochief( thread ) )
 		{
-			if ( bli_thread_am_ochief( thread ) )
-			{
-				// The chief thread releases the existing block associated with
-				// the mem_t entry in the control tree, and then re-acquires a
-				// new block, saving the associated mem_t entry to local_mem_s.
-				bli_membrk_release
-				(
-				  rntm,
-				  cntl_mem_p
-				);
-				bli_membrk_acquire_m
-				(
-				  rntm,
-				  size_needed,
-				  pack_buf_type,
-				  &local_mem_s
-				);
-			}
-
-			// Broadcast the address of the chief thread's local mem_t entry to
-			// all threads.
-			local_mem_p = bli_thread_broadcast( thread, &local_mem_s );
-
-			// Save the chief thread's local mem_t entry to the mem_t field in
-			// this thread's control tree node.
-			*cntl_mem_p = *local_mem_p;
+			// The chief thread releases the existing block associated with
+			// the mem_t entry in the control tree, and then re-acquires a
+			// new block, saving the associated mem_t entry to local_mem_s.
+			bli_membrk_release
+			(
+			  rntm,
+			  cntl_mem_p
+			);
+			bli_membrk_acquire_m
+			(
+			  rntm,
+			  size_needed,
+			  pack_buf_type,
+			  &local_mem_s
+			);
 		}
-		else
-		{
-			// If the mem_t entry is already allocated and sufficiently large,
-			// then we use it as-is. No action is needed, because all threads
-			// will already have the cached values in their local control
-			// trees' mem_t entries, currently pointed to by cntl_mem_p.
 
-			bli_thread_barrier( thread );
-		}
-	}
+		// Broadcast the address of the chief thread's local mem_t entry to
+		// all threads.
+		local_mem_p = bli_thread_broadcast( thread, &local_mem_s );
 
+		// Save the chief thread's local mem_t entry to the mem_t field in
+		// this thread's control tree node.
+		*cntl_mem_p = *local_mem_p;
 
-	// Update the buffer address in x_pack to point to the buffer associated
-	// with the mem_t entry acquired from the memory broker (now cached in
-	// the control tree node).
-	void* buf = bli_mem_buffer( cntl_mem_p );
-    bli_obj_set_buffer( buf, x_pack );
+		return TRUE;
+	}
 
+	// If the mem_t entry is already allocated and sufficiently large, then
+	// we use it as-is. No action is needed, because all threads will
+	// already have the cached values in their local control trees' mem_t
+	// entries, currently pointed to by cntl_mem_p.
+	return FALSE;
+}
 
-	// Pack the contents of object x to object x_pack.
-	bli_packm_int
+void bli_l3_packm
+     (
+       obj_t*  x,
+       obj_t*  x_pack,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       cntl_t* cntl,
+       thrinfo_t* thread
+     )
+{
+	// FGVZ: Not sure why we need this barrier, but we do.
+	bli_thread_barrier( thread );
+
+	// Pack x to x_pack using the block cached in the control tree node,
+	// synchronizing the threads before the packing begins.
+	bli_l3_packm_nosync
 	(
 	  x,
 	  x_pack,
+	  bli_cntl_pack_mem( cntl ),
+	  TRUE,
 	  cntx,
+	  rntm,
 	  cntl,
 	  thread
 	);
@@ -181,3 +164,59 @@ void bli_l3_packm
 	bli_thread_barrier( thread );
 }
 
+void bli_l3_packm_nosync
+     (
+       obj_t*  x,
+       obj_t*  x_pack,
+       mem_t*  mem,
+       bool    sync,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       cntl_t* cntl,
+       thrinfo_t* thread
+     )
+{
+	packbuf_t pack_buf_type;
+	siz_t     size_needed;
+
+	// Every thread initializes x_pack and determines the size of memory
+	// block needed (which gets embedded into the otherwise "blank" mem_t
+	// entry).
+	size_needed
+	=
+	bli_packm_init
+	(
+	  x,
+	  x_pack,
+	  cntx,
+	  cntl
+	);
+
+	// If zero was returned, no memory needs to be allocated and so we can
+	// return early.
+	if ( size_needed == 0 ) return;
+
+	// Query the pack buffer type from the control tree node.
+	pack_buf_type = bli_cntl_packm_params_pack_buf_type( cntl );
+
+	// Make sure that the block is large enough. If it was not and had to
+	// be acquired, the threads have already been synchronized.
+	if ( !bli_l3_packm_acquire( size_needed, pack_buf_type, mem,
+	                            rntm, thread ) && sync )
+		bli_thread_barrier( thread );
+
+	// Update the buffer address in x_pack to point to the buffer associated
+	// with the mem_t entry acquired from the memory broker.
+	void* buf = bli_mem_buffer( mem );
+    bli_obj_set_buffer( buf, x_pack );
+
+	// Pack the contents of object x to object x_pack.
+	bli_packm_int
+	(
+	  x,
+	  x_pack,
+	  cntx,
+	  cntl,
+	  thread
+	);
+}
@@ -43,3 +43,20 @@ void bli_l3_packm
        thrinfo_t* thread
      );
 
+// Pack x to x_pack like bli_l3_packm(), but using the block in mem (which
+// is acquired or grown as needed) and without the barriers that precede and
+// follow the packing. If sync is TRUE, the threads are still synchronized
+// before the packing begins. Either way, the caller must synchronize the
+// threads before x_pack is used.
+void bli_l3_packm_nosync
+     (
+       obj_t*  x,
+       obj_t*  x_pack,
+       mem_t*  mem,
+       bool    sync,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       cntl_t* cntl,
+       thrinfo_t* thread
+     );
+
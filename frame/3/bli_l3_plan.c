@@ -0,0 +1,344 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+struct l3plan_s
+{
+	// The key under which the plan is cached.
+	opid_t      family;
+	pack_t      schema_a;
+	pack_t      schema_b;
+	side_t      side;
+	dim_t       n_threads;
+	dim_t       ways[ BLIS_NUM_LOOPS ];
+
+	// The value of the cache generation counter when the plan was created.
+	dim_t       gen;
+
+	// The small block allocator array from which all of the structures
+	// below (and any nodes grown later) are allocated.
+	array_t*    array;
+
+	thrcomm_t*  gl_comm;
+
+	// One control tree and one thrinfo_t tree per thread, or NULL if the
+	// thread has not yet run with this plan.
+	cntl_t**    cntl;
+	thrinfo_t** thread;
+};
+
+// The cache holds idle plans only, most recently used first. A plan that is
+// checked out is removed from the cache, so it can never be shared by two
+// concurrent calls.
+static l3plan_t* plan_cache[ BLIS_L3_PLAN_CACHE_SIZE + 1 ];
+static dim_t     plan_cache_len = 0;
+static dim_t     plan_cache_gen = 0;
+
+static bli_pthread_mutex_t plan_cache_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
+// -----------------------------------------------------------------------------
+
+static void bli_l3_plan_key
+     (
+       opid_t    family,
+       pack_t    schema_a,
+       pack_t    schema_b,
+       obj_t*    a,
+       rntm_t*   rntm,
+       l3plan_t* key
+     )
+{
+	key->family    = family;
+	key->schema_a  = schema_a;
+	key->schema_b  = schema_b;
+	key->n_threads = bli_rntm_num_threads( rntm );
+
+	// The trsm control tree depends on which side the triangular matrix is
+	// on; see bli_l3_cntl_create_if().
+	if ( family == BLIS_TRSM && !bli_obj_is_triangular( a ) )
+		key->side = BLIS_RIGHT;
+	else
+		key->side = BLIS_LEFT;
+
+	key->ways[ BLIS_NC ] = bli_rntm_jc_ways( rntm );
+	key->ways[ BLIS_KC ] = bli_rntm_pc_ways( rntm );
+	key->ways[ BLIS_MC ] = bli_rntm_ic_ways( rntm );
+	key->ways[ BLIS_NR ] = bli_rntm_jr_ways( rntm );
+	key->ways[ BLIS_MR ] = bli_rntm_ir_ways( rntm );
+	key->ways[ BLIS_KR ] = 1;
+}
+
+static bool bli_l3_plan_matches
+     (
+       l3plan_t* plan,
+       l3plan_t* key
+     )
+{
+	if ( plan->family    != key->family    ||
+	     plan->schema_a  != key->schema_a  ||
+	     plan->schema_b  != key->schema_b  ||
+	     plan->side      != key->side      ||
+	     plan->n_threads != key->n_threads ) return FALSE;
+
+	for ( dim_t i = 0; i < BLIS_NUM_LOOPS; ++i )
+		if ( plan->ways[ i ] != key->ways[ i ] ) return FALSE;
+
+	return TRUE;
+}
+
+static l3plan_t* bli_l3_plan_create
+     (
+       l3plan_t* key,
+       dim_t     gen
+     )
+{
+	const dim_t n_threads = key->n_threads;
+	rntm_t      rntm_l;
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_l3_plan_create(): " );
+	#endif
+	l3plan_t* plan = bli_malloc_intl( sizeof( l3plan_t ) );
+
+	*plan = *key;
+	plan->gen = gen;
+
+	plan->cntl   = bli_calloc_intl( n_threads * sizeof( cntl_t* ) );
+	plan->thread = bli_calloc_intl( n_threads * sizeof( thrinfo_t* ) );
+
+	// The plan keeps its own array_t for as long as it lives, so that every
+	// node is released to the pool it was acquired from.
+	plan->array = bli_sba_checkout_array( n_threads );
+
+	bli_rntm_init( &rntm_l );
+	bli_sba_rntm_set_pool( 0, plan->array, &rntm_l );
+
+	plan->gl_comm = bli_thrcomm_create( &rntm_l, n_threads );
+
+	return plan;
+}
+
+static void bli_l3_plan_free
+     (
+       l3plan_t* plan
+     )
+{
+	rntm_t rntm_l;
+
+	bli_rntm_init( &rntm_l );
+	bli_membrk_rntm_set_membrk( &rntm_l );
+
+	// Release each thread's trees with that thread's pool. This mirrors what
+	// the decorators do at the end of a call, but sequentially, which is
+	// fine since freeing involves no synchronization. The global
+	// communicator is freed by thread 0 along with its thrinfo_t tree.
+	for ( dim_t tid = 0; tid < plan->n_threads; ++tid )
+	{
+		if ( plan->cntl[ tid ] == NULL ) continue;
+
+		bli_sba_rntm_set_pool( tid, plan->array, &rntm_l );
+
+		bli_l3_cntl_free( &rntm_l, plan->cntl[ tid ], plan->thread[ tid ] );
+		bli_l3_thrinfo_free( &rntm_l, plan->thread[ tid ] );
+	}
+
+	if ( plan->thread[ 0 ] == NULL )
+	{
+		bli_sba_rntm_set_pool( 0, plan->array, &rntm_l );
+		bli_thrcomm_free( &rntm_l, plan->gl_comm );
+	}
+
+	bli_sba_checkin_array( plan->array );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_l3_plan_free(): " );
+	#endif
+	bli_free_intl( plan->cntl );
+	bli_free_intl( plan->thread );
+	bli_free_intl( plan );
+}
+
+// -----------------------------------------------------------------------------
+
+l3plan_t* bli_l3_plan_checkout
+     (
+       opid_t  family,
+       pack_t  schema_a,
+       pack_t  schema_b,
+       obj_t*  a,
+       rntm_t* rntm,
+       cntl_t* cntl
+     )
+{
+	// Control trees supplied by the caller are copied for every call, and
+	// a plan cannot be built around them.
+	if ( BLIS_L3_PLAN_CACHE_SIZE == 0 || cntl != NULL ) return NULL;
+
+	l3plan_t  key;
+	l3plan_t* plan = NULL;
+	dim_t     gen;
+
+	bli_l3_plan_key( family, schema_a, schema_b, a, rntm, &key );
+
+	bli_pthread_mutex_lock( &plan_cache_mutex );
+
+	gen = plan_cache_gen;
+
+	for ( dim_t i = 0; i < plan_cache_len; ++i )
+	{
+		if ( bli_l3_plan_matches( plan_cache[ i ], &key ) )
+		{
+			plan = plan_cache[ i ];
+
+			for ( dim_t j = i; j < plan_cache_len - 1; ++j )
+				plan_cache[ j ] = plan_cache[ j + 1 ];
+
+			plan_cache_len -= 1;
+			break;
+		}
+	}
+
+	bli_pthread_mutex_unlock( &plan_cache_mutex );
+
+	if ( plan == NULL ) plan = bli_l3_plan_create( &key, gen );
+
+	return plan;
+}
+
+void bli_l3_plan_checkin
+     (
+       l3plan_t* plan
+     )
+{
+	if ( plan == NULL ) return;
+
+	l3plan_t* evict = NULL;
+
+	bli_pthread_mutex_lock( &plan_cache_mutex );
+
+	if ( plan->gen != plan_cache_gen )
+	{
+		// The plan was created before the cache was last flushed.
+		evict = plan;
+	}
+	else
+	{
+		if ( plan_cache_len == BLIS_L3_PLAN_CACHE_SIZE )
+		{
+			evict = plan_cache[ plan_cache_len - 1 ];
+			plan_cache_len -= 1;
+		}
+
+		for ( dim_t j = plan_cache_len; j > 0; --j )
+			plan_cache[ j ] = plan_cache[ j - 1 ];
+
+		plan_cache[ 0 ] = plan;
+		plan_cache_len += 1;
+	}
+
+	bli_pthread_mutex_unlock( &plan_cache_mutex );
+
+	if ( evict != NULL ) bli_l3_plan_free( evict );
+}
+
+void bli_l3_plan_thread_init
+     (
+       l3plan_t*   plan,
+       dim_t       tid,
+       opid_t      family,
+       pack_t      schema_a,
+       pack_t      schema_b,
+       obj_t*      a,
+       obj_t*      b,
+       obj_t*      c,
+       rntm_t*     rntm,
+       cntl_t**    cntl_use,
+       thrinfo_t** thread
+     )
+{
+	// The first time a thread runs with this plan, it creates its control
+	// tree and the root of its thrinfo_t tree, exactly as it would without
+	// a plan. The rntm_t must already refer to the thread's pool within the
+	// plan's array_t.
+	if ( plan->cntl[ tid ] == NULL )
+	{
+		bli_l3_cntl_create_if( family, schema_a, schema_b,
+		                       a, b, c, rntm, NULL, &plan->cntl[ tid ] );
+
+		bli_l3_thrinfo_create_root( tid, plan->gl_comm, rntm,
+		                            plan->cntl[ tid ], &plan->thread[ tid ] );
+	}
+
+	*cntl_use = plan->cntl[ tid ];
+	*thread   = plan->thread[ tid ];
+}
+
+array_t* bli_l3_plan_array( l3plan_t* plan )
+{
+	return plan->array;
+}
+
+thrcomm_t* bli_l3_plan_gl_comm( l3plan_t* plan )
+{
+	return plan->gl_comm;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_l3_plan_invalidate( void )
+{
+	l3plan_t* evict[ BLIS_L3_PLAN_CACHE_SIZE + 1 ];
+	dim_t     n_evict;
+
+	bli_pthread_mutex_lock( &plan_cache_mutex );
+
+	// Plans that are checked out right now are freed when they are checked
+	// back in, since their generation no longer matches.
+	plan_cache_gen += 1;
+
+	n_evict = plan_cache_len;
+	for ( dim_t i = 0; i < n_evict; ++i ) evict[ i ] = plan_cache[ i ];
+	plan_cache_len = 0;
+
+	bli_pthread_mutex_unlock( &plan_cache_mutex );
+
+	for ( dim_t i = 0; i < n_evict; ++i ) bli_l3_plan_free( evict[ i ] );
+}
+
+void bli_l3_plan_finalize( void )
+{
+	bli_l3_plan_invalidate();
+}
+
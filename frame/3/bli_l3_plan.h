@@ -0,0 +1,95 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Execution plans for the conventional level-3 code path.
+//
+// A plan bundles everything a thread team needs before it can enter the
+// level-3 algorithmic function stack: the small block allocator array from
+// which the team allocates its nodes, the global communicator, and each
+// thread's control tree and thrinfo_t tree (the latter of which is grown
+// lazily during the first execution). Rather than being freed at the end
+// of a call, plans are kept in a small cache keyed by the operation family,
+// the pack schemas, the side (for trsm), the thread count and the ways of
+// parallelism, and are handed to the next call with the same key. Cached
+// control trees also retain their pack buffers between calls.
+//
+// The cache is flushed whenever the global number of threads or ways of
+// parallelism are changed, and when BLIS is finalized.
+//
+
+// The maximum number of idle plans kept in the cache. A value of 0
+// disables caching.
+#ifndef BLIS_L3_PLAN_CACHE_SIZE
+#define BLIS_L3_PLAN_CACHE_SIZE 4
+#endif
+
+typedef struct l3plan_s l3plan_t;
+
+l3plan_t* bli_l3_plan_checkout
+     (
+       opid_t  family,
+       pack_t  schema_a,
+       pack_t  schema_b,
+       obj_t*  a,
+       rntm_t* rntm,
+       cntl_t* cntl
+     );
+
+void bli_l3_plan_checkin
+     (
+       l3plan_t* plan
+     );
+
+void bli_l3_plan_thread_init
+     (
+       l3plan_t*   plan,
+       dim_t       tid,
+       opid_t      family,
+       pack_t      schema_a,
+       pack_t      schema_b,
+       obj_t*      a,
+       obj_t*      b,
+       obj_t*      c,
+       rntm_t*     rntm,
+       cntl_t**    cntl_use,
+       thrinfo_t** thread
+     );
+
+array_t*   bli_l3_plan_array( l3plan_t* plan );
+thrcomm_t* bli_l3_plan_gl_comm( l3plan_t* plan );
+
+void bli_l3_plan_invalidate( void );
+void bli_l3_plan_finalize( void );
+
@@ -34,6 +34,48 @@
 
 #include "blis.h"
 
+// Return whether a gemm problem that exceeds the sup thresholds should still
+// be computed by the sup handler, which uses A and B in place unless it
+// decides to pack them. This is the case when all operands are stored by
+// rows (or all by columns), so that the sup kernels (after transposing the
+// problem if needed) stream the micropanels of A and B with unit stride, and
+// the matrix that the kernels read as B fits in the L2 cache, so that it need
+// not be packed to be reused. Packing in the conventional path would
+// otherwise read and write all of A. The m x k matrix that the kernels
+// stream as A must also fit in the L3 cache. Beyond that, the tuned sup
+// thresholds, which favor the conventional path for large m, are kept.
+static bool bli_gemmsup_nopack_is_preferred
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       stor3_t stor_id,
+       cntx_t* cntx
+     )
+{
+	const num_t dt = bli_obj_dt( c );
+
+	if ( !bli_is_real( dt ) ) return FALSE;
+
+	if ( stor_id != BLIS_RRR && stor_id != BLIS_CCC ) return FALSE;
+
+	// If the kernels prefer the storage of C, the problem is computed as-is
+	// and they read B as B. Otherwise, it is transposed and they read A^T.
+	const bool   as_is = bli_cntx_l3_sup_ker_prefers_rows_dt( dt, stor_id, cntx ) ==
+	                     ( stor_id == BLIS_RRR );
+	obj_t*       x     = ( as_is ? b : a );
+	obj_t*       y     = ( as_is ? a : b );
+	const siz_t  x_siz = ( siz_t )bli_obj_length( x ) * bli_obj_width( x ) *
+	                     bli_dt_size( dt );
+	const siz_t  y_siz = ( siz_t )bli_obj_length( y ) * bli_obj_width( y ) *
+	                     bli_dt_size( dt );
+	const dim_t  l2    = bli_cache_query_size( 2 );
+	const dim_t  l3    = bli_cache_query_size( 3 );
+
+	return ( 0 < l2 && x_siz <= ( siz_t )l2 &&
+	         0 < l3 && y_siz <= ( siz_t )l3 );
+}
+
 err_t bli_gemmsup
      (
        obj_t*  alpha,
@@ -120,8 +162,10 @@ err_t bli_gemmsup
         thresh_func_ft func_fp;
         func_fp = bli_cntx_get_l3_thresh_func(BLIS_GEMM, cntx);
 
-        // Return early if the sizes are beyond SUP thresholds
-        if ( !func_fp( a, b, c, cntx ) )
+        // Return early if the sizes are beyond SUP thresholds, unless the
+        // operands can be used without packing them.
+        if ( !func_fp( a, b, c, cntx ) &&
+             !bli_gemmsup_nopack_is_preferred( a, b, c, stor_id, cntx ) )
         {
             AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2,
                             "SUP - Sizes are beyond SUP thresholds.");
@@ -133,8 +177,10 @@ err_t bli_gemmsup
 
     func_fp = bli_cntx_get_l3_thresh_func(BLIS_GEMM, cntx);
 
-    // Return early if the sizes are beyond SUP thresholds
-        if ( !func_fp( a, b, c, cntx ) ) {
+    // Return early if the sizes are beyond SUP thresholds, unless the
+    // operands can be used without packing them.
+        if ( !func_fp( a, b, c, cntx ) &&
+             !bli_gemmsup_nopack_is_preferred( a, b, c, stor_id, cntx ) ) {
             AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "SUP - Sizes are beyond SUP thresholds.");
             return BLIS_FAILURE;
     }
@@ -428,3 +474,81 @@ printf( "dims: %d %d %d (threshs: %d %d %d)\n",
     AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
     return ret_gemmtsup_fp;
 }
+
+err_t bli_hemmsup
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+    AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
+
+    // Return early if small matrix handling is disabled at configure-time.
+    #ifdef BLIS_DISABLE_SUP_HANDLING
+    AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "SUP is Disabled.");
+    return BLIS_FAILURE;
+    #endif
+
+    // Return early if this is a mixed-datatype computation.
+    if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
+	 bli_obj_dt( c ) != bli_obj_dt( b ) ||
+	 bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) {
+	AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "SUP doesn't support Mixed datatypes.");
+	return BLIS_FAILURE;
+    }
+
+    if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+    // Symmetric/Hermitian A is multiplied from the left or the right. The
+    // sup kernels read their operands in place, so the unstored triangle of
+    // A must exist in memory. We therefore only take this path if the
+    // equivalent gemm problem meets the gemm sup thresholds; at those sizes
+    // forming a dense copy of A costs O(m^2) against the O(m^2 n) product
+    // and avoids the structured packing of the native path.
+    obj_t* a_gemm = ( bli_is_left( side ) ? a : b );
+    obj_t* b_gemm = ( bli_is_left( side ) ? b : a );
+
+    thresh_func_ft func_fp = bli_cntx_get_l3_thresh_func( BLIS_GEMM, cntx );
+    if ( !func_fp( a_gemm, b_gemm, c, cntx ) )
+    {
+	AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "SUP - Sizes are beyond SUP thresholds.");
+	return BLIS_FAILURE;
+    }
+
+    // Create a dense copy of A, applying any conjugation, and then
+    // reflect its stored triangle into the unstored triangle.
+    const num_t dt = bli_obj_dt( a );
+    const dim_t m  = bli_obj_length( a );
+    obj_t       a_dense;
+
+    bli_obj_create( dt, m, m, 0, 0, &a_dense );
+
+    bli_copym( a, &a_dense );
+
+    bli_obj_set_struc( bli_obj_struc( a ), &a_dense );
+    bli_obj_set_uplo( bli_obj_uplo( a ), &a_dense );
+
+    if ( bli_obj_is_hermitian( a ) ) bli_mkherm( &a_dense );
+    else                             bli_mksymm( &a_dense );
+
+    bli_obj_set_struc( BLIS_GENERAL, &a_dense );
+    bli_obj_set_uplo( BLIS_DENSE, &a_dense );
+
+    err_t r_val;
+
+    if ( bli_is_left( side ) )
+        r_val = bli_gemmsup( alpha, &a_dense, b, beta, c, cntx, rntm );
+    else
+        r_val = bli_gemmsup( alpha, b, &a_dense, beta, c, cntx, rntm );
+
+    bli_obj_free( &a_dense );
+
+    AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+    return r_val;
+}
@@ -64,3 +64,15 @@ err_t bli_syrksup
        rntm_t* rntm
      );
 
+
+err_t bli_hemmsup
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
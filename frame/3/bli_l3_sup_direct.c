@@ -0,0 +1,164 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Define typed sup entry points that skip the object API. They implement
+// the unpacked, single-threaded instance of bli_gemmsup_ref_var2m() for
+// problems no larger than BLIS_GEMMSUP_DIRECT_MAX_DIM in any dimension:
+// after the same storage-based transposition performed by bli_gemmsup_int(),
+// the millikernel is invoked once per NR-wide panel of C with the whole of
+// m and k.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+err_t PASTEMAC(ch,opname) \
+     ( \
+       conj_t           conja, \
+       conj_t           conjb, \
+       dim_t            m, \
+       dim_t            n, \
+       dim_t            k, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict b, inc_t rs_b, inc_t cs_b, \
+       ctype*  restrict beta, \
+       ctype*  restrict c, inc_t rs_c, inc_t cs_c, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	if ( m > BLIS_GEMMSUP_DIRECT_MAX_DIM || \
+	     n > BLIS_GEMMSUP_DIRECT_MAX_DIM || \
+	     k > BLIS_GEMMSUP_DIRECT_MAX_DIM ) return BLIS_FAILURE; \
+\
+	stor3_t stor_id = bli_stor3_from_strides( rs_c, cs_c, \
+	                                          rs_a, cs_a, rs_b, cs_b ); \
+\
+	/* Like the sup handler, don't handle general stride. */ \
+	if ( stor_id == BLIS_XXX ) return BLIS_FAILURE; \
+\
+	/* If m or n is zero, return immediately. */ \
+	if ( bli_zero_dim2( m, n ) ) return BLIS_SUCCESS; \
+\
+	/* If k < 1 or alpha is zero, scale by beta and return. */ \
+	if ( k < 1 || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC(ch,scalm) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  0, \
+		  BLIS_NONUNIT_DIAG, \
+		  BLIS_DENSE, \
+		  m, n, \
+		  beta, \
+		  c, rs_c, cs_c \
+		); \
+		return BLIS_SUCCESS; \
+	} \
+\
+	/* Transpose the operation for the storage cases that bli_gemmsup_int()
+	   transposes, so that C is accessed the way the millikernels prefer. */ \
+	if ( !( stor_id == BLIS_RRR || stor_id == BLIS_RRC || \
+	        stor_id == BLIS_RCR || stor_id == BLIS_CRR ) ) \
+	{ \
+		ctype* restrict t = a; a = b; b = t; \
+		conj_t conjt = conja; conja = conjb; conjb = conjt; \
+		bli_swap_dims( &m, &n ); \
+\
+		inc_t rs_t = cs_b, cs_t = rs_b; \
+		rs_b = cs_a; cs_b = rs_a; \
+		rs_a = rs_t; cs_a = cs_t; \
+		bli_swap_incs( &rs_c, &cs_c ); \
+\
+		stor_id = bli_stor3_trans( stor_id ); \
+	} \
+\
+	/* Only row-preferential millikernels are supported by var2m. */ \
+	if ( !bli_cntx_l3_sup_ker_prefers_rows_dt( dt, stor_id, cntx ) ) \
+		return BLIS_FAILURE; \
+\
+	PASTECH(ch,gemmsup_ker_ft) \
+	        gemmsup_ker = bli_cntx_get_l3_sup_ker_dt( dt, stor_id, cntx ); \
+\
+	const dim_t MR  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t NRM = bli_cntx_get_l3_sup_blksz_max_dt( dt, BLIS_NR, cntx ); \
+	const dim_t NRE = NRM - NR; \
+\
+	/* The millikernel walks the micropanels of the unpacked A itself. */ \
+	auxinfo_t aux; \
+	bli_auxinfo_set_ps_a( MR * rs_a, &aux ); \
+\
+	dim_t jr_iter = ( n + NR - 1 ) / NR; \
+	dim_t jr_left =   n % NR; \
+\
+	/* Allow the last iteration to contain up to NRE extra columns, as
+	   var2m does when B is not packed. */ \
+	if ( NRE != 0 && 1 < jr_iter && jr_left != 0 && jr_left <= NRE ) \
+	{ \
+		jr_iter--; jr_left += NR; \
+	} \
+\
+	for ( dim_t j = 0; j < jr_iter; j += 1 ) \
+	{ \
+		const dim_t nr_cur = ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left ); \
+\
+		gemmsup_ker \
+		( \
+		  conja, \
+		  conjb, \
+		  m, \
+		  nr_cur, \
+		  k, \
+		  alpha, \
+		  a,                 rs_a, cs_a, \
+		  b + j * NR * cs_b, rs_b, cs_b, \
+		  beta, \
+		  c + j * NR * cs_c, rs_c, cs_c, \
+		  &aux, \
+		  cntx  \
+		); \
+	} \
+\
+	return BLIS_SUCCESS; \
+}
+
+INSERT_GENTFUNC_BASIC0( gemmsup_direct )
+
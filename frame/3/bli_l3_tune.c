@@ -0,0 +1,461 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#ifdef _MSC_VER
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// The state of a table entry. An entry's key is written before its state
+// leaves BLIS_L3_TUNE_EMPTY, and its winner before its state becomes
+// BLIS_L3_TUNE_DECIDED, so readers that observe the state with acquire
+// semantics may read those fields without holding the lock.
+#define BLIS_L3_TUNE_EMPTY    0
+#define BLIS_L3_TUNE_TRIAL    1
+#define BLIS_L3_TUNE_DECIDED  2
+
+// The number of consecutive slots examined when looking up a shape.
+#define BLIS_L3_TUNE_MAX_PROBE 16
+
+struct l3tune_entry_s
+{
+	// The shape under which the decision is recorded.
+	opid_t   family;
+	num_t    dt;
+	trans_t  transa;
+	trans_t  transb;
+	dim_t    m;
+	dim_t    n;
+	dim_t    k;
+	dim_t    n_threads;
+
+	int      state;
+	l3tune_t winner;
+
+	// Trial bookkeeping, guarded by tune_mutex: the number of calls handed
+	// out and completed with each strategy, and the fastest of the latter.
+	dim_t    n_issued[ BLIS_L3_TUNE_NUM_STRATS ];
+	dim_t    n_done[ BLIS_L3_TUNE_NUM_STRATS ];
+	double   best[ BLIS_L3_TUNE_NUM_STRATS ];
+	bool     eligible[ BLIS_L3_TUNE_NUM_STRATS ];
+};
+
+static l3tune_entry_t tune_table[ BLIS_L3_TUNE_TABLE_SIZE ];
+
+static bool  tune_enabled = FALSE;
+static char* tune_file    = NULL;
+
+static bli_pthread_mutex_t tune_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+static bli_pthread_once_t  tune_once  = BLIS_PTHREAD_ONCE_INIT;
+
+static const char* tune_strat_names[ BLIS_L3_TUNE_NUM_STRATS ] =
+{
+	"small",
+	"sup",
+	"sup_packed",
+	"native",
+};
+
+// -----------------------------------------------------------------------------
+
+static guint_t bli_l3_tune_hash
+     (
+       opid_t  family,
+       num_t   dt,
+       trans_t transa,
+       trans_t transb,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       dim_t   n_threads
+     )
+{
+	const uint64_t fields[] = { family, dt, transa, transb, m, n, k, n_threads };
+	const dim_t    n_fields = sizeof( fields ) / sizeof( fields[ 0 ] );
+	uint64_t       h        = 0xcbf29ce484222325ULL;
+
+	for ( dim_t i = 0; i < n_fields; ++i )
+	{
+		h ^= fields[ i ];
+		h *= 0x100000001b3ULL;
+		h ^= h >> 29;
+	}
+
+	return ( guint_t )h;
+}
+
+static bool bli_l3_tune_matches
+     (
+       l3tune_entry_t* e,
+       opid_t          family,
+       num_t           dt,
+       trans_t         transa,
+       trans_t         transb,
+       dim_t           m,
+       dim_t           n,
+       dim_t           k,
+       dim_t           n_threads
+     )
+{
+	return e->family == family && e->dt == dt &&
+	       e->transa == transa && e->transb == transb &&
+	       e->m == m && e->n == n && e->k == k &&
+	       e->n_threads == n_threads;
+}
+
+// Find the entry for a shape, inserting it with the given state if it is not
+// present. Returns NULL if the shape is absent and cannot be inserted. Must
+// be called with tune_mutex held.
+static l3tune_entry_t* bli_l3_tune_find_or_insert
+     (
+       opid_t  family,
+       num_t   dt,
+       trans_t transa,
+       trans_t transb,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       dim_t   n_threads,
+       int     state
+     )
+{
+	const guint_t h = bli_l3_tune_hash( family, dt, transa, transb,
+	                                    m, n, k, n_threads );
+
+	for ( dim_t p = 0; p < BLIS_L3_TUNE_MAX_PROBE; ++p )
+	{
+		l3tune_entry_t* e = &tune_table[ ( h + p ) % BLIS_L3_TUNE_TABLE_SIZE ];
+
+		if ( e->state == BLIS_L3_TUNE_EMPTY )
+		{
+			e->family    = family;
+			e->dt        = dt;
+			e->transa    = transa;
+			e->transb    = transb;
+			e->m         = m;
+			e->n         = n;
+			e->k         = k;
+			e->n_threads = n_threads;
+			e->winner    = BLIS_L3_TUNE_DEFAULT;
+
+			for ( dim_t s = 0; s < BLIS_L3_TUNE_NUM_STRATS; ++s )
+			{
+				e->n_issued[ s ] = 0;
+				e->n_done[ s ]   = 0;
+				e->best[ s ]     = DBL_MAX;
+				e->eligible[ s ] = TRUE;
+			}
+
+			__atomic_store_n( &e->state, state, __ATOMIC_RELEASE );
+
+			return e;
+		}
+
+		if ( bli_l3_tune_matches( e, family, dt, transa, transb,
+		                          m, n, k, n_threads ) )
+			return e;
+	}
+
+	return NULL;
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_l3_tune_load( void )
+{
+	FILE* file = fopen( tune_file, "r" );
+
+	if ( file == NULL ) return;
+
+	char line[ 256 ];
+
+	while ( fgets( line, sizeof( line ), file ) != NULL )
+	{
+		char op[ 16 ], strat[ 16 ];
+		char transa_c, transb_c;
+		long m, n, k, n_threads;
+
+		// Each line is "<dt><op> <transa> <transb> <m> <n> <k> <threads>
+		// <strategy>", e.g. "dgemm n t 64 64 256 1 sup". Lines that do not
+		// parse are ignored.
+		if ( sscanf( line, "%15s %c %c %ld %ld %ld %ld %15s", op,
+		             &transa_c, &transb_c, &m, &n, &k, &n_threads, strat ) != 8 )
+			continue;
+
+		if ( strchr( "sdcz", op[ 0 ] ) == NULL || strcmp( op + 1, "gemm" ) != 0 ||
+		     strchr( "ntch", transa_c ) == NULL ||
+		     strchr( "ntch", transb_c ) == NULL )
+			continue;
+
+		l3tune_t winner = BLIS_L3_TUNE_DEFAULT;
+
+		for ( dim_t s = 0; s < BLIS_L3_TUNE_NUM_STRATS; ++s )
+			if ( strcmp( strat, tune_strat_names[ s ] ) == 0 ) winner = s;
+
+		if ( winner == BLIS_L3_TUNE_DEFAULT ) continue;
+
+		num_t   dt;
+		trans_t transa, transb;
+
+		bli_param_map_char_to_blis_dt( op[ 0 ], &dt );
+		bli_param_map_char_to_blis_trans( transa_c, &transa );
+		bli_param_map_char_to_blis_trans( transb_c, &transb );
+
+		l3tune_entry_t* e = bli_l3_tune_find_or_insert
+		(
+		  BLIS_GEMM, dt, transa, transb, m, n, k, n_threads,
+		  BLIS_L3_TUNE_TRIAL
+		);
+
+		if ( e == NULL ) continue;
+
+		e->winner = winner;
+		__atomic_store_n( &e->state, BLIS_L3_TUNE_DECIDED, __ATOMIC_RELEASE );
+	}
+
+	fclose( file );
+}
+
+// Append the decision recorded in e to the tuning file. e is a copy taken
+// under tune_mutex, so the file is written without holding the lock. Each
+// record is appended with a single write() to a descriptor opened with
+// O_APPEND, so records saved concurrently, by this or another process, are
+// not interleaved.
+static void bli_l3_tune_save( const l3tune_entry_t* e )
+{
+	if ( tune_file == NULL || e->family != BLIS_GEMM ||
+	     e->winner == BLIS_L3_TUNE_DEFAULT ) return;
+
+	char dt_c, transa_c, transb_c;
+	char line[ 256 ];
+
+	bli_param_map_blis_to_char_dt( e->dt, &dt_c );
+	bli_param_map_blis_to_char_trans( e->transa, &transa_c );
+	bli_param_map_blis_to_char_trans( e->transb, &transb_c );
+
+	const int len = snprintf( line, sizeof( line ),
+	                          "%cgemm %c %c %ld %ld %ld %ld %s\n", dt_c,
+	                          transa_c, transb_c, ( long )e->m, ( long )e->n,
+	                          ( long )e->k, ( long )e->n_threads,
+	                          tune_strat_names[ e->winner ] );
+
+	if ( len <= 0 || len >= ( int )sizeof( line ) ) return;
+
+#ifdef _MSC_VER
+	const int fd = _open( tune_file, _O_WRONLY | _O_APPEND | _O_CREAT,
+	                      _S_IREAD | _S_IWRITE );
+
+	if ( fd < 0 ) return;
+
+	( void )_write( fd, line, len );
+
+	_close( fd );
+#else
+	const int fd = open( tune_file, O_WRONLY | O_APPEND | O_CREAT, 0644 );
+
+	if ( fd < 0 ) return;
+
+	const ssize_t n_written = write( fd, line, len );
+	( void )n_written;
+
+	close( fd );
+#endif
+}
+
+static void bli_l3_tune_init_once( void )
+{
+	tune_enabled = ( bli_env_get_var( "BLIS_AUTOTUNE", 0 ) != 0 );
+
+	if ( !tune_enabled ) return;
+
+	tune_file = getenv( "BLIS_AUTOTUNE_FILE" );
+
+	if ( tune_file != NULL && tune_file[ 0 ] == '\0' ) tune_file = NULL;
+
+	if ( tune_file != NULL ) bli_l3_tune_load();
+}
+
+bool bli_l3_tune_is_enabled( void )
+{
+	bli_pthread_once( &tune_once, bli_l3_tune_init_once );
+
+	return tune_enabled;
+}
+
+// -----------------------------------------------------------------------------
+
+l3tune_t bli_l3_tune_query
+     (
+       opid_t           family,
+       num_t            dt,
+       trans_t          transa,
+       trans_t          transb,
+       dim_t            m,
+       dim_t            n,
+       dim_t            k,
+       dim_t            n_threads,
+       l3tune_entry_t** trial
+     )
+{
+	*trial = NULL;
+
+	if ( !bli_l3_tune_is_enabled() ) return BLIS_L3_TUNE_DEFAULT;
+
+	// Look for a decided entry without taking the lock. This is the common
+	// case once a recurring shape has been tuned.
+	const guint_t h = bli_l3_tune_hash( family, dt, transa, transb,
+	                                    m, n, k, n_threads );
+
+	for ( dim_t p = 0; p < BLIS_L3_TUNE_MAX_PROBE; ++p )
+	{
+		l3tune_entry_t* e = &tune_table[ ( h + p ) % BLIS_L3_TUNE_TABLE_SIZE ];
+
+		const int state = __atomic_load_n( &e->state, __ATOMIC_ACQUIRE );
+
+		if ( state == BLIS_L3_TUNE_EMPTY ) break;
+
+		if ( bli_l3_tune_matches( e, family, dt, transa, transb,
+		                          m, n, k, n_threads ) )
+		{
+			if ( state == BLIS_L3_TUNE_DECIDED ) return e->winner;
+			break;
+		}
+	}
+
+	// The shape is new or still being tuned. Hand out the eligible strategy
+	// that has been tried the fewest times so far.
+	l3tune_t strat = BLIS_L3_TUNE_DEFAULT;
+
+	bli_pthread_mutex_lock( &tune_mutex );
+
+	l3tune_entry_t* e = bli_l3_tune_find_or_insert
+	(
+	  family, dt, transa, transb, m, n, k, n_threads, BLIS_L3_TUNE_TRIAL
+	);
+
+	if ( e != NULL )
+	{
+		if ( e->state == BLIS_L3_TUNE_DECIDED )
+		{
+			strat = e->winner;
+		}
+		else
+		{
+			for ( dim_t s = 0; s < BLIS_L3_TUNE_NUM_STRATS; ++s )
+			{
+				if ( !e->eligible[ s ] ) continue;
+				if ( strat == BLIS_L3_TUNE_DEFAULT ||
+				     e->n_issued[ s ] < e->n_issued[ strat ] ) strat = s;
+			}
+
+			if ( strat != BLIS_L3_TUNE_DEFAULT )
+			{
+				e->n_issued[ strat ] += 1;
+				*trial = e;
+			}
+		}
+	}
+
+	bli_pthread_mutex_unlock( &tune_mutex );
+
+	return strat;
+}
+
+void bli_l3_tune_record
+     (
+       l3tune_entry_t* trial,
+       l3tune_t        strat,
+       err_t           status,
+       double          time
+     )
+{
+	if ( trial == NULL ) return;
+
+	l3tune_entry_t* e = trial;
+
+	bli_pthread_mutex_lock( &tune_mutex );
+
+	if ( e->state == BLIS_L3_TUNE_DECIDED )
+	{
+		bli_pthread_mutex_unlock( &tune_mutex );
+		return;
+	}
+
+	// A strategy that declines the shape is never tried again for it.
+	if ( status != BLIS_SUCCESS )
+	{
+		e->eligible[ strat ] = FALSE;
+	}
+	else
+	{
+		e->n_done[ strat ] += 1;
+		e->best[ strat ] = bli_min( e->best[ strat ], time );
+	}
+
+	// Decide once every remaining candidate has completed all of its trials.
+	bool     done   = TRUE;
+	l3tune_t winner = BLIS_L3_TUNE_DEFAULT;
+
+	for ( dim_t s = 0; s < BLIS_L3_TUNE_NUM_STRATS; ++s )
+	{
+		if ( !e->eligible[ s ] ) continue;
+		if ( e->n_done[ s ] < BLIS_L3_TUNE_NUM_TRIALS ) done = FALSE;
+		if ( winner == BLIS_L3_TUNE_DEFAULT ||
+		     e->best[ s ] < e->best[ winner ] ) winner = s;
+	}
+
+	l3tune_entry_t decided;
+
+	if ( done )
+	{
+		e->winner = winner;
+		__atomic_store_n( &e->state, BLIS_L3_TUNE_DECIDED, __ATOMIC_RELEASE );
+
+		decided = *e;
+	}
+
+	bli_pthread_mutex_unlock( &tune_mutex );
+
+	// The decision is final, so it is saved from the copy after the lock is
+	// released; other threads need not wait for the file I/O.
+	if ( done ) bli_l3_tune_save( &decided );
+}
+
@@ -0,0 +1,102 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Online tuning of the level-3 dispatch strategy.
+//
+// When enabled (by setting BLIS_AUTOTUNE=1 in the environment), each
+// distinct (operation, datatype, transa, transb, m, n, k, threads) shape
+// that reaches a tuned entry point is timed with each of the candidate
+// strategies below over its first few calls. Once every candidate has been
+// tried BLIS_L3_TUNE_NUM_TRIALS times, the one with the fastest call is
+// remembered and used for all later calls with that shape. Lookups of
+// decided shapes do not take a lock.
+//
+// If BLIS_AUTOTUNE_FILE names a file, decisions found in it are loaded at
+// initialization and every new decision is appended to it, so that the
+// tuning cost is only paid once across runs.
+//
+
+// The number of shapes that can be tuned. Shapes that do not fit fall back
+// to the built-in heuristics.
+#ifndef BLIS_L3_TUNE_TABLE_SIZE
+#define BLIS_L3_TUNE_TABLE_SIZE 4096
+#endif
+
+// The number of timed calls made with each candidate strategy. The fastest
+// of these is kept, which discounts the first (cold) call.
+#ifndef BLIS_L3_TUNE_NUM_TRIALS
+#define BLIS_L3_TUNE_NUM_TRIALS 3
+#endif
+
+typedef enum
+{
+	// Use the built-in heuristics of the caller.
+	BLIS_L3_TUNE_DEFAULT = -1,
+
+	// Candidate strategies.
+	BLIS_L3_TUNE_SMALL = 0,
+	BLIS_L3_TUNE_SUP,
+	BLIS_L3_TUNE_SUP_PACKED,
+	BLIS_L3_TUNE_NATIVE,
+
+	BLIS_L3_TUNE_NUM_STRATS
+} l3tune_t;
+
+typedef struct l3tune_entry_s l3tune_entry_t;
+
+bool bli_l3_tune_is_enabled( void );
+
+l3tune_t bli_l3_tune_query
+     (
+       opid_t           family,
+       num_t            dt,
+       trans_t          transa,
+       trans_t          transb,
+       dim_t            m,
+       dim_t            n,
+       dim_t            k,
+       dim_t            n_threads,
+       l3tune_entry_t** trial
+     );
+
+void bli_l3_tune_record
+     (
+       l3tune_entry_t* trial,
+       l3tune_t        strat,
+       err_t           status,
+       double          time
+     );
+
@@ -80,3 +80,29 @@ void PASTEMAC(ch,opname) \
        cntx_t*    restrict cntx  \
      );
 
+
+
+// fixed-size batched gemm kernels
+// NOTE: These kernels compute c := beta * c + alpha * a * b for a group of
+// independent m x n x k problems stored in the compact ("batch-in-lanes")
+// layout, in which element (i,j) of every problem in the group occupies one
+// SIMD vector: element (i,p) of a is at a + ( i + p*m )*lanes, element
+// (p,j) of b at b + ( p + j*k )*lanes and element (i,j) of c at
+// c + ( i + j*m )*lanes, where lanes is the number of problems per group
+// (a property of the kernel). Complex elements are stored as a vector of
+// real parts followed by a vector of imaginary parts. All buffers must be
+// aligned to the vector size. When beta is zero, c is not read.
+
+#define GEMM_BATCH_FIXED_KER_PROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t            m, \
+       dim_t            n, \
+       dim_t            k, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, \
+       ctype*  restrict b, \
+       ctype*  restrict beta, \
+       ctype*  restrict c  \
+     );
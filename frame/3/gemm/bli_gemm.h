@@ -34,6 +34,10 @@
 
 #include "bli_gemm_cntl.h"
 #include "bli_gemm_front.h"
+#include "bli_gemm_strassen.h"
+#include "bli_gemm_batch_fixed.h"
+#include "bli_gemm_batch.h"
+#include "bli_gemm_promote.h"
 #include "bli_gemm_int.h"
 
 #include "bli_gemm_var.h"
@@ -0,0 +1,496 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Return TRUE if batch m x n matrices with row and column strides rs and
+// cs, located bs elements apart, tile a single ( batch * m ) x n matrix
+// whose strides describe a valid (non-overlapping) row- or column-stored
+// matrix.
+//
+
+static bool bli_gemm_batch_is_stacked
+     (
+       dim_t m,
+       dim_t n,
+       inc_t rs,
+       inc_t cs,
+       inc_t bs,
+       dim_t batch
+     )
+{
+	if ( rs <= 0 || cs <= 0 || bs != m * rs ) return FALSE;
+
+	if      ( rs == 1 ) return cs >= batch * m;
+	else if ( cs == 1 ) return rs >= n;
+
+	return FALSE;
+}
+
+//
+// Compute the problems with indices in [i_start, i_end), either with the
+// fixed-size kernels or each with the (possibly multithreaded) conventional
+// gemm described by rntm.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       bool    is_small, \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+       dim_t   i_start, \
+       dim_t   i_end, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	if ( is_small ) \
+	{ \
+		PASTEMAC(ch,gemm_batch_fixed_strided) \
+		( \
+		  transa, transb, m, n, k, \
+		  alpha, \
+		  a + i_start * bs_a, rs_a, cs_a, bs_a, \
+		  b + i_start * bs_b, rs_b, cs_b, bs_b, \
+		  beta, \
+		  c + i_start * bs_c, rs_c, cs_c, bs_c, \
+		  i_end - i_start  \
+		); \
+		return; \
+	} \
+\
+	/* The conventional gemm may modify its rntm_t, so give it a copy that
+	   is private to the calling thread. */ \
+	rntm_t rntm_l = *rntm; \
+\
+	for ( dim_t i = i_start; i < i_end; ++i ) \
+	{ \
+		PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+		( \
+		  transa, transb, m, n, k, \
+		  alpha, \
+		  a + i * bs_a, rs_a, cs_a, \
+		  b + i * bs_b, rs_b, cs_b, \
+		  beta, \
+		  c + i * bs_c, rs_c, cs_c, \
+		  cntx, \
+		  &rntm_l  \
+		); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_batch_range )
+
+//
+// Distribute the problems evenly across the thread team, in blocks of bf.
+//
+
+#ifdef BLIS_ENABLE_OPENMP
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       bool    is_small, \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+       dim_t   batch, \
+       dim_t   bf, \
+       dim_t   n_threads, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	if ( n_threads == 1 ) \
+	{ \
+		PASTEMAC(ch,gemm_batch_range) \
+		( \
+		  is_small, transa, transb, m, n, k, \
+		  alpha, a, rs_a, cs_a, bs_a, b, rs_b, cs_b, bs_b, \
+		  beta, c, rs_c, cs_c, bs_c, \
+		  0, batch, cntx, rntm \
+		); \
+		return; \
+	} \
+\
+	_Pragma( "omp parallel num_threads(n_threads)" ) \
+	{ \
+		thrinfo_t thread; \
+		dim_t     i_start; \
+		dim_t     i_end; \
+\
+		thread.n_way   = omp_get_num_threads(); \
+		thread.work_id = omp_get_thread_num(); \
+\
+		bli_thread_range_sub( &thread, batch, bf, FALSE, &i_start, &i_end ); \
+\
+		PASTEMAC(ch,gemm_batch_range) \
+		( \
+		  is_small, transa, transb, m, n, k, \
+		  alpha, a, rs_a, cs_a, bs_a, b, rs_b, cs_b, bs_b, \
+		  beta, c, rs_c, cs_c, bs_c, \
+		  i_start, i_end, cntx, rntm \
+		); \
+	} \
+}
+
+#else
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       bool    is_small, \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+       dim_t   batch, \
+       dim_t   bf, \
+       dim_t   n_threads, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	PASTEMAC(ch,gemm_batch_range) \
+	( \
+	  is_small, transa, transb, m, n, k, \
+	  alpha, a, rs_a, cs_a, bs_a, b, rs_b, cs_b, bs_b, \
+	  beta, c, rs_c, cs_c, bs_c, \
+	  0, batch, cntx, rntm \
+	); \
+}
+
+#endif
+
+INSERT_GENTFUNC_BASIC0( gemm_batch_mt )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+       dim_t   batch  \
+     ) \
+{ \
+	PASTEMAC2(ch,opname,_ex) \
+	( \
+	  transa, transb, m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, bs_a, \
+	  b, rs_b, cs_b, bs_b, \
+	  beta, \
+	  c, rs_c, cs_c, bs_c, \
+	  batch, \
+	  NULL, \
+	  NULL  \
+	); \
+} \
+\
+void PASTEMAC2(ch,opname,_ex) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+       dim_t   batch, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	if ( bli_zero_dim2( m, n ) || batch <= 0 ) return; \
+\
+	/* The global rntm_t does not enable the sup path, which gemm would
+	   otherwise use when it is given a NULL rntm_t, so enable it here. */ \
+	rntm_t rntm_l; \
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); \
+	                      bli_rntm_enable_l3_sup( &rntm_l ); } \
+	else                { rntm_l = *rntm; } \
+\
+	/* The strides of op( a ) and op( b ). */ \
+	inc_t rs_at = rs_a, cs_at = cs_a; \
+	inc_t rs_bt = rs_b, cs_bt = cs_b; \
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_at, &cs_at ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_bt, &cs_bt ); \
+\
+	const bool is_small = ( m <= BLIS_GEMM_BATCH_FIXED_MAX && \
+	                        n <= BLIS_GEMM_BATCH_FIXED_MAX && \
+	                        k <= BLIS_GEMM_BATCH_FIXED_MAX ); \
+\
+	/* If b is shared and the op( a_i ) and c_i are stacked vertically, or
+	   if a is shared and the op( b_i ) and c_i are stacked horizontally,
+	   compute the batch as a single gemm. Small batches are left to the
+	   fixed-size kernels, which are faster still. */ \
+	if ( !is_small && batch > 1 && bs_b == 0 && \
+	     bli_gemm_batch_is_stacked( m, k, rs_at, cs_at, bs_a, batch ) && \
+	     bli_gemm_batch_is_stacked( m, n, rs_c,  cs_c,  bs_c, batch ) ) \
+	{ \
+		PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+		( \
+		  transa, transb, batch * m, n, k, \
+		  alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+		  beta, c, rs_c, cs_c, \
+		  cntx, &rntm_l \
+		); \
+		return; \
+	} \
+	if ( !is_small && batch > 1 && bs_a == 0 && \
+	     bli_gemm_batch_is_stacked( n, k, cs_bt, rs_bt, bs_b, batch ) && \
+	     bli_gemm_batch_is_stacked( n, m, cs_c,  rs_c,  bs_c, batch ) ) \
+	{ \
+		PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+		( \
+		  transa, transb, m, batch * n, k, \
+		  alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+		  beta, c, rs_c, cs_c, \
+		  cntx, &rntm_l \
+		); \
+		return; \
+	} \
+\
+	dim_t nt_total = bli_rntm_num_threads( &rntm_l ); \
+	if ( nt_total < 1 ) nt_total = bli_rntm_calc_num_threads( &rntm_l ); \
+\
+	/* Each thread is given whole groups of BLIS_GEMM_BATCH_FIXED_MAX
+	   problems (a multiple of any kernel's vector length) in the small
+	   case, and at least one problem otherwise. */ \
+	const dim_t bf = ( is_small ? BLIS_GEMM_BATCH_FIXED_MAX : 1 ); \
+	const dim_t n_threads \
+	= \
+	bli_max( 1, bli_min( nt_total, ( batch + bf - 1 ) / bf ) ); \
+\
+	if ( !is_small && n_threads < nt_total ) \
+	{ \
+		/* Too few problems to occupy every thread: parallelize within
+		   each problem instead. */ \
+		PASTEMAC(ch,gemm_batch_range) \
+		( \
+		  FALSE, transa, transb, m, n, k, \
+		  alpha, a, rs_a, cs_a, bs_a, b, rs_b, cs_b, bs_b, \
+		  beta, c, rs_c, cs_c, bs_c, \
+		  0, batch, cntx, &rntm_l \
+		); \
+		return; \
+	} \
+\
+	rntm_t rntm_1 = rntm_l; \
+	bli_rntm_set_num_threads_only( 1, &rntm_1 ); \
+	bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_1 ); \
+\
+	PASTEMAC(ch,gemm_batch_mt) \
+	( \
+	  is_small, transa, transb, m, n, k, \
+	  alpha, a, rs_a, cs_a, bs_a, b, rs_b, cs_b, bs_b, \
+	  beta, c, rs_c, cs_c, bs_c, \
+	  batch, bf, n_threads, cntx, &rntm_1 \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_batch_strided )
+
+//
+// Object API. The typed functions are reached through wrappers that take
+// untyped buffers, so that they can be indexed by datatype.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       void*   alpha, \
+       void*   a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       void*   b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       void*   beta, \
+       void*   c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+       dim_t   batch, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	PASTEMAC(ch,gemm_batch_strided_ex) \
+	( \
+	  transa, transb, m, n, k, \
+	  alpha, a, rs_a, cs_a, bs_a, b, rs_b, cs_b, bs_b, \
+	  beta, c, rs_c, cs_c, bs_c, \
+	  batch, cntx, rntm \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_batch_strided_vp )
+
+typedef void (*FUNCPTR_T)
+     (
+       trans_t transa,
+       trans_t transb,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       void*   alpha,
+       void*   a, inc_t rs_a, inc_t cs_a, inc_t bs_a,
+       void*   b, inc_t rs_b, inc_t cs_b, inc_t bs_b,
+       void*   beta,
+       void*   c, inc_t rs_c, inc_t cs_c, inc_t bs_c,
+       dim_t   batch,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+static FUNCPTR_T GENARRAY(ftypes,gemm_batch_strided_vp);
+
+void bli_gemm_batch_strided
+     (
+       obj_t*  alpha,
+       obj_t*  a, inc_t bs_a,
+       obj_t*  b, inc_t bs_b,
+       obj_t*  beta,
+       obj_t*  c, inc_t bs_c,
+       dim_t   batch
+     )
+{
+	bli_gemm_batch_strided_ex( alpha, a, bs_a, b, bs_b, beta, c, bs_c, batch,
+	                           NULL, NULL );
+}
+
+void bli_gemm_batch_strided_ex
+     (
+       obj_t*  alpha,
+       obj_t*  a, inc_t bs_a,
+       obj_t*  b, inc_t bs_b,
+       obj_t*  beta,
+       obj_t*  c, inc_t bs_c,
+       dim_t   batch,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// If the user provided a NULL cntx_t, query the default one.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// The batch is validated once, through its first problem; the remaining
+	// problems differ from it only in their location.
+	if ( bli_error_checking_is_enabled() )
+	{
+		err_t e_val;
+
+		bli_gemm_check( alpha, a, b, beta, c, cntx );
+
+		e_val = bli_check_consistent_object_datatypes( c, a );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_consistent_object_datatypes( c, b );
+		bli_check_error_code( e_val );
+
+		e_val = ( batch < 0 ? BLIS_NEGATIVE_DIMENSION : BLIS_SUCCESS );
+		bli_check_error_code( e_val );
+	}
+
+	const num_t   dt     = bli_obj_dt( c );
+	const trans_t transa = bli_obj_conjtrans_status( a );
+	const trans_t transb = bli_obj_conjtrans_status( b );
+
+	FUNCPTR_T f = ftypes[ dt ];
+
+	f
+	(
+	  transa,
+	  transb,
+	  bli_obj_length( c ),
+	  bli_obj_width( c ),
+	  bli_obj_width_after_trans( a ),
+	  bli_obj_buffer_for_1x1( dt, alpha ),
+	  bli_obj_buffer_at_off( a ), bli_obj_row_stride( a ), bli_obj_col_stride( a ), bs_a,
+	  bli_obj_buffer_at_off( b ), bli_obj_row_stride( b ), bli_obj_col_stride( b ), bs_b,
+	  bli_obj_buffer_for_1x1( dt, beta ),
+	  bli_obj_buffer_at_off( c ), bli_obj_row_stride( c ), bli_obj_col_stride( c ), bs_c,
+	  batch,
+	  cntx,
+	  rntm
+	);
+}
+
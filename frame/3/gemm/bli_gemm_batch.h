@@ -0,0 +1,117 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Batched gemm with uniform shapes and constant batch strides:
+//
+//   c_i := beta * c_i + alpha * transa( a_i ) * transb( b_i ),
+//
+// for i = 0, ..., batch - 1, where a_i = a + i * bs_a, b_i = b + i * bs_b and
+// c_i = c + i * bs_c. A batch stride of zero shares one operand across the
+// whole batch. The object API describes the first problem of the batch with
+// a, b and c (including any transposition or conjugation of a and b), and
+// the remaining problems with the batch strides.
+//
+// The problems are computed as follows:
+//  - If m, n and k are all at most BLIS_GEMM_BATCH_FIXED_MAX, the batch is
+//    split among the threads and computed with the fixed-size kernels.
+//  - If b (or a) is shared and the a_i and c_i (or b_i and c_i) tile a
+//    single larger matrix, the batch is computed as one gemm, so the shared
+//    operand is packed once instead of once per problem.
+//  - Otherwise, if there are at least as many problems as threads, the
+//    problems are distributed among the threads and each is computed with a
+//    single-threaded gemm; if not, the problems are computed one after
+//    another, each with all of the threads.
+//
+
+BLIS_EXPORT_BLIS void bli_gemm_batch_strided
+     (
+       obj_t*  alpha,
+       obj_t*  a, inc_t bs_a,
+       obj_t*  b, inc_t bs_b,
+       obj_t*  beta,
+       obj_t*  c, inc_t bs_c,
+       dim_t   batch
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_batch_strided_ex
+     (
+       obj_t*  alpha,
+       obj_t*  a, inc_t bs_a,
+       obj_t*  b, inc_t bs_b,
+       obj_t*  beta,
+       obj_t*  c, inc_t bs_c,
+       dim_t   batch,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+       dim_t   batch  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,_ex) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+       dim_t   batch, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_batch_strided )
+
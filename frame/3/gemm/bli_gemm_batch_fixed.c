@@ -0,0 +1,588 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Select the fixed-size kernel, and the number of problems it computes at
+// once, based on the kernel sets compiled into the library and the
+// instruction sets supported by the processor. A NULL kernel means that the
+// problems are computed one at a time.
+//
+
+#if defined(BLIS_KERNELS_ZEN4)
+#define GEMMBF_KER_AVX512( ker, nl ) \
+	if ( bli_cpuid_is_avx512_supported() ) { *lanes = nl; return ker; }
+#else
+#define GEMMBF_KER_AVX512( ker, nl )
+#endif
+
+#if defined(BLIS_KERNELS_ZEN)
+#define GEMMBF_KER_AVX2( ker, nl ) \
+	if ( bli_cpuid_is_avx_supported() ) { *lanes = nl; return ker; }
+#else
+#define GEMMBF_KER_AVX2( ker, nl )
+#endif
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, lavx512, lavx2 ) \
+\
+static PASTECH2(ch,gemm_batch_fixed,_ker_ft) PASTEMAC(ch,opname)( dim_t* lanes ) \
+{ \
+	GEMMBF_KER_AVX512( PASTEMAC(ch,gemm_batch_fixed_zen_int_avx512), lavx512 ) \
+	GEMMBF_KER_AVX2( PASTEMAC(ch,gemm_batch_fixed_zen_int), lavx2 ) \
+\
+	*lanes = 1; \
+	return NULL; \
+}
+
+GENTFUNC( float,    s, gemm_batch_fixed_ker_query, 16, 8 )
+GENTFUNC( double,   d, gemm_batch_fixed_ker_query,  8, 4 )
+GENTFUNC( scomplex, c, gemm_batch_fixed_ker_query, 16, 8 )
+GENTFUNC( dcomplex, z, gemm_batch_fixed_ker_query,  8, 4 )
+
+//
+// Copy element (i,j) of each of the nv m x n matrices x[ v ] into lane v of
+// the compact buffer, conjugating if requested. Lanes nv through lanes - 1
+// are zeroed so that the kernel never computes with uninitialized values.
+// The scatter routine performs the reverse copy for the first nv lanes. Both
+// visit one problem at a time, so that each x[ v ] is traversed in storage
+// order while the compact buffer, which is at most a few tens of KB, stays
+// in the L1 cache.
+//
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       bool              conjx, \
+       dim_t             m, \
+       dim_t             n, \
+       ctype**           x, inc_t rs_x, inc_t cs_x, \
+       dim_t             nv, \
+       dim_t             lanes, \
+       ctype_r* restrict buf  \
+     ) \
+{ \
+	const bool  is_cplx = bli_is_complex( PASTEMAC(ch,type) ); \
+	const dim_t es      = ( is_cplx ? 2 : 1 ) * lanes; \
+\
+	for ( dim_t v = 0; v < nv; ++v ) \
+	{ \
+		ctype*   restrict xv = x[ v ]; \
+		ctype_r* restrict bv = buf + v; \
+\
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			ctype_r xr, xi; \
+\
+			PASTEMAC(ch,gets)( xv[ i * rs_x + j * cs_x ], xr, xi ); \
+\
+			bv[ ( i + j * m ) * es ] = xr; \
+			if ( is_cplx ) bv[ ( i + j * m ) * es + lanes ] = ( conjx ? -xi : xi ); \
+		} \
+	} \
+\
+	if ( nv < lanes ) \
+	for ( dim_t ij = 0; ij < m * n; ++ij ) \
+	for ( dim_t v = nv; v < lanes; ++v ) \
+	{ \
+		buf[ ij * es + v ] = 0; \
+		if ( is_cplx ) buf[ ij * es + lanes + v ] = 0; \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( gemmbf_gather )
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t             m, \
+       dim_t             n, \
+       ctype_r* restrict buf, \
+       dim_t             nv, \
+       dim_t             lanes, \
+       ctype**           x, inc_t rs_x, inc_t cs_x  \
+     ) \
+{ \
+	const bool  is_cplx = bli_is_complex( PASTEMAC(ch,type) ); \
+	const dim_t es      = ( is_cplx ? 2 : 1 ) * lanes; \
+\
+	for ( dim_t v = 0; v < nv; ++v ) \
+	{ \
+		ctype*   restrict xv = x[ v ]; \
+		ctype_r* restrict bv = buf + v; \
+\
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,sets) \
+			( \
+			  bv[ ( i + j * m ) * es ], \
+			  ( is_cplx ? bv[ ( i + j * m ) * es + lanes ] : 0 ), \
+			  xv[ i * rs_x + j * cs_x ] \
+			); \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( gemmbf_scatter )
+
+//
+// Compute one group of problems in the compact layout one lane at a time.
+// This is used for groups that the fixed-size kernels cannot handle: when
+// no kernel is available, when m, n or k exceeds BLIS_GEMM_BATCH_FIXED_MAX,
+// or when a caller-provided compact buffer is not suitably aligned.
+//
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t             m, \
+       dim_t             n, \
+       dim_t             k, \
+       ctype*            alpha, \
+       ctype_r* restrict a, \
+       ctype_r* restrict b, \
+       ctype*            beta, \
+       ctype_r* restrict c, \
+       dim_t             lanes  \
+     ) \
+{ \
+	const bool  is_cplx = bli_is_complex( PASTEMAC(ch,type) ); \
+	const dim_t es      = ( is_cplx ? 2 : 1 ) * lanes; \
+	const bool  beta0   = PASTEMAC(ch,eq0)( *beta ); \
+\
+	ctype_r alpha_r, alpha_i, beta_r, beta_i; \
+	PASTEMAC(ch,gets)( *alpha, alpha_r, alpha_i ); \
+	PASTEMAC(ch,gets)( *beta,  beta_r,  beta_i  ); \
+\
+	for ( dim_t j = 0; j < n; ++j ) \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ctype_r* restrict cij = c + ( i + j * m ) * es; \
+\
+		for ( dim_t v = 0; v < lanes; ++v ) \
+		{ \
+			ctype_r sr = 0, si = 0; \
+\
+			for ( dim_t p = 0; p < k; ++p ) \
+			{ \
+				const ctype_r* aip = a + ( i + p * m ) * es; \
+				const ctype_r* bpj = b + ( p + j * k ) * es; \
+				const ctype_r  ar  = aip[ v ]; \
+				const ctype_r  br  = bpj[ v ]; \
+				const ctype_r  ai  = ( is_cplx ? aip[ lanes + v ] : 0 ); \
+				const ctype_r  bi  = ( is_cplx ? bpj[ lanes + v ] : 0 ); \
+\
+				sr += ar * br - ai * bi; \
+				si += ar * bi + ai * br; \
+			} \
+\
+			ctype_r tr = alpha_r * sr - alpha_i * si; \
+			ctype_r ti = alpha_r * si + alpha_i * sr; \
+\
+			if ( !beta0 ) \
+			{ \
+				const ctype_r yr = cij[ v ]; \
+				const ctype_r yi = ( is_cplx ? cij[ lanes + v ] : 0 ); \
+\
+				tr += beta_r * yr - beta_i * yi; \
+				ti += beta_r * yi + beta_i * yr; \
+			} \
+\
+			cij[ v ] = tr; \
+			if ( is_cplx ) cij[ lanes + v ] = ti; \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( gemmbf_compact_ref )
+
+//
+// The engine shared by both addressing schemes. Problem i is located at
+// a_array[ i ] if a_array is non-NULL, and at a + i * bs_a otherwise (and
+// likewise for b and c).
+//
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype** a_array, ctype* a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       ctype** b_array, ctype* b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       ctype*  beta, \
+       ctype** c_array, ctype* c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+       dim_t   batch  \
+     ) \
+{ \
+	if ( m == 0 || n == 0 || batch == 0 ) return; \
+\
+	dim_t lanes; \
+	PASTECH2(ch,gemm_batch_fixed,_ker_ft) ker \
+	= \
+	PASTEMAC(ch,gemm_batch_fixed_ker_query)( &lanes ); \
+\
+	/* Problems that are too large for the fixed-size kernels, or that
+	   arrive when no kernel is available, are computed one at a time. */ \
+	if ( ker == NULL || m > BLIS_GEMM_BATCH_FIXED_MAX || \
+	     n > BLIS_GEMM_BATCH_FIXED_MAX || k > BLIS_GEMM_BATCH_FIXED_MAX ) \
+	{ \
+		for ( dim_t i = 0; i < batch; ++i ) \
+		{ \
+			PASTEMAC(ch,gemm) \
+			( \
+			  transa, transb, m, n, k, \
+			  alpha, \
+			  ( a_array ? a_array[ i ] : a + i * bs_a ), rs_a, cs_a, \
+			  ( b_array ? b_array[ i ] : b + i * bs_b ), rs_b, cs_b, \
+			  beta, \
+			  ( c_array ? c_array[ i ] : c + i * bs_c ), rs_c, cs_c  \
+			); \
+		} \
+		return; \
+	} \
+\
+	/* Absorb the transpositions into the strides, so that the gather
+	   routines read op( a ) and op( b ) directly. */ \
+	const bool conja = bli_does_conj( transa ); \
+	const bool conjb = bli_does_conj( transb ); \
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b ); \
+\
+	/* When alpha is zero, a and b are not referenced and c is only
+	   scaled by beta. When beta is zero, c is not read. */ \
+	const dim_t k_use   = ( PASTEMAC(ch,eq0)( *alpha ) ? 0 : k ); \
+	const bool  beta_nz = !PASTEMAC(ch,eq0)( *beta ); \
+\
+	/* Acquire the compact operand buffers from the pool of A blocks.
+	   Each buffer is a whole number of vectors long, so the b and c
+	   buffers inherit the alignment of the pool block. */ \
+	const dim_t es     = ( bli_is_complex( PASTEMAC(ch,type) ) ? 2 : 1 ) * lanes; \
+	const siz_t size_a = m * k * es * sizeof( ctype_r ); \
+	const siz_t size_b = k * n * es * sizeof( ctype_r ); \
+	const siz_t size_c = m * n * es * sizeof( ctype_r ); \
+\
+	rntm_t rntm; \
+	mem_t  mem; \
+	bli_rntm_init_from_global( &rntm ); \
+	bli_rntm_set_num_threads_only( 1, &rntm ); \
+	bli_membrk_rntm_set_membrk( &rntm ); \
+	bli_membrk_acquire_m \
+	( \
+	  &rntm, size_a + size_b + size_c, \
+	  BLIS_BITVAL_BUFFER_FOR_A_BLOCK, &mem \
+	); \
+\
+	ctype_r* a_c = bli_mem_buffer( &mem ); \
+	ctype_r* b_c = ( ctype_r* )( ( char* )a_c + size_a ); \
+	ctype_r* c_c = ( ctype_r* )( ( char* )b_c + size_b ); \
+\
+	ctype* ap[ 64 / sizeof( ctype_r ) ]; \
+	ctype* bp[ 64 / sizeof( ctype_r ) ]; \
+	ctype* cp[ 64 / sizeof( ctype_r ) ]; \
+\
+	for ( dim_t i0 = 0; i0 < batch; i0 += lanes ) \
+	{ \
+		const dim_t nv = bli_min( lanes, batch - i0 ); \
+\
+		for ( dim_t v = 0; v < nv; ++v ) \
+		{ \
+			const dim_t i = i0 + v; \
+\
+			ap[ v ] = ( a_array ? a_array[ i ] : a + i * bs_a ); \
+			bp[ v ] = ( b_array ? b_array[ i ] : b + i * bs_b ); \
+			cp[ v ] = ( c_array ? c_array[ i ] : c + i * bs_c ); \
+		} \
+\
+		if ( k_use > 0 ) \
+		{ \
+			PASTEMAC(ch,gemmbf_gather)( conja, m, k, ap, rs_a, cs_a, nv, lanes, a_c ); \
+			PASTEMAC(ch,gemmbf_gather)( conjb, k, n, bp, rs_b, cs_b, nv, lanes, b_c ); \
+		} \
+		if ( beta_nz ) \
+			PASTEMAC(ch,gemmbf_gather)( FALSE, m, n, cp, rs_c, cs_c, nv, lanes, c_c ); \
+\
+		ker( m, n, k_use, alpha, ( ctype* )a_c, ( ctype* )b_c, beta, ( ctype* )c_c ); \
+\
+		PASTEMAC(ch,gemmbf_scatter)( m, n, c_c, nv, lanes, cp, rs_c, cs_c ); \
+	} \
+\
+	bli_membrk_release( &rntm, &mem ); \
+}
+
+INSERT_GENTFUNCR_BASIC0( gemmbf_engine )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+       dim_t   batch  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	PASTEMAC(ch,gemmbf_engine) \
+	( \
+	  transa, transb, m, n, k, \
+	  alpha, \
+	  NULL, a, rs_a, cs_a, bs_a, \
+	  NULL, b, rs_b, cs_b, bs_b, \
+	  beta, \
+	  NULL, c, rs_c, cs_c, bs_c, \
+	  batch  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_batch_fixed_strided )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype** a, inc_t rs_a, inc_t cs_a, \
+       ctype** b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype** c, inc_t rs_c, inc_t cs_c, \
+       dim_t   batch  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	PASTEMAC(ch,gemmbf_engine) \
+	( \
+	  transa, transb, m, n, k, \
+	  alpha, \
+	  a, NULL, rs_a, cs_a, 0, \
+	  b, NULL, rs_b, cs_b, 0, \
+	  beta, \
+	  c, NULL, rs_c, cs_c, 0, \
+	  batch  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_batch_fixed_array )
+
+
+//
+// The compact interface, for callers that keep their operands in the compact
+// layout between calls and so avoid the gather and scatter steps above.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+dim_t PASTEMAC(ch,opname)( void ) \
+{ \
+	bli_init_once(); \
+\
+	dim_t lanes; \
+	PASTEMAC(ch,gemm_batch_fixed_ker_query)( &lanes ); \
+\
+	return lanes; \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_batch_compact_lanes )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+siz_t PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   batch  \
+     ) \
+{ \
+	const dim_t lanes  = PASTEMAC(ch,gemm_batch_compact_lanes)(); \
+	const dim_t groups = ( batch + lanes - 1 ) / lanes; \
+\
+	return groups * m * n * lanes * sizeof( ctype ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_batch_compact_size )
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transx, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  x, inc_t rs_x, inc_t cs_x, inc_t bs_x, \
+       dim_t   batch, \
+       ctype*  xc  \
+     ) \
+{ \
+	const dim_t lanes = PASTEMAC(ch,gemm_batch_compact_lanes)(); \
+	const dim_t es    = ( bli_is_complex( PASTEMAC(ch,type) ) ? 2 : 1 ) * lanes; \
+	const bool  conjx = bli_does_conj( transx ); \
+\
+	if ( bli_does_trans( transx ) ) bli_swap_incs( &rs_x, &cs_x ); \
+\
+	ctype_r* xg = ( ctype_r* )xc; \
+	ctype*   xp[ 64 / sizeof( ctype_r ) ]; \
+\
+	for ( dim_t i0 = 0; i0 < batch; i0 += lanes ) \
+	{ \
+		const dim_t nv = bli_min( lanes, batch - i0 ); \
+\
+		for ( dim_t v = 0; v < nv; ++v ) xp[ v ] = x + ( i0 + v ) * bs_x; \
+\
+		PASTEMAC(ch,gemmbf_gather)( conjx, m, n, xp, rs_x, cs_x, nv, lanes, xg ); \
+\
+		xg += m * n * es; \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( gemm_batch_compact_pack )
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  xc, \
+       ctype*  x, inc_t rs_x, inc_t cs_x, inc_t bs_x, \
+       dim_t   batch  \
+     ) \
+{ \
+	const dim_t lanes = PASTEMAC(ch,gemm_batch_compact_lanes)(); \
+	const dim_t es    = ( bli_is_complex( PASTEMAC(ch,type) ) ? 2 : 1 ) * lanes; \
+\
+	ctype_r* xg = ( ctype_r* )xc; \
+	ctype*   xp[ 64 / sizeof( ctype_r ) ]; \
+\
+	for ( dim_t i0 = 0; i0 < batch; i0 += lanes ) \
+	{ \
+		const dim_t nv = bli_min( lanes, batch - i0 ); \
+\
+		for ( dim_t v = 0; v < nv; ++v ) xp[ v ] = x + ( i0 + v ) * bs_x; \
+\
+		PASTEMAC(ch,gemmbf_scatter)( m, n, xg, nv, lanes, xp, rs_x, cs_x ); \
+\
+		xg += m * n * es; \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( gemm_batch_compact_unpack )
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, \
+       ctype*  b, \
+       ctype*  beta, \
+       ctype*  c, \
+       dim_t   batch  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	if ( m == 0 || n == 0 || batch == 0 ) return; \
+\
+	dim_t lanes; \
+	PASTECH2(ch,gemm_batch_fixed,_ker_ft) ker \
+	= \
+	PASTEMAC(ch,gemm_batch_fixed_ker_query)( &lanes ); \
+\
+	const dim_t es    = ( bli_is_complex( PASTEMAC(ch,type) ) ? 2 : 1 ) * lanes; \
+	const siz_t align = lanes * sizeof( ctype_r ); \
+\
+	if ( m > BLIS_GEMM_BATCH_FIXED_MAX || n > BLIS_GEMM_BATCH_FIXED_MAX || \
+	     k > BLIS_GEMM_BATCH_FIXED_MAX || \
+	     !bli_is_aligned_to( ( siz_t )a, align ) || \
+	     !bli_is_aligned_to( ( siz_t )b, align ) || \
+	     !bli_is_aligned_to( ( siz_t )c, align ) ) ker = NULL; \
+\
+	/* When alpha is zero, a and b are not referenced. */ \
+	const dim_t k_use = ( PASTEMAC(ch,eq0)( *alpha ) ? 0 : k ); \
+\
+	ctype_r* ag = ( ctype_r* )a; \
+	ctype_r* bg = ( ctype_r* )b; \
+	ctype_r* cg = ( ctype_r* )c; \
+\
+	for ( dim_t i0 = 0; i0 < batch; i0 += lanes ) \
+	{ \
+		if ( ker ) \
+			ker( m, n, k_use, alpha, ( ctype* )ag, ( ctype* )bg, beta, ( ctype* )cg ); \
+		else \
+			PASTEMAC(ch,gemmbf_compact_ref)( m, n, k_use, alpha, ag, bg, beta, cg, lanes ); \
+\
+		ag += m * k * es; \
+		bg += k * n * es; \
+		cg += m * n * es; \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( gemm_batch_compact )
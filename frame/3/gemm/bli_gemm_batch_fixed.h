@@ -0,0 +1,193 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Batched gemm for groups of small problems of a common size:
+//
+//   c_i := beta * c_i + alpha * transa( a_i ) * transb( b_i ),
+//
+// for i = 0, ..., batch - 1, where every transa( a_i ) is m x k, every
+// transb( b_i ) is k x n and every c_i is m x n. When m, n and k are all at
+// most BLIS_GEMM_BATCH_FIXED_MAX, the problems are gathered a group at a time
+// into the compact layout described with GEMM_BATCH_FIXED_KER_PROT, in which
+// each SIMD lane holds the elements of a different problem, and the group is
+// computed by a fixed-size kernel. Larger problems are computed one at a time
+// with bli_?gemm(). The _strided variants address problem i at a + i * bs_a,
+// b + i * bs_b and c + i * bs_c; the _array variants address it at a[ i ],
+// b[ i ] and c[ i ].
+//
+// Callers that issue many batches over the same operands can keep them in
+// the compact layout and skip the gathering and scattering: the operands are
+// converted once with bli_?gemm_batch_compact_pack(), computed on with
+// bli_?gemm_batch_compact() as often as needed, and converted back with
+// bli_?gemm_batch_compact_unpack(). In the compact layout, the problems are
+// stored in groups of bli_?gemm_batch_compact_lanes() (the last group being
+// padded with zeros); element (i,j) of problem g * lanes + v of an m x n
+// operand is lane v of the vector at offset ( i + j * m ) * lanes within
+// group g (for complex types, the real parts and then the imaginary parts of
+// the lanes, as in GEMM_BATCH_FIXED_KER_PROT). A compact operand occupies
+// bli_?gemm_batch_compact_size() bytes and should be allocated with
+// bli_malloc_user(), since the kernels require aligned buffers; unaligned
+// buffers, and problems larger than BLIS_GEMM_BATCH_FIXED_MAX, are computed
+// by a slower reference loop. The lanes, and hence the layout, depend on the
+// instruction sets of the processor, so compact buffers must not be stored
+// or exchanged between machines.
+//
+
+#define BLIS_GEMM_BATCH_FIXED_MAX  16
+
+#undef  GENTDEF
+#define GENTDEF( ctype, ch, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       dim_t            m, \
+       dim_t            n, \
+       dim_t            k, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, \
+       ctype*  restrict b, \
+       ctype*  restrict beta, \
+       ctype*  restrict c  \
+     );
+
+INSERT_GENTDEF( gemm_batch_fixed )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t bs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t bs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t bs_c, \
+       dim_t   batch  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_batch_fixed_strided )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype** a, inc_t rs_a, inc_t cs_a, \
+       ctype** b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype** c, inc_t rs_c, inc_t cs_c, \
+       dim_t   batch  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_batch_fixed_array )
+
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS dim_t PASTEMAC(ch,opname)( void );
+
+INSERT_GENTPROT_BASIC0( gemm_batch_compact_lanes )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS siz_t PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   batch  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_batch_compact_size )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transx, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  x, inc_t rs_x, inc_t cs_x, inc_t bs_x, \
+       dim_t   batch, \
+       ctype*  xc  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_batch_compact_pack )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  xc, \
+       ctype*  x, inc_t rs_x, inc_t cs_x, inc_t bs_x, \
+       dim_t   batch  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_batch_compact_unpack )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, \
+       ctype*  b, \
+       ctype*  beta, \
+       ctype*  c, \
+       dim_t   batch  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_batch_compact )
@@ -35,6 +35,72 @@
 
 #include "blis.h"
 
+// A self-scheduled version of the loop in bli_gemm_blk_var1(). The blocks of
+// the m dimension are numbered in the order in which the static loop would
+// visit them, and the chief of each caucus claims the next unclaimed block
+// for its caucus whenever it finishes one.
+static void bli_gemm_blk_var1_dyn
+     (
+       dir_t   direct,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       cntl_t* cntl,
+       thrinfo_t* thread
+     )
+{
+	obj_t a1, c1;
+	dim_t b_alg;
+
+	const dim_t m = bli_obj_length_after_trans( c );
+
+	// Count the blocks.
+	dim_t n_blk = 0;
+
+	for ( dim_t i = 0; i < m; i += b_alg, ++n_blk )
+		b_alg = bli_determine_blocksize( BLIS_GEMM, direct, i, m, a,
+		                                 bli_cntl_bszid( cntl ), cntx );
+
+	dim_t blk_next = bli_thread_range_dyn_next( thread, n_blk );
+	dim_t blk      = 0;
+
+	// Partition along the m dimension, skipping over the blocks that were
+	// claimed by other caucuses. Since the claims of a caucus increase, one
+	// pass suffices.
+	for ( dim_t i = 0; i < m && blk_next < n_blk; i += b_alg, ++blk )
+	{
+		// Determine the current algorithmic blocksize for GEMM.
+		b_alg = bli_determine_blocksize( BLIS_GEMM, direct, i, m, a,
+		                                 bli_cntl_bszid( cntl ), cntx );
+
+		if ( blk != blk_next ) continue;
+
+		// Acquire partitions for A1 and C1.
+		bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
+		                        i, b_alg, a, &a1 );
+		bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
+		                        i, b_alg, c, &c1 );
+
+		// Perform gemm subproblem.
+		bli_gemm_int
+		(
+		  &BLIS_ONE,
+		  &a1,
+		  b,
+		  &BLIS_ONE,
+		  &c1,
+		  cntx,
+		  rntm,
+		  bli_cntl_sub_node( cntl ),
+		  bli_thrinfo_sub_node( thread )
+		);
+
+		blk_next = bli_thread_range_dyn_next( thread, n_blk );
+	}
+}
+
 void bli_gemm_blk_var1
      (
        obj_t*  a,
@@ -57,6 +123,14 @@ void bli_gemm_blk_var1
 	// Prune any zero region that exists along the partitioning dimension.
 	bli_l3_prune_unref_mparts_m( a, b, c, cntl );
 
+	// If requested, let the ic caucuses claim blocks as they become idle.
+	if ( bli_thread_ic_is_dynamic( thread ) )
+	{
+		bli_gemm_blk_var1_dyn( direct, a, b, c, cntx, rntm, cntl, thread );
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_5);
+		return;
+	}
+
 	// Determine the current thread's subpartition range.
 	bli_thread_range_mdim
 	(
@@ -34,6 +34,17 @@
 
 #include "blis.h"
 
+static void bli_gemm_blk_var3_pipe
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       cntl_t* cntl,
+       thrinfo_t* thread
+     );
+
 void bli_gemm_blk_var3
      (
        obj_t*  a,
@@ -58,6 +69,23 @@ void bli_gemm_blk_var3
 	// Query dimension in partitioning direction.
 	dim_t k_trans = bli_obj_width_after_trans( a );
 
+	// If requested, overlap the packing of each block of B with the
+	// computation on the previous one. This applies only when the sub-node
+	// packs B (and not, for example, to trmm, whose packed B depends on the
+	// diagonal), and only when there is more than one block.
+	if ( bli_rntm_pack_b_pipeline( rntm ) &&
+	     bli_cntl_family( cntl ) != BLIS_TRMM &&
+	     bli_cntl_var_func( bli_cntl_sub_node( cntl ) ) == bli_gemm_packb &&
+	     bli_obj_dt( a ) == bli_obj_dt( c ) &&
+	     k_trans > bli_cntx_get_blksz_def_dt( bli_obj_exec_dt( c ),
+	                                          bli_cntl_bszid( cntl ), cntx ) )
+	{
+		bli_gemm_blk_var3_pipe( a, b, c, cntx, rntm, cntl, thread );
+
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_5);
+		return;
+	}
+
 	// Partition along the k dimension.
 	for ( dim_t i = 0; i < k_trans; i += b_alg )
 	{
@@ -114,3 +142,109 @@ void bli_gemm_blk_var3
 	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_5);
 }
 
+// -----------------------------------------------------------------------------
+
+// Partition along the k dimension while packing each block of B into one of
+// two buffers. After computing with the current block, each thread packs its
+// share of the next block into the other buffer, so that the threads that
+// finish early pack while the others are still computing, and the barrier
+// that ends each iteration is the only synchronization needed: it ensures
+// both that the next block is fully packed before it is used and that no
+// thread is still reading the buffer that is about to be overwritten, which
+// was last used two iterations earlier.
+static void bli_gemm_blk_var3_pipe
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       cntl_t* cntl,
+       thrinfo_t* thread
+     )
+{
+	obj_t a1, b1, b1_pack[ 2 ];
+	dim_t b_alg[ 2 ];
+	mem_t mem_s;
+
+	cntl_t*    cntl_packb   = bli_cntl_sub_node( cntl );
+	thrinfo_t* thread_packb = bli_thrinfo_sub_node( thread );
+
+	// The first buffer is the block cached in the control tree node, as for
+	// bli_l3_packm(). The second buffer is acquired from the memory broker
+	// when it is first needed and released when the loop is done.
+	mem_t* mem[ 2 ] = { bli_cntl_pack_mem( cntl_packb ), &mem_s };
+
+	bli_mem_clear( &mem_s );
+
+	// Create the thrinfo_t node below the node for packing B, since
+	// bli_gemm_int() is not called for the latter.
+	bli_thrinfo_grow( rntm, cntl_packb, thread_packb );
+
+	dir_t direct  = bli_l3_direct( a, b, c, cntl );
+	dim_t k_trans = bli_obj_width_after_trans( a );
+
+	// Pack the first block.
+	b_alg[ 0 ] = bli_l3_determine_kc( direct, 0, k_trans, a, b,
+	                                  bli_cntl_bszid( cntl ), cntx, cntl );
+
+	bli_acquire_mpart_mdim( direct, BLIS_SUBPART1, 0, b_alg[ 0 ], b, &b1 );
+
+	bli_l3_packm_nosync( &b1, &b1_pack[ 0 ], mem[ 0 ], TRUE,
+	                     cntx, rntm, cntl_packb, thread_packb );
+
+	bli_thread_barrier( thread_packb );
+
+	dim_t i   = 0;
+	dim_t cur = 0;
+
+	while ( i < k_trans )
+	{
+		const dim_t i_next = i + b_alg[ cur ];
+		const dim_t nxt    = 1 - cur;
+
+		// Perform the gemm subproblem with the current block of B.
+		bli_acquire_mpart_ndim( direct, BLIS_SUBPART1,
+		                        i, b_alg[ cur ], a, &a1 );
+
+		bli_gemm_int
+		(
+		  &BLIS_ONE,
+		  &a1,
+		  &b1_pack[ cur ],
+		  &BLIS_ONE,
+		  c,
+		  cntx,
+		  rntm,
+		  bli_cntl_sub_node( cntl_packb ),
+		  bli_thrinfo_sub_node( thread_packb )
+		);
+
+		// Pack this thread's share of the next block of B.
+		if ( i_next < k_trans )
+		{
+			b_alg[ nxt ] = bli_l3_determine_kc( direct, i_next, k_trans, a, b,
+			                                    bli_cntl_bszid( cntl ), cntx, cntl );
+
+			bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
+			                        i_next, b_alg[ nxt ], b, &b1 );
+
+			bli_l3_packm_nosync( &b1, &b1_pack[ nxt ], mem[ nxt ], FALSE,
+			                     cntx, rntm, cntl_packb, thread_packb );
+		}
+
+		bli_thread_barrier( thread_packb );
+
+		// As in bli_gemm_blk_var3(), beta is applied only in the first
+		// iteration.
+		if ( i == 0 ) bli_obj_scalar_reset( c );
+
+		i   = i_next;
+		cur = nxt;
+	}
+
+	// All threads have passed the final barrier, so the second buffer is no
+	// longer in use.
+	if ( bli_thread_am_ochief( thread_packb ) && bli_mem_is_alloc( &mem_s ) )
+		bli_membrk_release( rntm, &mem_s );
+}
@@ -84,6 +84,25 @@ void bli_gemm_front
 		return;
 	}
 
+	// If requested, apply Strassen's algorithm to large real problems. The
+	// quadrant products it computes return here with one level fewer.
+	if ( cntl == NULL && bli_gemm_strassen_is_eligible( a, b, c, rntm ) )
+	{
+		bli_gemm_strassen( alpha, a, b, beta, c, cntx, rntm );
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3);
+		return;
+	}
+
+	// Single-precision operands with a double-precision result are promoted
+	// and handed to the double-precision gemm, which is much faster than
+	// typecasting within the generic mixed-datatype path.
+	if ( cntl == NULL && bli_gemm_promote_is_eligible( a, b, c ) )
+	{
+		bli_gemm_promote( alpha, a, b, beta, c, cntx, rntm );
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3);
+		return;
+	}
+
 	// Alias A, B, and C in case we need to apply transformations.
 	bli_obj_alias_to( a, &a_local );
 	bli_obj_alias_to( b, &b_local );
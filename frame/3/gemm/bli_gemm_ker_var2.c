@@ -322,13 +322,15 @@ void PASTEMAC(ch,varname) \
 	dim_t jr_inc,   ir_inc; \
 \
 	/* Determine the thread range and increment for the 2nd and 1st loops.
-	   NOTE: The definition of bli_thread_range_jrir() will depend on whether
-	   slab or round-robin partitioning was requested at configure-time. */ \
-	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &jr_start, &jr_end, &jr_inc ); \
+	   NOTE: The definitions of bli_thread_range_dyn_jrir() and
+	   bli_thread_range_jrir() will depend on the partitioning requested at
+	   configure-time. */ \
+	bli_thread_range_dyn_jrir( thread, n_iter, &jr_start, &jr_end, &jr_inc ); \
 	bli_thread_range_jrir( caucus, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc ); \
 \
 	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = jr_start; j < jr_end; j += jr_inc ) \
+	for ( j = jr_start; j < jr_end; \
+	      j = bli_thread_range_jrir_next( thread, j, jr_inc, jr_end ) ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
@@ -0,0 +1,290 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Blocks with fewer elements than this are promoted by the calling thread
+// alone.
+#define BLIS_GEMM_PROMOTE_MT_THRESH    ( 256 * 256 )
+
+//
+// Promote the columns [j_start, j_end) of the m x n single-precision matrix
+// x to the column-major double-precision matrix y with leading dimension m.
+// Callers pass row-stored matrices transposed so that the loads are
+// contiguous.
+//
+
+static void bli_gemm_promote_cvt
+     (
+       dim_t             m,
+       float*   restrict x, inc_t rsx, inc_t csx,
+       double*  restrict y,
+       dim_t             j_start,
+       dim_t             j_end
+     )
+{
+	for ( dim_t j = j_start; j < j_end; ++j )
+	{
+		float*  restrict xj = x + j*csx;
+		double* restrict yj = y + j*m;
+
+		if ( rsx == 1 )
+		{
+			for ( dim_t i = 0; i < m; ++i ) yj[ i ] = ( double )xj[ i ];
+		}
+		else
+		{
+			for ( dim_t i = 0; i < m; ++i ) yj[ i ] = ( double )xj[ i*rsx ];
+		}
+	}
+}
+
+#ifdef BLIS_ENABLE_OPENMP
+
+static void bli_gemm_promote_cvt_mt
+     (
+       dim_t    m,
+       dim_t    n,
+       float*   x, inc_t rsx, inc_t csx,
+       double*  y,
+       dim_t    n_threads
+     )
+{
+	if ( n_threads == 1 || m * n < BLIS_GEMM_PROMOTE_MT_THRESH )
+	{
+		bli_gemm_promote_cvt( m, x, rsx, csx, y, 0, n );
+		return;
+	}
+
+	_Pragma( "omp parallel num_threads(n_threads)" )
+	{
+		thrinfo_t thread;
+		dim_t     j_start;
+		dim_t     j_end;
+
+		thread.n_way   = omp_get_num_threads();
+		thread.work_id = omp_get_thread_num();
+
+		bli_thread_range_sub( &thread, n, 1, FALSE, &j_start, &j_end );
+
+		bli_gemm_promote_cvt( m, x, rsx, csx, y, j_start, j_end );
+	}
+}
+
+#else
+
+static void bli_gemm_promote_cvt_mt
+     (
+       dim_t    m,
+       dim_t    n,
+       float*   x, inc_t rsx, inc_t csx,
+       double*  y,
+       dim_t    n_threads
+     )
+{
+	bli_gemm_promote_cvt( m, x, rsx, csx, y, 0, n );
+}
+
+#endif
+
+//
+// Promote the m x n matrix x to y, keeping the orientation in which x is
+// stored, and return the strides of y.
+//
+
+static void bli_gemm_promote_cvt_oriented
+     (
+       dim_t    m,
+       dim_t    n,
+       float*   x, inc_t rsx, inc_t csx,
+       double*  y, inc_t* rsy, inc_t* csy,
+       dim_t    n_threads
+     )
+{
+	if ( bli_abs( rsx ) > bli_abs( csx ) )
+	{
+		bli_gemm_promote_cvt_mt( n, m, x, csx, rsx, y, n_threads );
+		*rsy = n; *csy = 1;
+	}
+	else
+	{
+		bli_gemm_promote_cvt_mt( m, n, x, rsx, csx, y, n_threads );
+		*rsy = 1; *csy = m;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemm_promote_sd
+     (
+       trans_t  transa,
+       trans_t  transb,
+       dim_t    m,
+       dim_t    n,
+       dim_t    k,
+       double*  alpha,
+       float*   a, inc_t rs_a, inc_t cs_a,
+       float*   b, inc_t rs_b, inc_t cs_b,
+       double*  beta,
+       double*  c, inc_t rs_c, inc_t cs_c,
+       cntx_t*  cntx,
+       rntm_t*  rntm
+     )
+{
+	AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_3);
+
+	bli_init_once();
+
+	if ( bli_zero_dim2( m, n ) )
+	{
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3);
+		return;
+	}
+
+	// With nothing to accumulate, c only has to be scaled.
+	if ( k == 0 || bli_deq0( *alpha ) )
+	{
+		bli_dscalm_ex
+		(
+		  BLIS_NO_CONJUGATE, 0, BLIS_NONUNIT_DIAG, BLIS_DENSE, m, n,
+		  beta, c, rs_c, cs_c, cntx, rntm
+		);
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3);
+		return;
+	}
+
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
+	else                { rntm_l = *rntm; }
+
+	dim_t n_threads = bli_rntm_num_threads( &rntm_l );
+	if ( n_threads < 1 ) n_threads = bli_rntm_calc_num_threads( &rntm_l );
+	n_threads = bli_max( 1, n_threads );
+
+	// Choose the width of the k panels.
+	dim_t kc = BLIS_GEMM_PROMOTE_MAX_ELEMS / ( m + n );
+	kc = bli_min( k, bli_max( kc, BLIS_GEMM_PROMOTE_MIN_KC ) );
+
+	double* ap = bli_malloc_user( ( m + n ) * kc * sizeof( double ) );
+	double* bp = ap + m * kc;
+
+	const bool trans_a = bli_does_trans( transa );
+	const bool trans_b = bli_does_trans( transb );
+
+	for ( dim_t pc = 0; pc < k; pc += kc )
+	{
+		const dim_t kb = bli_min( k - pc, kc );
+
+		// Promote the current panels as they are stored; any transposition
+		// is left to the dgemm.
+		const dim_t ma = trans_a ? kb : m;
+		const dim_t na = trans_a ? m  : kb;
+		const dim_t mb = trans_b ? n  : kb;
+		const dim_t nb = trans_b ? kb : n;
+
+		float* a_pc = a + pc * ( trans_a ? rs_a : cs_a );
+		float* b_pc = b + pc * ( trans_b ? cs_b : rs_b );
+
+		inc_t rs_ap, cs_ap, rs_bp, cs_bp;
+
+		bli_gemm_promote_cvt_oriented
+		(
+		  ma, na, a_pc, rs_a, cs_a, ap, &rs_ap, &cs_ap, n_threads
+		);
+		bli_gemm_promote_cvt_oriented
+		(
+		  mb, nb, b_pc, rs_b, cs_b, bp, &rs_bp, &cs_bp, n_threads
+		);
+
+		bli_dgemm_ex
+		(
+		  transa, transb, m, n, kb,
+		  alpha, ap, rs_ap, cs_ap, bp, rs_bp, cs_bp,
+		  ( pc == 0 ? beta : bli_d1 ), c, rs_c, cs_c,
+		  cntx, &rntm_l
+		);
+	}
+
+	bli_free_user( ap );
+
+	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3);
+}
+
+// -----------------------------------------------------------------------------
+
+bool bli_gemm_promote_is_eligible
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c
+     )
+{
+	return ( bli_obj_dt( a ) == BLIS_FLOAT &&
+	         bli_obj_dt( b ) == BLIS_FLOAT &&
+	         bli_obj_dt( c ) == BLIS_DOUBLE &&
+	         bli_obj_comp_prec( c ) == BLIS_DOUBLE_PREC );
+}
+
+void bli_gemm_promote
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// The context passed in is for the storage datatype of c; let the
+	// dgemm query its own.
+	( void )cntx;
+
+	bli_gemm_promote_sd
+	(
+	  bli_obj_onlytrans_status( a ),
+	  bli_obj_onlytrans_status( b ),
+	  bli_obj_length( c ),
+	  bli_obj_width( c ),
+	  bli_obj_width_after_trans( a ),
+	  bli_obj_buffer_for_1x1( BLIS_DOUBLE, alpha ),
+	  bli_obj_buffer_at_off( a ), bli_obj_row_stride( a ), bli_obj_col_stride( a ),
+	  bli_obj_buffer_at_off( b ), bli_obj_row_stride( b ), bli_obj_col_stride( b ),
+	  bli_obj_buffer_for_1x1( BLIS_DOUBLE, beta ),
+	  bli_obj_buffer_at_off( c ), bli_obj_row_stride( c ), bli_obj_col_stride( c ),
+	  NULL,
+	  rntm
+	);
+}
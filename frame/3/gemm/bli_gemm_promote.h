@@ -0,0 +1,92 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Mixed-precision gemm with single-precision operands and double-precision
+// accumulation.
+//
+// c := beta * c + alpha * transa( a ) * transb( b ), where a and b are real
+// single precision and alpha, beta and c are real double precision. Rather
+// than typecasting inside the generic mixed-datatype packing and
+// microkernel wrapper, panels of a and b are promoted to double precision
+// (in parallel) and the product is computed by the double-precision gemm,
+// which selects the sup or conventional path and the optimized microkernels
+// exactly as for a plain dgemm. The result is identical to a dgemm on the
+// promoted operands.
+//
+
+// Largest number of promoted elements of a and b held at once. The k
+// dimension is traversed in panels sized to respect this limit, but never
+// narrower than BLIS_GEMM_PROMOTE_MIN_KC so that each dgemm call still
+// amortizes its packing of c.
+#define BLIS_GEMM_PROMOTE_MAX_ELEMS    ( 4 * 1024 * 1024 )
+#define BLIS_GEMM_PROMOTE_MIN_KC       256
+
+BLIS_EXPORT_BLIS void bli_gemm_promote_sd
+     (
+       trans_t  transa,
+       trans_t  transb,
+       dim_t    m,
+       dim_t    n,
+       dim_t    k,
+       double*  alpha,
+       float*   a, inc_t rs_a, inc_t cs_a,
+       float*   b, inc_t rs_b, inc_t cs_b,
+       double*  beta,
+       double*  c, inc_t rs_c, inc_t cs_c,
+       cntx_t*  cntx,
+       rntm_t*  rntm
+     );
+
+// Object-based entry used by bli_gemm_front() for gemm problems with single-
+// precision a and b and a double-precision c computed in double precision.
+
+bool bli_gemm_promote_is_eligible
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c
+     );
+
+void bli_gemm_promote
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
@@ -0,0 +1,551 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Operands with fewer elements than this are added and accumulated by the
+// calling thread alone.
+#define BLIS_GEMM_STRASSEN_MT_THRESH  ( 256 * 256 )
+
+//
+// Compute z := x + sign * y for the columns [j_start, j_end) of the m x n
+// operands, where z is column-major with leading dimension ldz.
+//
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t             m, \
+       ctype             sign, \
+       ctype*  restrict  x, inc_t rsx, inc_t csx, \
+       ctype*  restrict  y, inc_t rsy, inc_t csy, \
+       ctype*  restrict  z, inc_t ldz, \
+       dim_t             j_start, \
+       dim_t             j_end  \
+     ) \
+{ \
+	for ( dim_t j = j_start; j < j_end; ++j ) \
+	{ \
+		ctype* restrict xj = x + j*csx; \
+		ctype* restrict yj = y + j*csy; \
+		ctype* restrict zj = z + j*ldz; \
+\
+		if ( rsx == 1 && rsy == 1 ) \
+		{ \
+			for ( dim_t i = 0; i < m; ++i ) \
+				zj[ i ] = xj[ i ] + sign * yj[ i ]; \
+		} \
+		else \
+		{ \
+			for ( dim_t i = 0; i < m; ++i ) \
+				zj[ i ] = xj[ i*rsx ] + sign * yj[ i*rsy ]; \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCRO_BASIC0( gemm_strassen_add )
+
+//
+// Accumulate the columns [j_start, j_end) of a quadrant product p into one or
+// two quadrants of C at once:
+//   c1 := beta1 * c1 + alpha1 * p
+//   c2 := beta2 * c2 + alpha2 * p   (if c2 is not NULL)
+// so that p is read only once. A zero beta overwrites the quadrant.
+//
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t             m, \
+       ctype*  restrict  p, inc_t ldp, \
+       ctype             alpha1, \
+       ctype             beta1, \
+       ctype*  restrict  c1, \
+       ctype             alpha2, \
+       ctype             beta2, \
+       ctype*  restrict  c2, inc_t rsc, inc_t csc, \
+       dim_t             j_start, \
+       dim_t             j_end  \
+     ) \
+{ \
+	const bool beta1_0 = PASTEMAC(ch,eq0)( beta1 ); \
+	const bool beta2_0 = PASTEMAC(ch,eq0)( beta2 ); \
+\
+	for ( dim_t j = j_start; j < j_end; ++j ) \
+	{ \
+		ctype* restrict pj  = p  + j*ldp; \
+		ctype* restrict c1j = c1 + j*csc; \
+\
+		if ( beta1_0 ) for ( dim_t i = 0; i < m; ++i ) \
+			c1j[ i*rsc ] = alpha1 * pj[ i ]; \
+		else           for ( dim_t i = 0; i < m; ++i ) \
+			c1j[ i*rsc ] = beta1 * c1j[ i*rsc ] + alpha1 * pj[ i ]; \
+\
+		if ( c2 == NULL ) continue; \
+\
+		ctype* restrict c2j = c2 + j*csc; \
+\
+		if ( beta2_0 ) for ( dim_t i = 0; i < m; ++i ) \
+			c2j[ i*rsc ] = alpha2 * pj[ i ]; \
+		else           for ( dim_t i = 0; i < m; ++i ) \
+			c2j[ i*rsc ] = beta2 * c2j[ i*rsc ] + alpha2 * pj[ i ]; \
+	} \
+}
+
+INSERT_GENTFUNCRO_BASIC0( gemm_strassen_acc )
+
+//
+// Distribute the columns of the addition and accumulation passes across
+// threads.
+//
+
+#ifdef BLIS_ENABLE_OPENMP
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       ctype   sign, \
+       ctype*  x, inc_t rsx, inc_t csx, \
+       ctype*  y, inc_t rsy, inc_t csy, \
+       ctype*  z, inc_t ldz, \
+       dim_t   n_threads  \
+     ) \
+{ \
+	if ( n_threads == 1 || m * n < BLIS_GEMM_STRASSEN_MT_THRESH ) \
+	{ \
+		PASTEMAC(ch,gemm_strassen_add) \
+		( \
+		  m, sign, x, rsx, csx, y, rsy, csy, z, ldz, 0, n \
+		); \
+		return; \
+	} \
+\
+	_Pragma( "omp parallel num_threads(n_threads)" ) \
+	{ \
+		thrinfo_t thread; \
+		dim_t     j_start; \
+		dim_t     j_end; \
+\
+		thread.n_way   = omp_get_num_threads(); \
+		thread.work_id = omp_get_thread_num(); \
+\
+		bli_thread_range_sub( &thread, n, 1, FALSE, &j_start, &j_end ); \
+\
+		PASTEMAC(ch,gemm_strassen_add) \
+		( \
+		  m, sign, x, rsx, csx, y, rsy, csy, z, ldz, j_start, j_end \
+		); \
+	} \
+}
+
+INSERT_GENTFUNCRO_BASIC0( gemm_strassen_add_mt )
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  p, inc_t ldp, \
+       ctype   alpha1, \
+       ctype   beta1, \
+       ctype*  c1, \
+       ctype   alpha2, \
+       ctype   beta2, \
+       ctype*  c2, inc_t rsc, inc_t csc, \
+       dim_t   n_threads  \
+     ) \
+{ \
+	if ( n_threads == 1 || m * n < BLIS_GEMM_STRASSEN_MT_THRESH ) \
+	{ \
+		PASTEMAC(ch,gemm_strassen_acc) \
+		( \
+		  m, p, ldp, alpha1, beta1, c1, alpha2, beta2, c2, rsc, csc, 0, n \
+		); \
+		return; \
+	} \
+\
+	_Pragma( "omp parallel num_threads(n_threads)" ) \
+	{ \
+		thrinfo_t thread; \
+		dim_t     j_start; \
+		dim_t     j_end; \
+\
+		thread.n_way   = omp_get_num_threads(); \
+		thread.work_id = omp_get_thread_num(); \
+\
+		bli_thread_range_sub( &thread, n, 1, FALSE, &j_start, &j_end ); \
+\
+		PASTEMAC(ch,gemm_strassen_acc) \
+		( \
+		  m, p, ldp, alpha1, beta1, c1, alpha2, beta2, c2, rsc, csc, \
+		  j_start, j_end \
+		); \
+	} \
+}
+
+INSERT_GENTFUNCRO_BASIC0( gemm_strassen_acc_mt )
+
+#else
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       ctype   sign, \
+       ctype*  x, inc_t rsx, inc_t csx, \
+       ctype*  y, inc_t rsy, inc_t csy, \
+       ctype*  z, inc_t ldz, \
+       dim_t   n_threads  \
+     ) \
+{ \
+	PASTEMAC(ch,gemm_strassen_add) \
+	( \
+	  m, sign, x, rsx, csx, y, rsy, csy, z, ldz, 0, n \
+	); \
+}
+
+INSERT_GENTFUNCRO_BASIC0( gemm_strassen_add_mt )
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  p, inc_t ldp, \
+       ctype   alpha1, \
+       ctype   beta1, \
+       ctype*  c1, \
+       ctype   alpha2, \
+       ctype   beta2, \
+       ctype*  c2, inc_t rsc, inc_t csc, \
+       dim_t   n_threads  \
+     ) \
+{ \
+	PASTEMAC(ch,gemm_strassen_acc) \
+	( \
+	  m, p, ldp, alpha1, beta1, c1, alpha2, beta2, c2, rsc, csc, 0, n \
+	); \
+}
+
+INSERT_GENTFUNCRO_BASIC0( gemm_strassen_acc_mt )
+
+#endif
+
+//
+// Apply one level of Strassen's algorithm to c := beta * c + alpha * a * b,
+// where a is m x k, b is k x n and c is m x n, all with general strides.
+// With the operands partitioned into quadrants, the seven products are
+//
+//   M1 = ( A11 + A22 ) ( B11 + B22 )    C11 += M1, C22 += M1
+//   M2 = ( A21 + A22 ) B11              C21 += M2, C22 -= M2
+//   M3 = A11 ( B12 - B22 )              C12 += M3, C22 += M3
+//   M4 = A22 ( B21 - B11 )              C11 += M4, C21 += M4
+//   M5 = ( A11 + A12 ) B22              C11 -= M5, C12 += M5
+//   M6 = ( A21 - A11 ) ( B11 + B12 )    C22 += M6
+//   M7 = ( A12 - A22 ) ( B21 + B22 )    C11 += M7
+//
+// (each scaled by alpha). M1 through M5 are formed in a temporary and then
+// accumulated into both of their quadrants in one pass, which also applies
+// beta the first time a quadrant is updated; M6 and M7 are accumulated into
+// C directly by the gemm that computes them. When m, n or k is odd, the last
+// row, column or rank-1 update is computed by the conventional gemm.
+//
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype*   alpha, \
+       ctype*   a, inc_t rsa, inc_t csa, \
+       ctype*   b, inc_t rsb, inc_t csb, \
+       ctype*   beta, \
+       ctype*   c, inc_t rsc, inc_t csc, \
+       cntx_t*  cntx, \
+       rntm_t*  rntm  \
+     ) \
+{ \
+	ctype* one  = PASTEMAC(ch,1); \
+	ctype* zero = PASTEMAC(ch,0); \
+\
+	const ctype alpha_p =  *alpha; \
+	const ctype alpha_n = -*alpha; \
+	const ctype beta_c  =  *beta; \
+	const ctype one_v   =  *one; \
+\
+	/* The quadrant products may apply the remaining levels. */ \
+	rntm_t rntm_l = *rntm; \
+	bli_rntm_set_strassen_levels( bli_rntm_strassen_levels( rntm ) - 1, &rntm_l ); \
+\
+	dim_t n_threads = bli_rntm_num_threads( rntm ); \
+	if ( n_threads < 1 ) n_threads = bli_rntm_calc_num_threads( rntm ); \
+	n_threads = bli_max( 1, n_threads ); \
+\
+	const dim_t mh = m / 2; \
+	const dim_t nh = n / 2; \
+	const dim_t kh = k / 2; \
+\
+	ctype* a11 = a;                ctype* a12 = a + kh*csa; \
+	ctype* a21 = a + mh*rsa;       ctype* a22 = a21 + kh*csa; \
+	ctype* b11 = b;                ctype* b12 = b + nh*csb; \
+	ctype* b21 = b + kh*rsb;       ctype* b22 = b21 + nh*csb; \
+	ctype* c11 = c;                ctype* c12 = c + nh*csc; \
+	ctype* c21 = c + mh*rsc;       ctype* c22 = c21 + nh*csc; \
+\
+	ctype* s  = bli_malloc_user( ( mh*kh + kh*nh + mh*nh ) * sizeof( ctype ) ); \
+	ctype* t  = s + mh*kh; \
+	ctype* p  = t + kh*nh; \
+\
+	/* M1 */ \
+	PASTEMAC(ch,gemm_strassen_add_mt)( mh, kh,  one_v, a11, rsa, csa, a22, rsa, csa, s, mh, n_threads ); \
+	PASTEMAC(ch,gemm_strassen_add_mt)( kh, nh,  one_v, b11, rsb, csb, b22, rsb, csb, t, kh, n_threads ); \
+	PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, mh, nh, kh, \
+	  one, s, 1, mh, t, 1, kh, zero, p, 1, mh, cntx, &rntm_l \
+	); \
+	PASTEMAC(ch,gemm_strassen_acc_mt)( mh, nh, p, mh, alpha_p, beta_c, c11, alpha_p, beta_c, c22, rsc, csc, n_threads ); \
+\
+	/* M2 */ \
+	PASTEMAC(ch,gemm_strassen_add_mt)( mh, kh,  one_v, a21, rsa, csa, a22, rsa, csa, s, mh, n_threads ); \
+	PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, mh, nh, kh, \
+	  one, s, 1, mh, b11, rsb, csb, zero, p, 1, mh, cntx, &rntm_l \
+	); \
+	PASTEMAC(ch,gemm_strassen_acc_mt)( mh, nh, p, mh, alpha_p, beta_c, c21, alpha_n, one_v, c22, rsc, csc, n_threads ); \
+\
+	/* M3 */ \
+	PASTEMAC(ch,gemm_strassen_add_mt)( kh, nh, -one_v, b12, rsb, csb, b22, rsb, csb, t, kh, n_threads ); \
+	PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, mh, nh, kh, \
+	  one, a11, rsa, csa, t, 1, kh, zero, p, 1, mh, cntx, &rntm_l \
+	); \
+	PASTEMAC(ch,gemm_strassen_acc_mt)( mh, nh, p, mh, alpha_p, beta_c, c12, alpha_p, one_v, c22, rsc, csc, n_threads ); \
+\
+	/* M4 */ \
+	PASTEMAC(ch,gemm_strassen_add_mt)( kh, nh, -one_v, b21, rsb, csb, b11, rsb, csb, t, kh, n_threads ); \
+	PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, mh, nh, kh, \
+	  one, a22, rsa, csa, t, 1, kh, zero, p, 1, mh, cntx, &rntm_l \
+	); \
+	PASTEMAC(ch,gemm_strassen_acc_mt)( mh, nh, p, mh, alpha_p, one_v, c11, alpha_p, one_v, c21, rsc, csc, n_threads ); \
+\
+	/* M5 */ \
+	PASTEMAC(ch,gemm_strassen_add_mt)( mh, kh,  one_v, a11, rsa, csa, a12, rsa, csa, s, mh, n_threads ); \
+	PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, mh, nh, kh, \
+	  one, s, 1, mh, b22, rsb, csb, zero, p, 1, mh, cntx, &rntm_l \
+	); \
+	PASTEMAC(ch,gemm_strassen_acc_mt)( mh, nh, p, mh, alpha_n, one_v, c11, alpha_p, one_v, c12, rsc, csc, n_threads ); \
+\
+	/* M6 */ \
+	PASTEMAC(ch,gemm_strassen_add_mt)( mh, kh, -one_v, a21, rsa, csa, a11, rsa, csa, s, mh, n_threads ); \
+	PASTEMAC(ch,gemm_strassen_add_mt)( kh, nh,  one_v, b11, rsb, csb, b12, rsb, csb, t, kh, n_threads ); \
+	PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, mh, nh, kh, \
+	  alpha, s, 1, mh, t, 1, kh, one, c22, rsc, csc, cntx, &rntm_l \
+	); \
+\
+	/* M7 */ \
+	PASTEMAC(ch,gemm_strassen_add_mt)( mh, kh, -one_v, a12, rsa, csa, a22, rsa, csa, s, mh, n_threads ); \
+	PASTEMAC(ch,gemm_strassen_add_mt)( kh, nh,  one_v, b21, rsb, csb, b22, rsb, csb, t, kh, n_threads ); \
+	PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, mh, nh, kh, \
+	  alpha, s, 1, mh, t, 1, kh, one, c11, rsc, csc, cntx, &rntm_l \
+	); \
+\
+	bli_free_user( s ); \
+\
+	/* Odd k: add the rank-1 contribution of the last column of a. */ \
+	if ( k > 2*kh ) \
+	{ \
+		PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, 2*mh, 2*nh, k - 2*kh, \
+		  alpha, a + 2*kh*csa, rsa, csa, b + 2*kh*rsb, rsb, csb, \
+		  one, c, rsc, csc, cntx, &rntm_l \
+		); \
+	} \
+\
+	/* Odd m: compute the last row of c. */ \
+	if ( m > 2*mh ) \
+	{ \
+		PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, m - 2*mh, n, k, \
+		  alpha, a + 2*mh*rsa, rsa, csa, b, rsb, csb, \
+		  beta, c + 2*mh*rsc, rsc, csc, cntx, &rntm_l \
+		); \
+	} \
+\
+	/* Odd n: compute the last column of c (above the last row). */ \
+	if ( n > 2*nh ) \
+	{ \
+		PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, 2*mh, n - 2*nh, k, \
+		  alpha, a, rsa, csa, b + 2*nh*csb, rsb, csb, \
+		  beta, c + 2*nh*csc, rsc, csc, cntx, &rntm_l \
+		); \
+	} \
+}
+
+INSERT_GENTFUNCRO_BASIC0( gemm_strassen_int )
+
+// -----------------------------------------------------------------------------
+
+// Return the smallest m, n and k to which a level of Strassen's algorithm is
+// applied. It is read from BLIS_STRASSEN_MIN_DIM the first time it is needed
+// and defaults to BLIS_GEMM_STRASSEN_MIN_DIM.
+static dim_t bli_gemm_strassen_min_dim( void )
+{
+	static dim_t min_dim = -1;
+
+	dim_t md = __atomic_load_n( &min_dim, __ATOMIC_RELAXED );
+
+	if ( md < 0 )
+	{
+		md = bli_env_get_var( "BLIS_STRASSEN_MIN_DIM", BLIS_GEMM_STRASSEN_MIN_DIM );
+		md = bli_max( md, 2 );
+
+		__atomic_store_n( &min_dim, md, __ATOMIC_RELAXED );
+	}
+
+	return md;
+}
+
+bool bli_gemm_strassen_is_eligible
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       rntm_t* rntm
+     )
+{
+	if ( rntm == NULL || bli_rntm_strassen_levels( rntm ) < 1 ) return FALSE;
+
+	const num_t dt = bli_obj_dt( c );
+
+	// Only homogeneous real problems computed in the storage precision
+	// are handled.
+	if ( !bli_is_real( dt ) ||
+	     bli_obj_dt( a ) != dt ||
+	     bli_obj_dt( b ) != dt ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return FALSE;
+
+	const dim_t min_dim = bli_gemm_strassen_min_dim();
+
+	return ( bli_obj_length( c )            >= min_dim &&
+	         bli_obj_width( c )             >= min_dim &&
+	         bli_obj_width_after_trans( a ) >= min_dim );
+}
+
+void bli_gemm_strassen
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_3);
+
+	const num_t dt  = bli_obj_dt( c );
+
+	const dim_t m   = bli_obj_length( c );
+	const dim_t n   = bli_obj_width( c );
+	const dim_t k   = bli_obj_width_after_trans( a );
+
+	      inc_t rsa = bli_obj_row_stride( a );
+	      inc_t csa = bli_obj_col_stride( a );
+	      inc_t rsb = bli_obj_row_stride( b );
+	      inc_t csb = bli_obj_col_stride( b );
+	const inc_t rsc = bli_obj_row_stride( c );
+	const inc_t csc = bli_obj_col_stride( c );
+
+	// Absorb any transposition into the strides.
+	if ( bli_obj_has_trans( a ) ) bli_swap_incs( &rsa, &csa );
+	if ( bli_obj_has_trans( b ) ) bli_swap_incs( &rsb, &csb );
+
+	void* buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+	void* buf_beta  = bli_obj_buffer_for_1x1( dt, beta );
+	void* buf_a     = bli_obj_buffer_at_off( a );
+	void* buf_b     = bli_obj_buffer_at_off( b );
+	void* buf_c     = bli_obj_buffer_at_off( c );
+
+	if ( bli_is_float( dt ) )
+		bli_sgemm_strassen_int
+		(
+		  m, n, k,
+		  buf_alpha, buf_a, rsa, csa, buf_b, rsb, csb,
+		  buf_beta, buf_c, rsc, csc, cntx, rntm
+		);
+	else
+		bli_dgemm_strassen_int
+		(
+		  m, n, k,
+		  buf_alpha, buf_a, rsa, csa, buf_b, rsb, csb,
+		  buf_beta, buf_c, rsc, csc, cntx, rntm
+		);
+
+	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_3);
+}
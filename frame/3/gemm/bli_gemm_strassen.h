@@ -0,0 +1,102 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Strassen's algorithm for large real gemm problems.
+//
+// When enabled, a real gemm whose m, n and k dimensions are all at least
+// BLIS_GEMM_STRASSEN_MIN_DIM is computed with one or two levels of Strassen's
+// algorithm: each operand is split into 2 x 2 quadrants, and C is updated
+// with seven quadrant-sized products instead of eight. The seven products
+// are computed by the conventional gemm (which may in turn apply the next
+// level of Strassen's algorithm), so each level removes one eighth of the
+// flops at the cost of some extra memory traffic for the operand sums and
+// for the accumulation of each product into C.
+//
+// Strassen's algorithm is disabled by default. It is enabled globally by
+// setting the BLIS_STRASSEN_LEVELS environment variable to 1 or 2, or per
+// call by setting the number of levels in a rntm_t with
+// bli_rntm_set_strassen_levels().
+//
+// Accuracy. The conventional gemm satisfies the componentwise bound
+//
+//   | C - fl( C ) | <= k u | A | | B | + O( u^2 ),
+//
+// where u is the unit roundoff. Strassen's algorithm only satisfies a
+// normwise bound. Following Higham (Accuracy and Stability of Numerical
+// Algorithms, 2nd ed., Theorem 23.2), for square operands of order n and
+// L levels of recursion,
+//
+//   max| C - fl( C ) | <= [ 12^L ( ( n / 2^L )^2 + 5 n / 2^L ) - 5 n ]
+//                         u max| A | max| B | + O( u^2 ),
+//
+// which is ( 3 n^2 + 25 n ) u max| A | max| B | for one level and
+// ( 9 n^2 + 175 n ) u max| A | max| B | for two, compared with n^2 u max| A |
+// max| B | for the same bound on the conventional algorithm. The error is thus
+// at most about 3^L times larger in the normwise sense, but elements of C
+// that are much smaller than max| A | max| B | may lose relative accuracy.
+//
+// Workspace. Each level allocates ( m k + k n + m n ) / 4 elements for one
+// operand sum of A, one of B and one quadrant-sized product.
+//
+
+// The largest number of levels of recursion that may be requested.
+#define BLIS_GEMM_STRASSEN_MAX_LEVELS  2
+
+// Smallest m, n and k for which a level of Strassen's algorithm is applied.
+// The quadrant products must be large enough that the conventional gemm
+// runs at full speed on them, and the saved flops must outweigh the extra
+// memory passes. The BLIS_STRASSEN_MIN_DIM environment variable overrides
+// it, which lets tests apply both levels to problems of moderate size.
+#define BLIS_GEMM_STRASSEN_MIN_DIM     4096
+
+bool bli_gemm_strassen_is_eligible
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       rntm_t* rntm
+     );
+
+void bli_gemm_strassen
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
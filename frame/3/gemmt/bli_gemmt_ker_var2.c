@@ -243,6 +243,14 @@ void PASTEMACT(ch,opname,uplo,varname) \
 	   function pointer type. */ \
 	PASTECH(ch,gemm_ukr_ft) \
 	                gemm_ukr   = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* Query the context for the (optional) micro-kernel that updates only
+	   the stored part of micro-tiles which intersect the diagonal. It is
+	   not used for induced methods since they change the meaning of the
+	   m and n offsets. */ \
+	PASTECH(ch,gemm_ukr_ft) \
+	                gemmt_ukr  = ( bli_cntx_method( cntx ) == BLIS_NAT ? \
+	                               bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMMT_L_UKR, cntx ) : NULL ); \
 \
 	/* Temporary C buffer for edge cases. Note that the strides of this
 	   temporary buffer are set so that they match the storage of the
@@ -369,13 +377,19 @@ void PASTEMACT(ch,opname,uplo,varname) \
 	dim_t m_off_cblock, n_off_cblock; \
 \
 	/* Determine the thread range and increment for the 2nd and 1st loops.
-	   NOTE: The definition of bli_thread_range_jrir() will depend on whether
-	   slab or round-robin partitioning was requested at configure-time. */ \
-	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &jr_start, &jr_end, &jr_inc ); \
+	   The 2nd loop is partitioned by the number of micro-tiles of the stored
+	   triangle rather than by the number of columns so that threads receive
+	   similar amounts of work along the diagonal (or is self-scheduled).
+	   NOTE: The definitions of bli_thread_range_tiles_jrir() and
+	   bli_thread_range_jrir() will depend on the partitioning requested at
+	   configure-time. */ \
+	bli_thread_range_tiles_jrir( thread, diagoffc, BLIS_LOWER, m, n, MR, NR, \
+	                             &jr_start, &jr_end, &jr_inc ); \
 	bli_thread_range_jrir( caucus, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc ); \
 \
 	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = jr_start; j < jr_end; j += jr_inc ) \
+	for ( j = jr_start; j < jr_end; \
+	      j = bli_thread_range_jrir_next( thread, j, jr_inc, jr_end ) ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
@@ -463,6 +477,24 @@ void PASTEMACT(ch,opname,uplo,varname) \
 							                c11, rs_c,  cs_c ); \
 					} \
 				} \
+				else if ( gemmt_ukr != NULL && m_cur == MR && n_cur == NR ) \
+				{ \
+					/* Invoke the gemmt micro-kernel, which writes only the
+					   stored part of the micro-tile directly to C. */ \
+					bli_auxinfo_set_diagoff( m_off_cblock - n_off_cblock, &aux ); \
+\
+					gemmt_ukr \
+					( \
+					  k, \
+					  alpha_cast, \
+					  a1, \
+					  b1, \
+					  beta_cast, \
+					  c11, rs_c, cs_c, \
+					  &aux, \
+					  cntx  \
+					); \
+				} \
 				else \
 				{ \
 					gemm_ukr \
@@ -550,6 +582,14 @@ void PASTEMACT(ch,opname,uplo,varname) \
 	   function pointer type. */ \
 	PASTECH(ch,gemm_ukr_ft) \
 	                gemm_ukr   = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* Query the context for the (optional) micro-kernel that updates only
+	   the stored part of micro-tiles which intersect the diagonal. It is
+	   not used for induced methods since they change the meaning of the
+	   m and n offsets. */ \
+	PASTECH(ch,gemm_ukr_ft) \
+	                gemmt_ukr  = ( bli_cntx_method( cntx ) == BLIS_NAT ? \
+	                               bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMMT_U_UKR, cntx ) : NULL ); \
 \
 	/* Temporary C buffer for edge cases. Note that the strides of this
 	   temporary buffer are set so that they match the storage of the
@@ -671,13 +711,19 @@ void PASTEMACT(ch,opname,uplo,varname) \
 	dim_t m_off_cblock, n_off_cblock; \
 \
 	/* Determine the thread range and increment for the 2nd and 1st loops.
-	   NOTE: The definition of bli_thread_range_jrir() will depend on whether
-	   slab or round-robin partitioning was requested at configure-time. */ \
-	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &jr_start, &jr_end, &jr_inc ); \
+	   The 2nd loop is partitioned by the number of micro-tiles of the stored
+	   triangle rather than by the number of columns so that threads receive
+	   similar amounts of work along the diagonal (or is self-scheduled).
+	   NOTE: The definitions of bli_thread_range_tiles_jrir() and
+	   bli_thread_range_jrir() will depend on the partitioning requested at
+	   configure-time. */ \
+	bli_thread_range_tiles_jrir( thread, diagoffc, BLIS_UPPER, m, n, MR, NR, \
+	                             &jr_start, &jr_end, &jr_inc ); \
 	bli_thread_range_jrir( caucus, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc ); \
 \
 	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = jr_start; j < jr_end; j += jr_inc ) \
+	for ( j = jr_start; j < jr_end; \
+	      j = bli_thread_range_jrir_next( thread, j, jr_inc, jr_end ) ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
@@ -760,6 +806,24 @@ void PASTEMACT(ch,opname,uplo,varname) \
 							                c11, rs_c,  cs_c ); \
 					} \
 				} \
+				else if ( gemmt_ukr != NULL && m_cur == MR && n_cur == NR ) \
+				{ \
+					/* Invoke the gemmt micro-kernel, which writes only the
+					   stored part of the micro-tile directly to C. */ \
+					bli_auxinfo_set_diagoff( m_off_cblock - n_off_cblock, &aux ); \
+\
+					gemmt_ukr \
+					( \
+					  k, \
+					  alpha_cast, \
+					  a1, \
+					  b1, \
+					  beta_cast, \
+					  c11, rs_c, cs_c, \
+					  &aux, \
+					  cntx  \
+					); \
+				} \
 				else \
 				{ \
 					gemm_ukr \
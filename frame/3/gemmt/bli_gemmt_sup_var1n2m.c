@@ -1834,9 +1834,14 @@ void PASTEMACT(ch,opname,uplo,varname) \
 				dim_t jr_iter = ( nc_pruned + NR - 1 ) / NR; \
 				dim_t jr_left =   nc_pruned % NR; \
 \
-				/* Compute the JR loop thread range for the current thread. */ \
+				/* Compute the JR loop thread range for the current thread. The
+				   micropanels are partitioned by the number of micro-tiles of the
+				   stored part of the mc_cur x nc_pruned trapezoid so that threads
+				   which own columns near the diagonal are not left idle. */ \
 				dim_t jr_start, jr_end; \
-				bli_thread_range_sub( thread_jr, jr_iter, 1, FALSE, &jr_start, &jr_end ); \
+				bli_thread_range_tiles_sub( thread_jr, diagoffc, BLIS_LOWER, \
+				                            mc_cur, nc_pruned, MR, NR, \
+				                            &jr_start, &jr_end ); \
 \
 				/* An optimization: allow the last jr iteration to contain up to NRE
 				   columns of C and B. (If NRE > NR, the mkernel has agreed to handle
@@ -2499,9 +2504,14 @@ void PASTEMACT(ch,opname,uplo,varname) \
 				dim_t jr_iter = ( nc_pruned + NR - 1 ) / NR; \
 				dim_t jr_left =   nc_pruned % NR; \
 \
-				/* Compute the JR loop thread range for the current thread. */ \
+				/* Compute the JR loop thread range for the current thread. The
+				   micropanels are partitioned by the number of micro-tiles of the
+				   stored part of the mc_cur x nc_pruned trapezoid so that threads
+				   which own columns near the diagonal are not left idle. */ \
 				dim_t jr_start, jr_end; \
-				bli_thread_range_sub( thread_jr, jr_iter, 1, FALSE, &jr_start, &jr_end ); \
+				bli_thread_range_tiles_sub( thread_jr, diagoffc, BLIS_UPPER, \
+				                            mc_cur, nc_pruned, MR, NR, \
+				                            &jr_start, &jr_end ); \
 \
 				/* An optimization: allow the last jr iteration to contain up to NRE
 				   columns of C and B. (If NRE > NR, the mkernel has agreed to handle
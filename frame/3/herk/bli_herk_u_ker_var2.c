@@ -175,6 +175,11 @@ void PASTEMAC(ch,varname) \
 	   function pointer type. */ \
 	PASTECH(ch,gemm_ukr_ft) \
 	                gemm_ukr   = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* Query the context for the (optional) micro-kernel that updates only
+	   the stored part of micro-tiles which intersect the diagonal. */ \
+	PASTECH(ch,gemm_ukr_ft) \
+	                gemmt_ukr  = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMMT_U_UKR, cntx ); \
 \
 	/* Temporary C buffer for edge cases. Note that the strides of this
 	   temporary buffer are set so that they match the storage of the
@@ -327,14 +332,20 @@ void PASTEMAC(ch,varname) \
 		n_iter_rct = n_iter - n_iter_tri; \
 	} \
 \
-	/* Use round-robin assignment of micropanels to threads in the 2nd loop
-	   and the default (slab or rr) partitioning in the 1st loop for the
-	   initial triangular region of C (if it exists). */ \
-	bli_thread_range_jrir_rr( thread, n_iter_tri, 1, FALSE, &jr_start, &jr_end, &jr_inc ); \
-	bli_thread_range_jrir   ( caucus, m_iter,     1, FALSE, &ir_start, &ir_end, &ir_inc ); \
-\
-	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = jr_start; j < jr_end; j += jr_inc ) \
+	/* Determine the thread range and increment for the 2nd loop, which spans
+	   both regions and is partitioned by the number of micro-tiles computed
+	   (or self-scheduled), and for the 1st loop.
+	   NOTE: The definitions of bli_thread_range_tiles_jrir() and
+	   bli_thread_range_jrir() will depend on the partitioning requested at
+	   configure-time. */ \
+	bli_thread_range_tiles_jrir( thread, diagoffc, BLIS_UPPER, m, n, MR, NR, \
+	                             &jr_start, &jr_end, &jr_inc ); \
+	bli_thread_range_jrir( caucus, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc ); \
+\
+	/* Loop over the n dimension (NR columns at a time) within the initial
+	   triangular region of C (if it exists). */ \
+	for ( j = jr_start; j < jr_end && j < n_iter_tri; \
+	      j = bli_thread_range_jrir_next( thread, j, jr_inc, jr_end ) ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
@@ -367,7 +378,7 @@ void PASTEMAC(ch,varname) \
 			{ \
 				a2 = a_cast; \
 				b2 = bli_herk_get_next_b_upanel( b1, cstep_b, jr_inc ); \
-				if ( bli_is_last_iter_rr( j, n_iter, jr_tid, jr_nt ) ) \
+				if ( bli_is_last_iter( j, n_iter, jr_tid, jr_nt ) ) \
 					b2 = b_cast; \
 			} \
 \
@@ -385,25 +396,46 @@ void PASTEMAC(ch,varname) \
 			   continue. */ \
 			if ( bli_intersects_diag_n( diagoffc_ij, m_cur, n_cur ) ) \
 			{ \
-				/* Invoke the gemm micro-kernel. */ \
-				gemm_ukr \
-				( \
-				  k, \
-				  alpha_cast, \
-				  a1, \
-				  b1, \
-				  zero, \
-				  ct, rs_ct, cs_ct, \
-				  &aux, \
-				  cntx  \
-				); \
-\
-				/* Scale C and add the result to only the stored part. */ \
-				PASTEMAC(ch,xpbys_mxn_u)( diagoffc_ij, \
-				                          m_cur, n_cur, \
-				                          ct,  rs_ct, cs_ct, \
-				                          beta_cast, \
-				                          c11, rs_c,  cs_c ); \
+				if ( gemmt_ukr != NULL && m_cur == MR && n_cur == NR ) \
+				{ \
+					/* Invoke the gemmt micro-kernel, which writes only the
+					   stored part of the micro-tile directly to C. */ \
+					bli_auxinfo_set_diagoff( diagoffc_ij, &aux ); \
+\
+					gemmt_ukr \
+					( \
+					  k, \
+					  alpha_cast, \
+					  a1, \
+					  b1, \
+					  beta_cast, \
+					  c11, rs_c, cs_c, \
+					  &aux, \
+					  cntx  \
+					); \
+				} \
+				else \
+				{ \
+					/* Invoke the gemm micro-kernel. */ \
+					gemm_ukr \
+					( \
+					  k, \
+					  alpha_cast, \
+					  a1, \
+					  b1, \
+					  zero, \
+					  ct, rs_ct, cs_ct, \
+					  &aux, \
+					  cntx  \
+					); \
+\
+					/* Scale C and add the result to only the stored part. */ \
+					PASTEMAC(ch,xpbys_mxn_u)( diagoffc_ij, \
+					                          m_cur, n_cur, \
+					                          ct,  rs_ct, cs_ct, \
+					                          beta_cast, \
+					                          c11, rs_c,  cs_c ); \
+				} \
 			} \
 			else if ( bli_is_strictly_above_diag_n( diagoffc_ij, m_cur, n_cur ) ) \
 			{ \
@@ -451,20 +483,10 @@ void PASTEMAC(ch,varname) \
 	/* If there is no rectangular region, then we're done. */ \
 	if ( n_iter_rct == 0 ) return; \
 \
-	/* Determine the thread range and increment for the 2nd loop of the
-	   remaining rectangular region of C (and also use default partitioning
-	   for the 1st loop).
-	   NOTE: The definition of bli_thread_range_jrir() will depend on whether
-	   slab or round-robin partitioning was requested at configure-time. */ \
-	bli_thread_range_jrir( thread, n_iter_rct, 1, FALSE, &jr_start, &jr_end, &jr_inc ); \
-\
-	/* Advance the start and end iteration offsets for the rectangular region
-	   by the number of iterations used for the triangular region. */ \
-	jr_start += n_iter_tri; \
-	jr_end   += n_iter_tri; \
-\
-	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = jr_start; j < jr_end; j += jr_inc ) \
+	/* Continue the 2nd loop from where it left the triangular region and
+	   loop over the remaining rectangular region of C. */ \
+	for ( ; j < jr_end; \
+	      j = bli_thread_range_jrir_next( thread, j, jr_inc, jr_end ) ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
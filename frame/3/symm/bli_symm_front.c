@@ -64,6 +64,12 @@ void bli_symm_front
 		return;
 	}
 
+	// Small problems are computed by the gemm sup path on a dense copy of
+	// A, which avoids packing the structured matrix.
+	if ( cntl == NULL &&
+	     bli_hemmsup( side, alpha, a, b, beta, c, cntx, rntm ) == BLIS_SUCCESS )
+		return;
+
 	// Alias A, B, and C in case we need to apply transformations.
 	bli_obj_alias_to( a, &a_local );
 	bli_obj_alias_to( b, &b_local );
@@ -63,6 +63,18 @@ void bli_trmm_front
 		return;
 	}
 
+#ifdef BLIS_ENABLE_SMALL_MATRIX_TRMM
+	// Small problems are computed in place without the object, control tree
+	// and thread management of the conventional path below.
+	if ( cntl == NULL &&
+	     bli_cntx_trmm_small_thresh_is_met_zen( a, bli_obj_length( b ),
+	                                            bli_obj_width( b ), rntm ) &&
+	     bli_trmm_small( side, alpha, a, b, cntx, cntl ) == BLIS_SUCCESS )
+	{
+		return;
+	}
+#endif
+
 	// Alias A and B so we can tweak the objects if necessary.
 	bli_obj_alias_to( a, &a_local );
 	bli_obj_alias_to( b, &b_local );
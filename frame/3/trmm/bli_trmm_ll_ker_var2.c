@@ -167,6 +167,14 @@ void PASTEMAC(ch,varname) \
 	   function pointer type. */ \
 	PASTECH(ch,gemm_ukr_ft) \
 	                gemm_ukr   = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* Query the context for the (optional) micro-kernel that is aware of
+	   the triangular MR x MR block with which diagonal-intersecting micro-
+	   panels of A end. It is not used for induced methods since they
+	   change the layout of the packed micro-panels. */ \
+	PASTECH(ch,gemm_ukr_ft) \
+	                trmm_ukr   = ( bli_cntx_method( cntx ) == BLIS_NAT ? \
+	                               bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_TRMM_L_UKR, cntx ) : NULL ); \
 \
 	/* Temporary C buffer for edge cases. Note that the strides of this
 	   temporary buffer are set so that they match the storage of the
@@ -414,7 +422,23 @@ void PASTEMAC(ch,varname) \
 				bli_auxinfo_set_is_a( is_a_cur, &aux ); \
 \
 				/* Handle interior and edge cases separately. */ \
-				if ( m_cur == MR && n_cur == NR ) \
+				if ( trmm_ukr != NULL && m_cur == MR && n_cur == NR && \
+				     diagoffa_i + MR <= k ) \
+				{ \
+					/* Invoke the trmm micro-kernel. */ \
+					trmm_ukr \
+					( \
+					  k_a1011, \
+					  alpha_cast, \
+					  a1, \
+					  b1_i, \
+					  beta_cast, \
+					  c11, rs_c, cs_c, \
+					  &aux, \
+					  cntx  \
+					); \
+				} \
+				else if ( m_cur == MR && n_cur == NR ) \
 				{ \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
@@ -57,6 +57,24 @@ typedef void (*FUNCPTR_T)
 
 static FUNCPTR_T GENARRAY(ftypes,trmm_rl_ker_var2);
 
+typedef struct
+{
+	doff_t diagoffb;
+	dim_t  k;
+	dim_t  nr;
+} trmm_rl_cost_t;
+
+// Return the cost of the jth micropanel of B, which is proportional to the
+// length of the part of the panel that is not implicitly zero.
+static double bli_trmm_rl_panel_cost( dim_t j, void* params )
+{
+	trmm_rl_cost_t* p = params;
+
+	const doff_t diagoffb_j = p->diagoffb - ( doff_t )( j * p->nr );
+
+	return ( double )( p->k - bli_max( -diagoffb_j, 0 ) );
+}
+
 
 void bli_trmm_rl_ker_var2
      (
@@ -363,16 +381,22 @@ void PASTEMAC(ch,varname) \
 		n_iter_tri = n_iter - n_iter_rct; \
 	} \
 \
-	/* Determine the thread range and increment for the 2nd and 1st loops for
-	   the initial rectangular region of B (if it exists).
-       NOTE: The definition of bli_thread_range_jrir() will depend on whether
-       slab or round-robin partitioning was requested at configure-time. \
+	/* Determine the thread range and increment for the 2nd loop, which spans
+	   both regions and is partitioned by the length of each micropanel of B,
+	   and for the 1st loop.
+       NOTE: The definitions of bli_thread_range_cost_jrir() and
+       bli_thread_range_jrir() will depend on whether slab or round-robin
+       partitioning was requested at configure-time. \
        NOTE: Parallelism in the 1st loop is disabled for now. */ \
-	bli_thread_range_jrir( thread, n_iter_rct, 1, FALSE, &jr_start, &jr_end, &jr_inc ); \
-	bli_thread_range_jrir( caucus, m_iter,     1, FALSE, &ir_start, &ir_end, &ir_inc ); \
+	trmm_rl_cost_t cost_params = { diagoffb, k, NR }; \
 \
-	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = jr_start; j < jr_end; j += jr_inc ) \
+	bli_thread_range_cost_jrir( thread, n_iter, bli_trmm_rl_panel_cost, \
+	                            &cost_params, &jr_start, &jr_end, &jr_inc ); \
+	bli_thread_range_jrir( caucus, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc ); \
+\
+	/* Loop over the n dimension (NR columns at a time) within the initial
+	   rectangular region of B (if it exists). */ \
+	for ( j = jr_start; j < jr_end && j < n_iter_rct; j += jr_inc ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
@@ -459,21 +483,20 @@ void PASTEMAC(ch,varname) \
 	/* If there is no triangular region, then we're done. */ \
 	if ( n_iter_tri == 0 ) return; \
 \
-	/* Use round-robin assignment of micropanels to threads in the 2nd and
-	   1st loops for the remaining triangular region of B (if it exists).
-	   NOTE: We don't need to call bli_thread_range_jrir_rr() here since we
-	   employ a hack that calls for each thread to execute every iteration
-	   of the jr and ir loops but skip all but the pointer increment for
-	   iterations that are not assigned to it. */ \
+	/* Use the 2nd loop's range from above and round-robin assignment of
+	   micropanels to threads in the 1st loop for the remaining triangular
+	   region of B (if it exists).
+	   NOTE: We employ a hack that calls for each thread to execute every
+	   iteration of the jr and ir loops but skip all but the pointer
+	   increment for iterations that are not assigned to it. */ \
 \
 	/* Advance the starting b1 and c1 pointers to the positions corresponding
 	   to the start of the triangular region of B. */ \
-	jr_start = n_iter_rct; \
-	b1 = b_cast + jr_start * cstep_b; \
-	c1 = c_cast + jr_start * cstep_c; \
+	b1 = b_cast + n_iter_rct * cstep_b; \
+	c1 = c_cast + n_iter_rct * cstep_c; \
 \
 	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = jr_start; j < n_iter; ++j ) \
+	for ( j = n_iter_rct; j < n_iter; ++j ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
@@ -506,7 +529,7 @@ void PASTEMAC(ch,varname) \
 			is_b_cur += ( bli_is_odd( is_b_cur ) ? 1 : 0 ); \
 			ps_b_cur  = ( is_b_cur * ss_b_num ) / ss_b_den; \
 \
-			if ( bli_trmm_my_iter_rr( j, thread ) ) { \
+			if ( bli_thread_range_jrir_has( j, jr_start, jr_end, jr_inc ) ) { \
 \
 			/* Save the 4m1/3m1 imaginary stride of B to the auxinfo_t
 			   object. */ \
@@ -57,6 +57,24 @@ typedef void (*FUNCPTR_T)
 
 static FUNCPTR_T GENARRAY(ftypes,trmm_ru_ker_var2);
 
+typedef struct
+{
+	doff_t diagoffb;
+	dim_t  k;
+	dim_t  nr;
+} trmm_ru_cost_t;
+
+// Return the cost of the jth micropanel of B, which is proportional to the
+// length of the part of the panel that is not implicitly zero.
+static double bli_trmm_ru_panel_cost( dim_t j, void* params )
+{
+	trmm_ru_cost_t* p = params;
+
+	const doff_t diagoffb_j = p->diagoffb - ( doff_t )( j * p->nr );
+
+	return ( double )bli_min( p->k, -diagoffb_j + p->nr );
+}
+
 
 void bli_trmm_ru_ker_var2
      (
@@ -368,12 +386,22 @@ void PASTEMAC(ch,varname) \
 		n_iter_rct = n_iter - n_iter_tri; \
 	} \
 \
-	/* Use round-robin assignment of micropanels to threads in the 2nd and
-	   1st loops for the initial triangular region of B (if it exists).
-	   NOTE: We don't need to call bli_thread_range_jrir_rr() here since we
-	   employ a hack that calls for each thread to execute every iteration
-	   of the jr and ir loops but skip all but the pointer increment for
-	   iterations that are not assigned to it. */ \
+	/* Determine the thread range and increment for the 2nd loop, which spans
+	   both regions and is partitioned by the length of each micropanel of B.
+	   NOTE: The definition of bli_thread_range_cost_jrir() will depend on
+	   whether slab or round-robin partitioning was requested at
+	   configure-time. */ \
+	trmm_ru_cost_t cost_params = { diagoffb, k, NR }; \
+\
+	bli_thread_range_cost_jrir( thread, n_iter, bli_trmm_ru_panel_cost, \
+	                            &cost_params, &jr_start, &jr_end, &jr_inc ); \
+\
+	/* Use the 2nd loop's range from above and round-robin assignment of
+	   micropanels to threads in the 1st loop for the initial triangular
+	   region of B (if it exists).
+	   NOTE: We employ a hack that calls for each thread to execute every
+	   iteration of the jr and ir loops but skip all but the pointer
+	   increment for iterations that are not assigned to it. */ \
 \
 	b1 = b_cast; \
 	c1 = c_cast; \
@@ -411,7 +439,7 @@ void PASTEMAC(ch,varname) \
 			is_b_cur += ( bli_is_odd( is_b_cur ) ? 1 : 0 ); \
 			ps_b_cur  = ( is_b_cur * ss_b_num ) / ss_b_den; \
 \
-			if ( bli_trmm_my_iter_rr( j, thread ) ) { \
+			if ( bli_thread_range_jrir_has( j, jr_start, jr_end, jr_inc ) ) { \
 \
 			/* Save the 4m1/3m1 imaginary stride of B to the auxinfo_t
 			   object. */ \
@@ -501,18 +529,15 @@ void PASTEMAC(ch,varname) \
 	/* If there is no rectangular region, then we're done. */ \
 	if ( n_iter_rct == 0 ) return; \
 \
-	/* Determine the thread range and increment for the 2nd and 1st loops for
-	   the remaining rectangular region of B.
-	   NOTE: The definition of bli_thread_range_jrir() will depend on whether
-	   slab or round-robin partitioning was requested at configure-time. \
+	/* Determine the thread range and increment for the 1st loop for the
+	   remaining rectangular region of B.
 	   NOTE: Parallelism in the 1st loop is disabled for now. */ \
-	bli_thread_range_jrir( thread, n_iter_rct, 1, FALSE, &jr_start, &jr_end, &jr_inc ); \
-	bli_thread_range_jrir( caucus, m_iter,     1, FALSE, &ir_start, &ir_end, &ir_inc ); \
+	bli_thread_range_jrir( caucus, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc ); \
 \
-	/* Advance the start and end iteration offsets for the rectangular region
-       by the number of iterations used for the triangular region. */ \
-    jr_start += n_iter_tri; \
-    jr_end   += n_iter_tri; \
+	/* Advance the start of the 2nd loop's range to its first iteration
+	   within the rectangular region. */ \
+	if ( jr_start < n_iter_tri ) \
+		jr_start += ( ( n_iter_tri - jr_start + jr_inc - 1 ) / jr_inc ) * jr_inc; \
 	jb0       = n_iter_tri; \
 \
 	/* Save the resulting value of b1 from the previous loop since it represents
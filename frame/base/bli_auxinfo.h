@@ -74,6 +74,11 @@ BLIS_INLINE inc_t bli_auxinfo_ps_b( auxinfo_t* ai )
 	return ai->ps_b;
 }
 
+BLIS_INLINE doff_t bli_auxinfo_diagoff( auxinfo_t* ai )
+{
+	return ai->diagoff;
+}
+
 #if 0
 BLIS_INLINE inc_t bli_auxinfo_dt_on_output( auxinfo_t* ai )
 {
@@ -125,6 +130,11 @@ BLIS_INLINE void bli_auxinfo_set_ps_b( inc_t ps, auxinfo_t* ai )
 	ai->ps_b = ps;
 }
 
+BLIS_INLINE void bli_auxinfo_set_diagoff( doff_t diagoff, auxinfo_t* ai )
+{
+	ai->diagoff = diagoff;
+}
+
 #if 0
 BLIS_INLINE void bli_auxinfo_set_dt_on_output( num_t dt_on_output, auxinfo_t* ai )
 {
@@ -0,0 +1,200 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Cache sizes in bytes, indexed by level (entry 0 is unused), and whether
+// cache blocksizes should be derived from them.
+static dim_t cache_size[ 4 ] = { 0, 0, 0, 0 };
+static bool  scale_blkszs    = TRUE;
+
+static bli_pthread_once_t once_sizes = BLIS_PTHREAD_ONCE_INIT;
+
+// Bound the ratio between detected and reference cache sizes. Hypervisors
+// sometimes report implausible sizes (e.g. the L3 of the whole host), and
+// blocksizes far from the tuned values are rarely a good idea.
+#define BLIS_CACHE_RATIO_MIN 0.25
+#define BLIS_CACHE_RATIO_MAX 4.0
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_cache_query_size( dim_t level )
+{
+	bli_cache_init_sizes_once();
+
+	if ( level < 1 || 3 < level ) return 0;
+
+	return cache_size[ level ];
+}
+
+void bli_cache_init_sizes_once( void )
+{
+	bli_pthread_once( &once_sizes, bli_cache_init_sizes );
+}
+
+void bli_cache_init_sizes( void )
+{
+	uint32_t l1d = 0, l2 = 0, l3 = 0;
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86)
+	bli_cpuid_query_cache_sizes( &l1d, &l2, &l3 );
+#endif
+
+	// Sizes given in the environment (in KiB) take precedence.
+	const gint_t l1d_env = bli_env_get_var( "BLIS_L1D_CACHE_KB", -1 );
+	const gint_t l2_env  = bli_env_get_var( "BLIS_L2_CACHE_KB",  -1 );
+	const gint_t l3_env  = bli_env_get_var( "BLIS_L3_CACHE_KB",  -1 );
+
+	scale_blkszs    = ( bli_env_get_var( "BLIS_CACHE_BLKSZ", 1 ) != 0 );
+	cache_size[ 1 ] = ( l1d_env > 0 ? l1d_env * 1024 : ( dim_t )l1d );
+	cache_size[ 2 ] = ( l2_env  > 0 ? l2_env  * 1024 : ( dim_t )l2  );
+	cache_size[ 3 ] = ( l3_env  > 0 ? l3_env  * 1024 : ( dim_t )l3  );
+}
+
+// -----------------------------------------------------------------------------
+
+static double bli_cache_ratio( double r )
+{
+	return bli_min( bli_max( r, BLIS_CACHE_RATIO_MIN ), BLIS_CACHE_RATIO_MAX );
+}
+
+static double bli_cache_size_ratio( dim_t level, dim_t size_ref )
+{
+	const dim_t size = bli_cache_query_size( level );
+
+	if ( size <= 0 || size_ref <= 0 ) return 1.0;
+
+	return bli_cache_ratio( ( double )size / ( double )size_ref );
+}
+
+static dim_t bli_cache_gcd( dim_t a, dim_t b )
+{
+	while ( b != 0 ) { dim_t t = a % b; a = b; b = t; }
+
+	return a;
+}
+
+// Scale the default and maximum values of b for datatype dt by f, keeping
+// them whole multiples of align and preserving their ordering.
+static void bli_cache_scale_blksz_dt
+     (
+       num_t    dt,
+       double   f,
+       dim_t    align,
+       blksz_t* b
+     )
+{
+	const dim_t b_def = bli_blksz_get_def( dt, b );
+	const dim_t b_max = bli_blksz_get_max( dt, b );
+
+	if ( f == 1.0 || b_def <= 0 || b_max <= 0 ) return;
+
+	dim_t def_new = ( ( dim_t )( b_def * f ) / align ) * align;
+	dim_t max_new = ( ( dim_t )( b_max * f ) / align ) * align;
+
+	def_new = bli_max( def_new, align );
+	max_new = bli_max( max_new, align );
+
+	if ( b_max >= b_def ) max_new = bli_max( max_new, def_new );
+
+	bli_blksz_set_def( def_new, dt, b );
+	bli_blksz_set_max( max_new, dt, b );
+}
+
+// Return the multiple a cache blocksize of b must keep: the lcm of the two
+// register blocksizes if b currently honors it, otherwise x.
+static dim_t bli_cache_align_dt
+     (
+       num_t    dt,
+       dim_t    x,
+       dim_t    y,
+       blksz_t* b
+     )
+{
+	const dim_t xy = x / bli_cache_gcd( x, y ) * y;
+
+	if ( bli_blksz_get_def( dt, b ) % xy == 0 &&
+	     bli_blksz_get_max( dt, b ) % xy == 0 ) return xy;
+
+	return x;
+}
+
+void bli_cache_scale_blkszs
+     (
+       dim_t    l1d_ref,
+       dim_t    l2_ref,
+       dim_t    l3_ref,
+       blksz_t* mr,
+       blksz_t* nr,
+       blksz_t* mc,
+       blksz_t* kc,
+       blksz_t* nc
+     )
+{
+	bli_cache_init_sizes_once();
+
+	if ( !scale_blkszs ) return;
+
+	const double r1 = bli_cache_size_ratio( 1, l1d_ref );
+	const double r2 = bli_cache_size_ratio( 2, l2_ref );
+	const double r3 = bli_cache_size_ratio( 3, l3_ref );
+
+	// A KC x NR micropanel of B occupies a fixed share of the L1 cache, and
+	// the MC x KC block of A and KC x NC panel of B occupy fixed shares of
+	// the L2 and L3 caches. Hence KC scales with the L1 size while MC and NC
+	// scale with the L2 and L3 sizes divided by the KC scaling.
+	const double fk = r1;
+	const double fm = bli_cache_ratio( r2 / r1 );
+	const double fn = bli_cache_ratio( r3 / r1 );
+
+	for ( num_t dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	{
+		const dim_t mr_dt = bli_blksz_get_def( dt, mr );
+		const dim_t nr_dt = bli_blksz_get_def( dt, nr );
+
+		if ( mr_dt <= 0 || nr_dt <= 0 ) continue;
+
+		// Keep KC as aligned as it was (up to 16), which preserves any
+		// multiple of KR.
+		const dim_t kc_align = bli_cache_gcd( bli_cache_gcd( bli_blksz_get_def( dt, kc ),
+		                                                     bli_blksz_get_max( dt, kc ) ), 16 );
+		const dim_t mc_align = bli_cache_align_dt( dt, mr_dt, nr_dt, mc );
+		const dim_t nc_align = bli_cache_align_dt( dt, nr_dt, mr_dt, nc );
+
+		bli_cache_scale_blksz_dt( dt, fk, kc_align, kc );
+		bli_cache_scale_blksz_dt( dt, fm, mc_align, mc );
+		bli_cache_scale_blksz_dt( dt, fn, nc_align, nc );
+	}
+}
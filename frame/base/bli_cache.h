@@ -0,0 +1,68 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_CACHE_H
+#define BLIS_CACHE_H
+
+// Return the size in bytes of the given cache level (1: L1 data, 2: L2,
+// 3: L3) as used to derive cache blocksizes, or 0 if it is unknown. The
+// values are detected via cpuid once per process and may be overridden
+// with the BLIS_L1D_CACHE_KB, BLIS_L2_CACHE_KB and BLIS_L3_CACHE_KB
+// environment variables.
+BLIS_EXPORT_BLIS dim_t bli_cache_query_size( dim_t level );
+
+void bli_cache_init_sizes_once( void );
+void bli_cache_init_sizes( void );
+
+// Rescale the MC, KC and NC blocksizes of all datatypes from the cache
+// sizes a subconfiguration was tuned for (in bytes) to the cache sizes of
+// the running machine. KC tracks the L1 data cache (which holds a micro-
+// panel of B), while MC and NC track the L2 and L3 caches that hold the
+// packed block of A and panel of B, each KC deep. Setting BLIS_CACHE_BLKSZ=0
+// in the environment keeps the compiled-in values.
+void bli_cache_scale_blkszs
+     (
+       dim_t    l1d_ref,
+       dim_t    l2_ref,
+       dim_t    l3_ref,
+       blksz_t* mr,
+       blksz_t* nr,
+       blksz_t* mc,
+       blksz_t* kc,
+       blksz_t* nc
+     );
+
+#endif
+
@@ -556,6 +556,62 @@ bool bli_cpuid_is_avx_supported( void )
 }
 
 
+// Check (at runtime) if AVX-512 (F, DQ, BW and VL subsets) is supported on the
+// current platform, this is to ensure that AVX-512 kernels which are called
+// directly (rather than via the context) are not used on platforms without
+// AVX-512, which results in crash.
+
+// The support for AVX-512 is checked only once (when this API is called first
+// time). On subsequent calls the cached value is returned.
+static bool is_avx512_supported = FALSE;
+
+// Determine if the CPU has support for AVX-512.
+void bli_cpuid_check_avx512_support( void )
+{
+	uint32_t family, model, features;
+
+	// Call the CPUID instruction and parse its results into a family id,
+	// model id, and a feature bit field.
+	bli_cpuid_query( &family, &model, &features );
+
+	// Check for expected CPU features.
+	const uint32_t expected =	FEATURE_AVX        |
+								FEATURE_FMA3       |
+								FEATURE_AVX2       |
+								FEATURE_AVX512F    |
+								FEATURE_AVX512DQ   |
+								FEATURE_AVX512BW   |
+								FEATURE_AVX512VL;
+
+	if ( !bli_cpuid_has_features( features, expected ) )
+	{
+		is_avx512_supported = FALSE;
+	}
+	else
+	{
+		is_avx512_supported = TRUE;
+	}
+}
+
+static bli_pthread_once_t once_check_avx512_support = BLIS_PTHREAD_ONCE_INIT;
+
+// Ensure that actual support determination happens only once
+void bli_cpuid_check_avx512_support_once( void )
+{
+#ifndef BLIS_CONFIGURETIME_CPUID
+	bli_pthread_once( &once_check_avx512_support,  bli_cpuid_check_avx512_support );
+#endif
+}
+
+// API to check if AVX-512 is supported or not on the current platform.
+bool bli_cpuid_is_avx512_supported( void )
+{
+	bli_cpuid_check_avx512_support_once();
+
+	return is_avx512_supported;
+}
+
+
 // Check (at runtime) if AVX512_VNNI is supported on the current platform, this
 // is to ensure that AVX512_VNNI kernels are not used on legacy platforms which
 // results in crash.
@@ -1159,6 +1215,66 @@ void get_cpu_name( char *cpu_name )
 	*( uint32_t* )&cpu_name[32+12] = edx;
 }
 
+// Query the sizes, in bytes, of the level-1 data, level-2 and level-3 caches
+// seen by the calling core. The deterministic cache parameters leaf is used
+// (0x8000001D on AMD parts with topology extensions, 0x4 otherwise). For a
+// shared cache the size of one instance is returned. Caches that are not
+// reported are returned as zero.
+void bli_cpuid_query_cache_sizes
+     (
+       uint32_t* l1d,
+       uint32_t* l2,
+       uint32_t* l3
+     )
+{
+	uint32_t eax, ebx, ecx, edx;
+	uint32_t leaf = 0;
+
+	*l1d = 0;
+	*l2  = 0;
+	*l3  = 0;
+
+	uint32_t cpuid_max     = __get_cpuid_max( 0,           0 );
+	uint32_t cpuid_max_ext = __get_cpuid_max( 0x80000000u, 0 );
+
+	// cpuid[eax=0x80000001]:ecx[22] advertises the AMD topology extensions,
+	// which include the cache properties leaf.
+	if ( cpuid_max_ext >= 0x8000001Du )
+	{
+		__cpuid( 0x80000001u, eax, ebx, ecx, edx );
+
+		if ( ecx & ( 1u << 22 ) ) leaf = 0x8000001Du;
+	}
+
+	if ( leaf == 0 && cpuid_max >= 4 ) leaf = 4;
+
+	if ( leaf == 0 ) return;
+
+	// Both leaves use the same encoding. Each subleaf describes one cache,
+	// and a cache type of zero terminates the list.
+	for ( uint32_t i = 0; i < 16; ++i )
+	{
+		__cpuid_count( leaf, i, eax, ebx, ecx, edx );
+
+		const uint32_t type = ( eax      ) & 0x1F; // 1: data, 2: instr, 3: unified
+		const uint32_t lvl  = ( eax >> 5 ) & 0x7;
+
+		if ( type == 0 ) break;
+		if ( type == 2 ) continue;
+
+		const uint32_t ways  = ( ( ebx >> 22 )         ) + 1;
+		const uint32_t parts = ( ( ebx >> 12 ) & 0x3FF ) + 1;
+		const uint32_t line  = ( ( ebx       ) & 0xFFF ) + 1;
+		const uint32_t sets  = ecx + 1;
+
+		const uint32_t size  = ways * parts * line * sets;
+
+		if      ( lvl == 1 ) *l1d = size;
+		else if ( lvl == 2 ) *l2  = size;
+		else if ( lvl == 3 ) *l3  = size;
+	}
+}
+
 // Return the number of FMA units _assuming avx512 is supported_.
 // This needs updating for new processor types, sigh.
 // See https://ark.intel.com/content/www/us/en/ark.html#@Processors
@@ -133,7 +133,9 @@ BLIS_INLINE bool bli_cpuid_has_features( uint32_t have, uint32_t want )
 
 void get_cpu_name( char *cpu_name );
 int  vpu_count( void );
+void bli_cpuid_query_cache_sizes( uint32_t* l1d, uint32_t* l2, uint32_t* l3 );
 bool bli_cpuid_is_avx_supported(void);
+bool bli_cpuid_is_avx512_supported(void);
 bool bli_cpuid_is_avx512vnni_supported(void);
 bool bli_cpuid_is_avx512_bf16_supported(void);
 
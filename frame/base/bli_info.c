@@ -167,6 +167,24 @@ gint_t bli_info_get_enable_sandbox( void )
 
 
 
+// -- Cache and blocksize-related ----------------------------------------------
+
+// The blocksize queries report the values held by the context of the running
+// subconfiguration, i.e. after any rescaling to the detected cache sizes.
+
+gint_t bli_info_get_cache_size( dim_t level )
+{ return bli_cache_query_size( level ); }
+gint_t bli_info_get_blksz_def_dt( bszid_t bs_id, num_t dt )
+{ bli_init_once(); return bli_cntx_get_blksz_def_dt( dt, bs_id, bli_gks_query_cntx() ); }
+gint_t bli_info_get_blksz_max_dt( bszid_t bs_id, num_t dt )
+{ bli_init_once(); return bli_cntx_get_blksz_max_dt( dt, bs_id, bli_gks_query_cntx() ); }
+gint_t bli_info_get_l3_sup_blksz_def_dt( bszid_t bs_id, num_t dt )
+{ bli_init_once(); return bli_cntx_get_l3_sup_blksz_def_dt( dt, bs_id, bli_gks_query_cntx() ); }
+gint_t bli_info_get_l3_sup_blksz_max_dt( bszid_t bs_id, num_t dt )
+{ bli_init_once(); return bli_cntx_get_l3_sup_blksz_max_dt( dt, bs_id, bli_gks_query_cntx() ); }
+
+
+
 // -- Kernel implementation-related --------------------------------------------
 
 
@@ -76,6 +76,15 @@ BLIS_EXPORT_BLIS gint_t bli_info_get_enable_memkind( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_enable_sandbox( void );
 
 
+// -- Cache and blocksize-related ----------------------------------------------
+
+BLIS_EXPORT_BLIS gint_t bli_info_get_cache_size( dim_t level );
+BLIS_EXPORT_BLIS gint_t bli_info_get_blksz_def_dt( bszid_t bs_id, num_t dt );
+BLIS_EXPORT_BLIS gint_t bli_info_get_blksz_max_dt( bszid_t bs_id, num_t dt );
+BLIS_EXPORT_BLIS gint_t bli_info_get_l3_sup_blksz_def_dt( bszid_t bs_id, num_t dt );
+BLIS_EXPORT_BLIS gint_t bli_info_get_l3_sup_blksz_max_dt( bszid_t bs_id, num_t dt );
+
+
 // -- Kernel implementation-related --------------------------------------------
 
 
@@ -87,6 +87,10 @@ void bli_init_apis( void )
 void bli_finalize_apis( void )
 {
 	// Finalize various sub-APIs.
+#if defined( BLIS_ENABLE_BLAS ) && defined( BLIS_ENABLE_FAST_PATH )
+	bla_fast_path_finalize();
+#endif
+	bli_l3_plan_finalize();
 	bli_memsys_finalize();
 	bli_pack_finalize();
 	bli_thread_finalize();
@@ -97,20 +101,39 @@ void bli_finalize_apis( void )
 
 // -----------------------------------------------------------------------------
 
-// A pthread_once_t variable is a pthread structure used in pthread_once().
-// pthread_once() is guaranteed to execute exactly once among all threads that
-// pass in this control object. Thus, we need one for initialization and a
-// separate one for finalization.
-static bli_pthread_once_t once_init     = BLIS_PTHREAD_ONCE_INIT;
-static bli_pthread_once_t once_finalize = BLIS_PTHREAD_ONCE_INIT;
+// The library is initialized by the first call to bli_init_once() and
+// finalized by bli_finalize_once(), after which the next call to
+// bli_init_once() initializes it again. The state is checked without taking
+// the mutex, so that the calls made on entry to every operation stay cheap
+// once the library is initialized. It is cleared only after the sub-APIs
+// are finalized, since finalizing them may reach bli_init_once().
+static bli_pthread_mutex_t init_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+static bool                is_init    = FALSE;
 
 void bli_init_once( void )
 {
-	bli_pthread_once( &once_init, bli_init_apis );
+	if ( __atomic_load_n( &is_init, __ATOMIC_ACQUIRE ) ) return;
+
+	bli_pthread_mutex_lock( &init_mutex );
+
+	if ( !is_init )
+	{
+		bli_init_apis();
+		__atomic_store_n( &is_init, TRUE, __ATOMIC_RELEASE );
+	}
+
+	bli_pthread_mutex_unlock( &init_mutex );
 }
 
 void bli_finalize_once( void )
 {
-	bli_pthread_once( &once_finalize, bli_finalize_apis );
-}
+	bli_pthread_mutex_lock( &init_mutex );
+
+	if ( is_init )
+	{
+		bli_finalize_apis();
+		__atomic_store_n( &is_init, FALSE, __ATOMIC_RELEASE );
+	}
 
+	bli_pthread_mutex_unlock( &init_mutex );
+}
@@ -264,8 +264,18 @@ void bli_rntm_set_ways_from_rntm
 
 		pc = 1;
 
-		bli_thread_partition_2x2( nt, m*BLIS_THREAD_RATIO_M,
-								  n*BLIS_THREAD_RATIO_N, &ic, &jc );
+		// If the threads are spread over several L3 domains (e.g. CCXs),
+		// give each domain its own jc groups so that each packed block of B
+		// is shared only within one domain instead of being read across
+		// domains, and factor the threads of each domain over the remaining
+		// loops. This requires each domain's share of n to be at least
+		// BLIS_AFFINITY_L3_MIN_N columns.
+		dim_t n_doms = bli_affinity_l3_domains( nt );
+
+		if ( n < n_doms * BLIS_AFFINITY_L3_MIN_N ) n_doms = 1;
+
+		bli_thread_partition_2x2( nt / n_doms, m*BLIS_THREAD_RATIO_M,
+								  ( n / n_doms )*BLIS_THREAD_RATIO_N, &ic, &jc );
 
 		for ( ir = BLIS_THREAD_MAX_IR ; ir > 1 ; ir-- )
 		{
@@ -276,6 +286,8 @@ void bli_rntm_set_ways_from_rntm
 		{
 			if ( jc % jr == 0 ) { jc /= jr; break; }
 		}
+
+		jc *= n_doms;
 	}
 	else // if ( ways_set == FALSE && nt_set == FALSE )
 	{
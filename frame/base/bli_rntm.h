@@ -50,6 +50,9 @@ typedef struct rntm_s
 	bool      pack_a;
 	bool      pack_b;
 	bool      l3_sup;
+	bool      blis_mt;
+	dim_t     strassen_levels;
+	bool      pack_b_pipeline;
 
 	pool_t*   sba_pool;
 	membrk_t* membrk;
@@ -120,6 +123,16 @@ BLIS_INLINE bool bli_rntm_l3_sup( rntm_t* rntm )
 	return rntm->l3_sup;
 }
 
+BLIS_INLINE dim_t bli_rntm_strassen_levels( rntm_t* rntm )
+{
+	return rntm->strassen_levels;
+}
+
+BLIS_INLINE bool bli_rntm_pack_b_pipeline( rntm_t* rntm )
+{
+	return rntm->pack_b_pipeline;
+}
+
 //
 // -- rntm_t query (internal use only) -----------------------------------------
 //
@@ -289,6 +302,20 @@ BLIS_INLINE void bli_rntm_disable_l3_sup( rntm_t* rntm )
 	bli_rntm_set_l3_sup( FALSE, rntm );
 }
 
+BLIS_INLINE void bli_rntm_set_strassen_levels( dim_t levels, rntm_t* rntm )
+{
+	// Set the number of levels of Strassen's algorithm applied to large
+	// real gemm problems (zero selects the conventional algorithm only).
+	rntm->strassen_levels = levels;
+}
+
+BLIS_INLINE void bli_rntm_set_pack_b_pipeline( bool pipeline, rntm_t* rntm )
+{
+	// Set the bool indicating whether the packing of each block of B is
+	// overlapped with the computation on the previous one.
+	rntm->pack_b_pipeline = pipeline;
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -305,6 +332,14 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
 {
 	bli_rntm_set_l3_sup( TRUE, rntm );
 }
+BLIS_INLINE void bli_rntm_clear_strassen_levels( rntm_t* rntm )
+{
+	bli_rntm_set_strassen_levels( 0, rntm );
+}
+BLIS_INLINE void bli_rntm_clear_pack_b_pipeline( rntm_t* rntm )
+{
+	bli_rntm_set_pack_b_pipeline( FALSE, rntm );
+}
 
 //
 // -- rntm_t initialization ----------------------------------------------------
@@ -322,6 +357,8 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
           .pack_a      = FALSE, \
           .pack_b      = FALSE, \
           .l3_sup      = TRUE, \
+          .strassen_levels = 0, \
+          .pack_b_pipeline = FALSE, \
           .sba_pool    = NULL, \
           .membrk      = NULL, \
         }  \
@@ -335,6 +372,8 @@ BLIS_INLINE void bli_rntm_init( rntm_t* rntm )
 	bli_rntm_clear_pack_a( rntm );
 	bli_rntm_clear_pack_b( rntm );
 	bli_rntm_clear_l3_sup( rntm );
+	bli_rntm_clear_strassen_levels( rntm );
+	bli_rntm_clear_pack_b_pipeline( rntm );
 
 	bli_rntm_clear_sba_pool( rntm );
 	bli_rntm_clear_membrk( rntm );
@@ -193,6 +193,32 @@ void daxpy_
   inc_t  incx0;
   inc_t  incy0;
 
+#ifdef BLIS_ENABLE_FAST_PATH
+  /* Short vectors with positive increments go straight to the context's
+     kernel, skipping tracing and the cpuid query. */
+  if ( *n <= BLA_FAST_PATH_MAX_DIM && *incx > 0 && *incy > 0 )
+    {
+      cntx_t* cntx = bla_fast_path_cntx();
+
+      if ( cntx != NULL )
+        {
+          daxpyv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DOUBLE, BLIS_AXPYV_KER, cntx );
+
+          f
+          (
+            BLIS_NO_CONJUGATE,
+            bli_max( *n, 0 ),
+            ( double* )alpha,
+            ( double* )x, *incx,
+            y, *incy,
+            cntx
+          );
+
+          return;
+        }
+    }
+#endif
+
   AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_1)
   AOCL_DTL_LOG_AXPY_INPUTS(AOCL_DTL_LEVEL_TRACE_1, 'D', *n, (double*)alpha, *incx, *incy)
   /* Initialize BLIS. */
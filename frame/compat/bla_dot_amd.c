@@ -198,6 +198,35 @@ double ddot_
        const double*   y, const f77_int* incy
      )
 {
+#ifdef BLIS_ENABLE_FAST_PATH
+    /* Short vectors with positive increments go straight to the context's
+       kernel, skipping tracing and the cpuid query. */
+    if ( *n <= BLA_FAST_PATH_MAX_DIM && *incx > 0 && *incy > 0 )
+    {
+        cntx_t* cntx = bla_fast_path_cntx();
+
+        if ( cntx != NULL )
+        {
+            double rho;
+
+            ddotv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DOUBLE, BLIS_DOTV_KER, cntx );
+
+            f
+            (
+              BLIS_NO_CONJUGATE,
+              BLIS_NO_CONJUGATE,
+              bli_max( *n, 0 ),
+              ( double* )x, *incx,
+              ( double* )y, *incy,
+              &rho,
+              cntx
+            );
+
+            return rho;
+        }
+    }
+#endif
+
     AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_1);
     AOCL_DTL_LOG_DOTV_INPUTS(AOCL_DTL_LEVEL_TRACE_1, 'D', *n, *incx, *incy);
     dim_t  n0;
@@ -0,0 +1,86 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#if defined( BLIS_ENABLE_BLAS ) && defined( BLIS_ENABLE_FAST_PATH )
+
+BLIS_THREAD_LOCAL cntx_t* bla_fast_path_cntx_cache = NULL;
+BLIS_THREAD_LOCAL siz_t   bla_fast_path_cntx_gen   = 0;
+
+// Starts at one so that no thread's cache is current before it is filled.
+// Accessed with __atomic builtins: bli_finalize() advances it with release
+// semantics before the contexts are freed, and readers load it with acquire
+// semantics.
+siz_t                     bla_fast_path_gen        = 1;
+
+// The runtime switch is read from the environment only once per process.
+static bool               bla_fast_path_is_enabled = FALSE;
+static bli_pthread_once_t bla_fast_path_once       = BLIS_PTHREAD_ONCE_INIT;
+
+static void bla_fast_path_init_enabled( void )
+{
+	bla_fast_path_is_enabled = ( bli_env_get_var( "BLIS_FAST_PATH", 1 ) != 0 );
+}
+
+cntx_t* bla_fast_path_cntx_init( void )
+{
+	bli_pthread_once( &bla_fast_path_once, bla_fast_path_init_enabled );
+
+	if ( !bla_fast_path_is_enabled ) return NULL;
+
+	// Initialize BLIS (again, if it was finalized since this thread last
+	// filled its cache) on behalf of every later fast-path call made by
+	// this thread, then cache the context they will use.
+	bli_init_auto();
+
+	bla_fast_path_cntx_cache = bli_gks_query_cntx();
+	bla_fast_path_cntx_gen   = __atomic_load_n( &bla_fast_path_gen, __ATOMIC_ACQUIRE );
+
+	return bla_fast_path_cntx_cache;
+}
+
+void bla_fast_path_finalize( void )
+{
+	// The contexts are about to be freed. Invalidate the pointers cached by
+	// every thread, which cannot be reached from here, by advancing the
+	// generation they were cached in. The next fast-path call on each
+	// thread initializes BLIS again and refills its cache.
+	__atomic_fetch_add( &bla_fast_path_gen, 1, __ATOMIC_RELEASE );
+
+	bla_fast_path_cntx_cache = NULL;
+}
+
+#endif
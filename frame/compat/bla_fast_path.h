@@ -0,0 +1,70 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifdef BLIS_ENABLE_FAST_PATH
+
+// Largest problem dimension served by the fast path. Larger problems take
+// the regular entry path, where the prologue cost is negligible relative to
+// the arithmetic.
+#define BLA_FAST_PATH_MAX_DIM 32
+
+// The context pointer cached by the calling thread, or NULL if the thread
+// has not yet entered the fast path or the fast path was disabled at
+// runtime via BLIS_FAST_PATH=0. The pointer is valid only while the
+// generation it was cached in matches bla_fast_path_gen, which
+// bli_finalize() advances before the contexts are freed.
+extern BLIS_THREAD_LOCAL cntx_t* bla_fast_path_cntx_cache;
+extern BLIS_THREAD_LOCAL siz_t   bla_fast_path_cntx_gen;
+extern                   siz_t   bla_fast_path_gen;
+
+cntx_t* bla_fast_path_cntx_init( void );
+void    bla_fast_path_finalize( void );
+
+// Return the context to be used by the fast path on the calling thread, or
+// NULL if the fast path is disabled. The first call on each thread, and the
+// first after each bli_finalize(), initializes BLIS and queries the context;
+// subsequent calls only read a thread-local pointer and compare generations.
+BLIS_INLINE cntx_t* bla_fast_path_cntx( void )
+{
+	cntx_t* cntx = bla_fast_path_cntx_cache;
+
+	if ( cntx != NULL && bla_fast_path_cntx_gen ==
+	     __atomic_load_n( &bla_fast_path_gen, __ATOMIC_ACQUIRE ) )
+		return cntx;
+
+	return bla_fast_path_cntx_init();
+}
+
+#endif
@@ -427,4 +427,88 @@ void dzgemm_
 	bli_finalize_auto();
 }// end of dzgemm_
 
+void dsgemm_
+     (
+       const f77_char* transa,
+       const f77_char* transb,
+       const f77_int*  m,
+       const f77_int*  n,
+       const f77_int*  k,
+       const double*   alpha,
+       const float*    a, const f77_int* lda,
+       const float*    b, const f77_int* ldb,
+       const double*   beta,
+             double*   c, const f77_int* ldc
+     )
+{
+    trans_t blis_transa;
+    trans_t blis_transb;
+    dim_t   m0, n0, k0;
+
+    /* Initialize BLIS. */
+    bli_init_auto();
+
+    AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_1)
+    AOCL_DTL_LOG_GEMM_INPUTS(AOCL_DTL_LEVEL_TRACE_1, *MKSTR(d), *transa, *transb, *m, *n, *k,
+                (void*)alpha, *lda, *ldb, (void*)beta, *ldc);
+
+    /* Perform BLAS parameter checking. */
+    PASTEBLACHK(gemm)
+    (
+      MKSTR(d),
+      MKSTR(dsgemm),
+      transa,
+      transb,
+      m,
+      n,
+      k,
+      lda,
+      ldb,
+      ldc
+    );
+
+    /* Quick return if possible. */
+    if ( *m == 0 || *n == 0 || (( PASTEMAC(d,eq0)( *alpha ) || *k == 0)
+       && PASTEMAC(d,eq1)( *beta ) ))
+    {
+        AOCL_DTL_LOG_GEMM_STATS(AOCL_DTL_LEVEL_TRACE_1, *m, *n, *k);
+        AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
+        /* Finalize BLIS. */
+        bli_finalize_auto();
+        return;
+    }
+
+    /* Map BLAS chars to their corresponding BLIS enumerated type value. */
+    bli_param_map_netlib_to_blis_trans( *transa, &blis_transa );
+    bli_param_map_netlib_to_blis_trans( *transb, &blis_transb );
+
+    /* Typecast BLAS integers to BLIS integers. */
+    bli_convert_blas_dim1( *m, m0 );
+    bli_convert_blas_dim1( *n, n0 );
+    bli_convert_blas_dim1( *k, k0 );
+
+    /* Promote A and B to double precision panel by panel and let the
+       double-precision gemm (including its sup path) do the work. */
+    bli_gemm_promote_sd
+    (
+      blis_transa,
+      blis_transb,
+      m0,
+      n0,
+      k0,
+      (double*)alpha,
+      (float*)a, 1, *lda,
+      (float*)b, 1, *ldb,
+      (double*)beta,
+      c, 1, *ldc,
+      NULL,
+      NULL
+    );
+
+    AOCL_DTL_LOG_GEMM_STATS(AOCL_DTL_LEVEL_TRACE_1, *m, *n, *k);
+    AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1)
+    /* Finalize BLIS. */
+    bli_finalize_auto();
+}// end of dsgemm_
+
 #endif
@@ -70,6 +70,19 @@ BLIS_EXPORT_BLAS void dzgemm_
              dcomplex*    c, const f77_int* ldc  \
      );
 #endif
+BLIS_EXPORT_BLAS void dsgemm_
+     (
+       const f77_char* transa,
+       const f77_char* transb,
+       const f77_int*  m,
+       const f77_int*  n,
+       const f77_int*  k,
+       const double*   alpha,
+       const float*    a, const f77_int* lda,
+       const float*    b, const f77_int* ldb,
+       const double*   beta,
+             double*   c, const f77_int* ldc
+     );
 INSERT_GENTPROT_BLAS( gemm )
 
 #endif
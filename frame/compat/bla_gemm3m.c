@@ -102,6 +102,30 @@ void PASTEF77(ch,blasname) \
     bli_convert_blas_dim1( *m, m0 ); \
     bli_convert_blas_dim1( *n, n0 ); \
     bli_convert_blas_dim1( *k, k0 ); \
+\
+    /* Large problems are computed with three real matrix products per
+       block instead of four. */ \
+    if ( PASTEMAC(ch,gemm3m_blk_is_profitable)( m0, n0, k0 ) ) \
+    { \
+        PASTEMAC(ch,gemm3m_blk) \
+        ( \
+          blis_transa, \
+          blis_transb, \
+          m0, \
+          n0, \
+          k0, \
+          (ftype*)alpha, \
+          (ftype*)a, *lda, \
+          (ftype*)b, *ldb, \
+          (ftype*)beta, \
+          (ftype*)c, *ldc  \
+        ); \
+\
+        AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1) \
+        /* Finalize BLIS. */ \
+        bli_finalize_auto(); \
+        return; \
+    } \
 \
     /* Set the row and column strides of the matrix operands. */ \
     rs_a = 1; \
@@ -193,6 +217,30 @@ void PASTEF77(ch,blasname) \
     bli_convert_blas_dim1( *m, m0 ); \
     bli_convert_blas_dim1( *n, n0 ); \
     bli_convert_blas_dim1( *k, k0 ); \
+\
+    /* Large problems are computed with three real matrix products per
+       block instead of four. */ \
+    if ( PASTEMAC(ch,gemm3m_blk_is_profitable)( m0, n0, k0 ) ) \
+    { \
+        PASTEMAC(ch,gemm3m_blk) \
+        ( \
+          blis_transa, \
+          blis_transb, \
+          m0, \
+          n0, \
+          k0, \
+          (ftype*)alpha, \
+          (ftype*)a, *lda, \
+          (ftype*)b, *ldb, \
+          (ftype*)beta, \
+          (ftype*)c, *ldc  \
+        ); \
+\
+        AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_INFO) \
+        /* Finalize BLIS. */ \
+        bli_finalize_auto(); \
+        return; \
+    } \
 \
     /* Set the row and column strides of the matrix operands. */ \
     const inc_t rs_a = 1; \
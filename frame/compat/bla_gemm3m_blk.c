@@ -0,0 +1,457 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_BLAS
+
+// Dimensions of the blocks in which the product is computed. For each
+// block of k, the m x kc panel of op( a ) and the kc x n panel of op( b )
+// are split once into three real copies (real part, imaginary part and
+// their sum). Each mc x nc block of c then takes three real products of the
+// copies, which are merged into c before moving on to the next block; the
+// first block of k applies beta and the others accumulate. kc is reduced,
+// though not below BLIS_GEMM3M_KC_MIN, to keep the split panels within
+// BLIS_GEMM3M_PANEL_MAX real elements.
+#define BLIS_GEMM3M_MC               512
+#define BLIS_GEMM3M_NC               512
+#define BLIS_GEMM3M_KC               512
+#define BLIS_GEMM3M_KC_MIN           128
+#define BLIS_GEMM3M_PANEL_MAX        ( 4 * 1024 * 1024 )
+
+// Smallest m, n and k for which the 3M algorithm is used. Below this size the
+// splitting and merging passes cost more than the 25% of the flops that the
+// third real product saves, and the native complex gemm is faster.
+#define BLIS_GEMM3M_MIN_DIM          256
+
+// Blocks with fewer elements than this are split and merged by the calling
+// thread alone.
+#define BLIS_GEMM3M_MT_THRESH        ( 256 * 256 )
+
+//
+// Split the columns [j_start, j_end) of the m x n matrix op( x ) into its real
+// part xr, its imaginary part xi and their sum xs, each stored column-major
+// with leading dimension ld. A transposed source is read along its columns so
+// that the loads stay contiguous in both cases.
+//
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       trans_t            transx, \
+       dim_t              m, \
+       ctype*   restrict  x, inc_t ldx, \
+       ctype_r* restrict  xr, \
+       ctype_r* restrict  xi, \
+       ctype_r* restrict  xs, inc_t ld, \
+       dim_t              j_start, \
+       dim_t              j_end  \
+     ) \
+{ \
+	const ctype_r sign = bli_does_conj( transx ) ? -1.0 : 1.0; \
+\
+	if ( bli_does_notrans( transx ) ) \
+	{ \
+		for ( dim_t j = j_start; j < j_end; ++j ) \
+		{ \
+			ctype*   restrict xj  = x  + j*ldx; \
+			ctype_r* restrict xrj = xr + j*ld; \
+			ctype_r* restrict xij = xi + j*ld; \
+			ctype_r* restrict xsj = xs + j*ld; \
+\
+			for ( dim_t i = 0; i < m; ++i ) \
+			{ \
+				const ctype_r re = PASTEMAC(ch,real)( xj[ i ] ); \
+				const ctype_r im = sign * PASTEMAC(ch,imag)( xj[ i ] ); \
+\
+				xrj[ i ] = re; \
+				xij[ i ] = im; \
+				xsj[ i ] = re + im; \
+			} \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			ctype* restrict xi_t = x + i*ldx; \
+\
+			for ( dim_t j = j_start; j < j_end; ++j ) \
+			{ \
+				const ctype_r re = PASTEMAC(ch,real)( xi_t[ j ] ); \
+				const ctype_r im = sign * PASTEMAC(ch,imag)( xi_t[ j ] ); \
+\
+				xr[ i + j*ld ] = re; \
+				xi[ i + j*ld ] = im; \
+				xs[ i + j*ld ] = re + im; \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCCO_BASIC0( gemm3m_split )
+
+//
+// Merge the columns [j_start, j_end) of the three real products
+//   t1 = re( a ) re( b ), t2 = im( a ) im( b ), t3 = ( re( a ) + im( a ) )
+//   ( re( b ) + im( b ) )
+// into c := beta * c + alpha * ( ( t1 - t2 ) + i ( t3 - t1 - t2 ) ).
+//
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t              m, \
+       ctype*   restrict  alpha, \
+       ctype_r* restrict  t1, \
+       ctype_r* restrict  t2, \
+       ctype_r* restrict  t3, inc_t ld, \
+       ctype*   restrict  beta, \
+       ctype*   restrict  c, inc_t ldc, \
+       dim_t              j_start, \
+       dim_t              j_end  \
+     ) \
+{ \
+	const bool beta0 = PASTEMAC(ch,eq0)( *beta ); \
+	ctype      ab; \
+\
+	for ( dim_t j = j_start; j < j_end; ++j ) \
+	{ \
+		ctype_r* restrict t1j = t1 + j*ld; \
+		ctype_r* restrict t2j = t2 + j*ld; \
+		ctype_r* restrict t3j = t3 + j*ld; \
+		ctype*   restrict cj  = c  + j*ldc; \
+\
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			PASTEMAC(ch,sets) \
+			( \
+			  t1j[ i ] - t2j[ i ], \
+			  t3j[ i ] - t1j[ i ] - t2j[ i ], \
+			  ab \
+			); \
+\
+			if ( beta0 ) \
+			{ \
+				PASTEMAC(ch,scal2s)( *alpha, ab, cj[ i ] ); \
+			} \
+			else \
+			{ \
+				PASTEMAC(ch,scals)( *beta, cj[ i ] ); \
+				PASTEMAC(ch,axpys)( *alpha, ab, cj[ i ] ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCCO_BASIC0( gemm3m_merge )
+
+//
+// Distribute the columns of the split and merge passes across threads.
+//
+
+#ifdef BLIS_ENABLE_OPENMP
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       trans_t   transx, \
+       dim_t     m, \
+       dim_t     n, \
+       ctype*    x, inc_t ldx, \
+       ctype_r*  xr, \
+       ctype_r*  xi, \
+       ctype_r*  xs, inc_t ld, \
+       dim_t     n_threads  \
+     ) \
+{ \
+	if ( n_threads == 1 || m * n < BLIS_GEMM3M_MT_THRESH ) \
+	{ \
+		PASTEMAC(ch,gemm3m_split)( transx, m, x, ldx, xr, xi, xs, ld, 0, n ); \
+		return; \
+	} \
+\
+	_Pragma( "omp parallel num_threads(n_threads)" ) \
+	{ \
+		thrinfo_t thread; \
+		dim_t     j_start; \
+		dim_t     j_end; \
+\
+		thread.n_way   = omp_get_num_threads(); \
+		thread.work_id = omp_get_thread_num(); \
+\
+		bli_thread_range_sub( &thread, n, 1, FALSE, &j_start, &j_end ); \
+\
+		PASTEMAC(ch,gemm3m_split) \
+		( \
+		  transx, m, x, ldx, xr, xi, xs, ld, j_start, j_end \
+		); \
+	} \
+}
+
+INSERT_GENTFUNCCO_BASIC0( gemm3m_split_mt )
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t     m, \
+       dim_t     n, \
+       ctype*    alpha, \
+       ctype_r*  t1, \
+       ctype_r*  t2, \
+       ctype_r*  t3, inc_t ld, \
+       ctype*    beta, \
+       ctype*    c, inc_t ldc, \
+       dim_t     n_threads  \
+     ) \
+{ \
+	if ( n_threads == 1 || m * n < BLIS_GEMM3M_MT_THRESH ) \
+	{ \
+		PASTEMAC(ch,gemm3m_merge)( m, alpha, t1, t2, t3, ld, beta, c, ldc, 0, n ); \
+		return; \
+	} \
+\
+	_Pragma( "omp parallel num_threads(n_threads)" ) \
+	{ \
+		thrinfo_t thread; \
+		dim_t     j_start; \
+		dim_t     j_end; \
+\
+		thread.n_way   = omp_get_num_threads(); \
+		thread.work_id = omp_get_thread_num(); \
+\
+		bli_thread_range_sub( &thread, n, 1, FALSE, &j_start, &j_end ); \
+\
+		PASTEMAC(ch,gemm3m_merge) \
+		( \
+		  m, alpha, t1, t2, t3, ld, beta, c, ldc, j_start, j_end \
+		); \
+	} \
+}
+
+INSERT_GENTFUNCCO_BASIC0( gemm3m_merge_mt )
+
+#else
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       trans_t   transx, \
+       dim_t     m, \
+       dim_t     n, \
+       ctype*    x, inc_t ldx, \
+       ctype_r*  xr, \
+       ctype_r*  xi, \
+       ctype_r*  xs, inc_t ld, \
+       dim_t     n_threads  \
+     ) \
+{ \
+	PASTEMAC(ch,gemm3m_split)( transx, m, x, ldx, xr, xi, xs, ld, 0, n ); \
+}
+
+INSERT_GENTFUNCCO_BASIC0( gemm3m_split_mt )
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t     m, \
+       dim_t     n, \
+       ctype*    alpha, \
+       ctype_r*  t1, \
+       ctype_r*  t2, \
+       ctype_r*  t3, inc_t ld, \
+       ctype*    beta, \
+       ctype*    c, inc_t ldc, \
+       dim_t     n_threads  \
+     ) \
+{ \
+	PASTEMAC(ch,gemm3m_merge)( m, alpha, t1, t2, t3, ld, beta, c, ldc, 0, n ); \
+}
+
+INSERT_GENTFUNCCO_BASIC0( gemm3m_merge_mt )
+
+#endif
+
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname ) \
+\
+bool PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k  \
+     ) \
+{ \
+	return ( m >= BLIS_GEMM3M_MIN_DIM && \
+	         n >= BLIS_GEMM3M_MIN_DIM && \
+	         k >= BLIS_GEMM3M_MIN_DIM ); \
+}
+
+INSERT_GENTFUNCCO_BASIC0( gemm3m_blk_is_profitable )
+
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  b, inc_t ldb, \
+       ctype*  beta, \
+       ctype*  c, inc_t ldc  \
+     ) \
+{ \
+	AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2); \
+\
+	if ( bli_zero_dim2( m, n ) ) \
+	{ \
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2); \
+		return; \
+	} \
+\
+	ctype_r* one_r  = PASTEMAC(chr,1); \
+	ctype_r* zero_r = PASTEMAC(chr,0); \
+\
+	const dim_t mc_max = bli_min( m, BLIS_GEMM3M_MC ); \
+	const dim_t nc_max = bli_min( n, BLIS_GEMM3M_NC ); \
+\
+	dim_t kc_blk = BLIS_GEMM3M_PANEL_MAX / ( 3 * ( m + n ) ); \
+	kc_blk = bli_max( BLIS_GEMM3M_KC_MIN, bli_min( BLIS_GEMM3M_KC, kc_blk ) ); \
+	kc_blk = bli_max( 1, bli_min( k, kc_blk ) ); \
+\
+	/* Carve the three copies of each operand panel and the three products
+	   out of one allocation. */ \
+	const dim_t sz_a = m * kc_blk; \
+	const dim_t sz_b = kc_blk * n; \
+	const dim_t sz_c = mc_max * nc_max; \
+\
+	ctype_r* ar = bli_malloc_user( 3 * ( sz_a + sz_b + sz_c ) * sizeof( ctype_r ) ); \
+	ctype_r* ai = ar + sz_a; \
+	ctype_r* as = ai + sz_a; \
+	ctype_r* br = as + sz_a; \
+	ctype_r* bi = br + sz_b; \
+	ctype_r* bs = bi + sz_b; \
+	ctype_r* t1 = bs + sz_b; \
+	ctype_r* t2 = t1 + sz_c; \
+	ctype_r* t3 = t2 + sz_c; \
+\
+	rntm_t rntm; \
+	bli_rntm_init_from_global( &rntm ); \
+\
+	const dim_t n_threads = bli_max( 1, bli_rntm_num_threads( &rntm ) ); \
+\
+	for ( dim_t pc = 0; pc < k; pc += kc_blk ) \
+	{ \
+		const dim_t kc = bli_min( k - pc, kc_blk ); \
+\
+		ctype* a_pan = bli_does_trans( transa ) ? a + pc : a + pc*lda; \
+		ctype* b_pan = bli_does_trans( transb ) ? b + pc*ldb : b + pc; \
+\
+		PASTEMAC(ch,gemm3m_split_mt) \
+		( \
+		  transa, m, kc, a_pan, lda, ar, ai, as, m, n_threads \
+		); \
+		PASTEMAC(ch,gemm3m_split_mt) \
+		( \
+		  transb, kc, n, b_pan, ldb, br, bi, bs, kc, n_threads \
+		); \
+\
+		/* The first block of k scales c by beta; the remaining blocks
+		   accumulate into it. */ \
+		ctype* beta_c = ( pc == 0 ? beta : PASTEMAC(ch,1) ); \
+\
+		for ( dim_t jc = 0; jc < n; jc += BLIS_GEMM3M_NC ) \
+		{ \
+			const dim_t nc = bli_min( n - jc, BLIS_GEMM3M_NC ); \
+\
+			for ( dim_t ic = 0; ic < m; ic += BLIS_GEMM3M_MC ) \
+			{ \
+				const dim_t mc = bli_min( m - ic, BLIS_GEMM3M_MC ); \
+\
+				PASTEMAC2(chr,gemm,BLIS_TAPI_EX_SUF) \
+				( \
+				  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, mc, nc, kc, \
+				  one_r, ar + ic, 1, m, br + jc*kc, 1, kc, \
+				  zero_r, t1, 1, mc, NULL, NULL \
+				); \
+				PASTEMAC2(chr,gemm,BLIS_TAPI_EX_SUF) \
+				( \
+				  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, mc, nc, kc, \
+				  one_r, ai + ic, 1, m, bi + jc*kc, 1, kc, \
+				  zero_r, t2, 1, mc, NULL, NULL \
+				); \
+				PASTEMAC2(chr,gemm,BLIS_TAPI_EX_SUF) \
+				( \
+				  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, mc, nc, kc, \
+				  one_r, as + ic, 1, m, bs + jc*kc, 1, kc, \
+				  zero_r, t3, 1, mc, NULL, NULL \
+				); \
+\
+				PASTEMAC(ch,gemm3m_merge_mt) \
+				( \
+				  mc, nc, alpha, t1, t2, t3, mc, beta_c, c + ic + jc*ldc, ldc, \
+				  n_threads \
+				); \
+			} \
+		} \
+	} \
+\
+	bli_free_user( ar ); \
+\
+	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2); \
+}
+
+INSERT_GENTFUNCCO_BASIC0( gemm3m_blk )
+
+#endif
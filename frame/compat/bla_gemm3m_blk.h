@@ -0,0 +1,84 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Prototype the 3M complex matrix multiplication used by ?gemm3m_.
+//
+
+#ifdef BLIS_ENABLE_BLAS
+
+// Compute c := beta * c + alpha * transa( a ) * transb( b ) using three real
+// matrix products per block (Karatsuba's method) instead of the four implied
+// by the complex product. Each block of a and b is split into its real part,
+// imaginary part and their sum, the three products are computed by the real
+// gemm (and thus by the real microkernels), and the results are combined
+// into c in a single fused pass. All operands are column-major, and k must
+// be positive.
+
+#undef  GENTPROTCO
+#define GENTPROTCO( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  b, inc_t ldb, \
+       ctype*  beta, \
+       ctype*  c, inc_t ldc  \
+     );
+
+INSERT_GENTPROTCO_BASIC0( gemm3m_blk )
+
+// Return TRUE if an m x n x k problem is large enough for the 3M algorithm
+// to outrun the native complex gemm.
+
+#undef  GENTPROTCO
+#define GENTPROTCO( ctype, ctype_r, ch, chr, opname ) \
+\
+bool PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k  \
+     );
+
+INSERT_GENTPROTCO_BASIC0( gemm3m_blk_is_profitable )
+
+#endif
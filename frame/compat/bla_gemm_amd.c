@@ -322,6 +322,141 @@ void PASTEF77(ch,blasname) \
 #endif
 
 #ifdef BLIS_ENABLE_BLAS
+#ifdef BLIS_ENABLE_FAST_PATH
+// Compute a tiny dgemm directly with the sup millikernels, bypassing the
+// prologue of dgemm_(). Only well-formed calls are accepted so that argument
+// errors are still reported by the checks on the regular path. Returns TRUE
+// if the operation was performed.
+static bool bla_dgemm_fast_path
+     (
+       const f77_char* transa,
+       const f77_char* transb,
+       const f77_int*  m,
+       const f77_int*  n,
+       const f77_int*  k,
+       const double*   alpha,
+       const double*   a, const f77_int* lda,
+       const double*   b, const f77_int* ldb,
+       const double*   beta,
+             double*   c, const f77_int* ldc
+     )
+{
+	const f77_int m0 = *m;
+	const f77_int n0 = *n;
+	const f77_int k0 = *k;
+
+	if ( m0 < 0 || m0 > BLA_FAST_PATH_MAX_DIM ||
+	     n0 < 0 || n0 > BLA_FAST_PATH_MAX_DIM ||
+	     k0 < 0 || k0 > BLA_FAST_PATH_MAX_DIM ) return FALSE;
+
+	bool ta, tb;
+
+	switch ( *transa )
+	{
+		case 'N': case 'n':                     ta = FALSE; break;
+		case 'T': case 't': case 'C': case 'c': ta = TRUE;  break;
+		default: return FALSE;
+	}
+	switch ( *transb )
+	{
+		case 'N': case 'n':                     tb = FALSE; break;
+		case 'T': case 't': case 'C': case 'c': tb = TRUE;  break;
+		default: return FALSE;
+	}
+
+	const f77_int nrowa = ( ta ? k0 : m0 );
+	const f77_int nrowb = ( tb ? n0 : k0 );
+
+	if ( *lda < bli_max( 1, nrowa ) ||
+	     *ldb < bli_max( 1, nrowb ) ||
+	     *ldc < bli_max( 1, m0 ) ) return FALSE;
+
+	cntx_t* cntx = bla_fast_path_cntx();
+
+	if ( cntx == NULL ) return FALSE;
+
+	// Absorb any transposition into the strides of A and B.
+	inc_t rs_a = 1, cs_a = *lda;
+	inc_t rs_b = 1, cs_b = *ldb;
+
+	if ( ta ) bli_swap_incs( &rs_a, &cs_a );
+	if ( tb ) bli_swap_incs( &rs_b, &cs_b );
+
+	err_t status = bli_dgemmsup_direct
+	(
+	  BLIS_NO_CONJUGATE,
+	  BLIS_NO_CONJUGATE,
+	  m0, n0, k0,
+	  ( double* )alpha,
+	  ( double* )a, rs_a, cs_a,
+	  ( double* )b, rs_b, cs_b,
+	  ( double* )beta,
+	  c, 1, *ldc,
+	  cntx
+	);
+
+	return ( status == BLIS_SUCCESS );
+}
+#endif
+
+// Compute a dgemm with one of the strategies chosen by the online tuner.
+// Returns an error code, leaving C untouched, if the strategy declines the
+// problem.
+static err_t bla_dgemm_tune_exec
+     (
+       l3tune_t strat,
+       obj_t*   alphao,
+       obj_t*   ao,
+       obj_t*   bo,
+       obj_t*   betao,
+       obj_t*   co
+     )
+{
+	cntx_t*     cntx;
+	rntm_t      rntm_l;
+	gemmsup_oft gemmsup_fp;
+
+	switch ( strat )
+	{
+		case BLIS_L3_TUNE_SMALL:
+#ifdef BLIS_ENABLE_SMALL_MATRIX
+			if ( bli_obj_has_trans( ao ) )
+				return bli_dgemm_small_At( alphao, ao, bo, betao, co, NULL, NULL );
+			else
+				return bli_dgemm_small( alphao, ao, bo, betao, co, NULL, NULL );
+#else
+			return BLIS_NOT_YET_IMPLEMENTED;
+#endif
+
+		case BLIS_L3_TUNE_SUP:
+		case BLIS_L3_TUNE_SUP_PACKED:
+#ifdef BLIS_DISABLE_SUP_HANDLING
+			return BLIS_NOT_YET_IMPLEMENTED;
+#else
+			// Invoke the sup handler directly, since the sup thresholds
+			// checked by bli_gemmsup() are what the tuner replaces.
+			cntx = bli_gks_query_cntx();
+			gemmsup_fp = bli_cntx_get_l3_sup_handler( BLIS_GEMM, cntx );
+			bli_rntm_init_from_global( &rntm_l );
+
+			if ( strat == BLIS_L3_TUNE_SUP_PACKED )
+			{
+				bli_rntm_set_pack_a( TRUE, &rntm_l );
+				bli_rntm_set_pack_b( TRUE, &rntm_l );
+			}
+
+			return gemmsup_fp( alphao, ao, bo, betao, co, cntx, &rntm_l );
+#endif
+
+		case BLIS_L3_TUNE_NATIVE:
+			bli_gemmnat( alphao, ao, bo, betao, co, NULL, NULL );
+			return BLIS_SUCCESS;
+
+		default:
+			return BLIS_FAILURE;
+	}
+}
+
 void dgemm_
 (
     const f77_char* transa,
@@ -343,6 +478,13 @@ void dgemm_
   trans_t blis_transb;
   dim_t   m0, n0, k0;
 
+#ifdef BLIS_ENABLE_FAST_PATH
+  /* Tiny problems skip initialization, tracing and object creation. */
+  if ( bla_dgemm_fast_path( transa, transb, m, n, k, alpha,
+                            a, lda, b, ldb, beta, c, ldc ) )
+      return;
+#endif
+
   /* Initialize BLIS. */
   bli_init_auto();
 
@@ -554,6 +696,36 @@ void dgemm_
     bli_obj_set_conjtrans(blis_transa, &ao);
     bli_obj_set_conjtrans(blis_transb, &bo);
 
+    // When online tuning is enabled, use the strategy that has been found to
+    // be fastest for this shape, or time the next candidate if the shape is
+    // still being tuned.
+    if (bli_l3_tune_is_enabled())
+    {
+        l3tune_entry_t* trial;
+        l3tune_t strat = bli_l3_tune_query(BLIS_GEMM, dt, blis_transa, blis_transb,
+                                           m0, n0, k0, bli_thread_get_num_threads(),
+                                           &trial);
+
+        if (strat != BLIS_L3_TUNE_DEFAULT)
+        {
+            double t0 = (trial != NULL) ? bli_clock() : 0.0;
+
+            err_t status = bla_dgemm_tune_exec(strat, &alphao, &ao, &bo, &betao, &co);
+
+            if (trial != NULL)
+                bli_l3_tune_record(trial, strat, status, bli_clock() - t0);
+
+            if (status == BLIS_SUCCESS)
+            {
+                AOCL_DTL_LOG_GEMM_STATS(AOCL_DTL_LEVEL_TRACE_1, *m, *n, *k);
+                AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
+                /* Finalize BLIS. */
+                bli_finalize_auto();
+                return;
+            }
+        }
+    }
+
     //cntx_t* cntx = bli_gks_query_cntx();
     //dim_t nt = bli_thread_get_num_threads(); // get number of threads
     bool nt = bli_thread_get_is_parallel(); // Check if parallel dgemm is invoked.
@@ -989,4 +1161,88 @@ void dzgemm_
     bli_finalize_auto();
 }// end of dzgemm_
 
+void dsgemm_
+     (
+       const f77_char* transa,
+       const f77_char* transb,
+       const f77_int*  m,
+       const f77_int*  n,
+       const f77_int*  k,
+       const double*   alpha,
+       const float*    a, const f77_int* lda,
+       const float*    b, const f77_int* ldb,
+       const double*   beta,
+             double*   c, const f77_int* ldc
+     )
+{
+    trans_t blis_transa;
+    trans_t blis_transb;
+    dim_t   m0, n0, k0;
+
+    /* Initialize BLIS. */
+    bli_init_auto();
+
+    AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_1)
+    AOCL_DTL_LOG_GEMM_INPUTS(AOCL_DTL_LEVEL_TRACE_1, *MKSTR(d), *transa, *transb, *m, *n, *k,
+                (void*)alpha, *lda, *ldb, (void*)beta, *ldc);
+
+    /* Perform BLAS parameter checking. */
+    PASTEBLACHK(gemm)
+    (
+      MKSTR(d),
+      MKSTR(dsgemm),
+      transa,
+      transb,
+      m,
+      n,
+      k,
+      lda,
+      ldb,
+      ldc
+    );
+
+    /* Quick return if possible. */
+    if ( *m == 0 || *n == 0 || (( PASTEMAC(d,eq0)( *alpha ) || *k == 0)
+       && PASTEMAC(d,eq1)( *beta ) ))
+    {
+        AOCL_DTL_LOG_GEMM_STATS(AOCL_DTL_LEVEL_TRACE_1, *m, *n, *k);
+        AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
+        /* Finalize BLIS. */
+        bli_finalize_auto();
+        return;
+    }
+
+    /* Map BLAS chars to their corresponding BLIS enumerated type value. */
+    bli_param_map_netlib_to_blis_trans( *transa, &blis_transa );
+    bli_param_map_netlib_to_blis_trans( *transb, &blis_transb );
+
+    /* Typecast BLAS integers to BLIS integers. */
+    bli_convert_blas_dim1( *m, m0 );
+    bli_convert_blas_dim1( *n, n0 );
+    bli_convert_blas_dim1( *k, k0 );
+
+    /* Promote A and B to double precision panel by panel and let the
+       double-precision gemm (including its sup path) do the work. */
+    bli_gemm_promote_sd
+    (
+      blis_transa,
+      blis_transb,
+      m0,
+      n0,
+      k0,
+      (double*)alpha,
+      (float*)a, 1, *lda,
+      (float*)b, 1, *ldb,
+      (double*)beta,
+      c, 1, *ldc,
+      NULL,
+      NULL
+    );
+
+    AOCL_DTL_LOG_GEMM_STATS(AOCL_DTL_LEVEL_TRACE_1, *m, *n, *k);
+    AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1)
+    /* Finalize BLIS. */
+    bli_finalize_auto();
+}// end of dsgemm_
+
 #endif
@@ -109,6 +109,31 @@ void PASTEF77(ch,blasname) \
         cs_b = ldb_array[i]; \
         rs_c = 1; \
         cs_c = ldc_array[i]; \
+\
+        /* Groups of small problems are computed a SIMD vector's worth of \
+           problems at a time by the batched fixed-size kernels. */ \
+        if ( m0 <= BLIS_GEMM_BATCH_FIXED_MAX && \
+             n0 <= BLIS_GEMM_BATCH_FIXED_MAX && \
+             k0 <= BLIS_GEMM_BATCH_FIXED_MAX ) \
+        { \
+            PASTEMAC(ch,gemm_batch_fixed_array) \
+            ( \
+              blis_transa, \
+              blis_transb, \
+              m0, \
+              n0, \
+              k0, \
+              (ftype*)(alpha_array + i), \
+              (ftype**)(a_array + idx), rs_a, cs_a, \
+              (ftype**)(b_array + idx), rs_b, cs_b, \
+              (ftype*)(beta_array + i), \
+              (ftype**)(c_array + idx), rs_c, cs_c, \
+              group_size[i]  \
+            ); \
+\
+            idx += group_size[i]; \
+            continue; \
+        } \
 \
         for(j = 0; j < group_size[i]; j++) \
         { \
@@ -204,6 +229,31 @@ void PASTEF77(ch,blasname) \
         const inc_t cs_b = ldb_array[i]; \
         const inc_t rs_c = 1; \
         const inc_t cs_c = ldc_array[i]; \
+\
+        /* Groups of small problems are computed a SIMD vector's worth of \
+           problems at a time by the batched fixed-size kernels. */ \
+        if ( m0 <= BLIS_GEMM_BATCH_FIXED_MAX && \
+             n0 <= BLIS_GEMM_BATCH_FIXED_MAX && \
+             k0 <= BLIS_GEMM_BATCH_FIXED_MAX ) \
+        { \
+            PASTEMAC(ch,gemm_batch_fixed_array) \
+            ( \
+              blis_transa, \
+              blis_transb, \
+              m0, \
+              n0, \
+              k0, \
+              (ftype*)(alpha_array + i), \
+              (ftype**)(a_array + idx), rs_a, cs_a, \
+              (ftype**)(b_array + idx), rs_b, cs_b, \
+              (ftype*)(beta_array + i), \
+              (ftype**)(c_array + idx), rs_c, cs_c, \
+              group_size[i]  \
+            ); \
+\
+            idx += group_size[i]; \
+            continue; \
+        } \
 \
         obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
         obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
@@ -38,51 +38,27 @@
 
 static dim_t bli_siMatCopy_cn(dim_t rows,dim_t cols,const float alpha,float* a,dim_t lda, dim_t ldb);
 
-static dim_t bli_diMatCopy_cn(dim_t rows,dim_t cols,const double alpha,double* a,dim_t lda, dim_t ldb);
-
-static dim_t bli_ciMatCopy_cn(dim_t rows,dim_t cols,const scomplex alpha,scomplex* a,dim_t lda, dim_t ldb);
+static dim_t bli_siMatCopy_ct(dim_t rows,dim_t cols,const float alpha,float* a,dim_t lda, dim_t ldb);
 
-static dim_t bli_ciMatCopy_cr(dim_t rows,dim_t cols,const scomplex alpha,scomplex* a,dim_t lda, dim_t ldb);
+static dim_t bli_diMatCopy_cn(dim_t rows,dim_t cols,const double alpha,double* a,dim_t lda, dim_t ldb);
 
-static dim_t bli_ziMatCopy_cn(dim_t rows,dim_t cols,const dcomplex alpha,dcomplex* a,dim_t lda, dim_t ldb);
+static dim_t bli_diMatCopy_ct(dim_t rows,dim_t cols,const double alpha,double* a,dim_t lda, dim_t ldb);
 
-static dim_t bli_ziMatCopy_cr(dim_t rows,dim_t cols,const dcomplex alpha,dcomplex* a,dim_t lda, dim_t ldb);
+static dim_t bli_ciMatCopy_cn(dim_t rows,dim_t cols,const scomplex alpha,scomplex* a,dim_t lda, dim_t ldb);
 
-static void bli_stranspose(float* A,float* B,dim_t cols, dim_t rows);
+static dim_t bli_ciMatCopy_ct(dim_t rows,dim_t cols,const scomplex alpha,scomplex* a,dim_t lda, dim_t ldb);
 
-static void bli_dtranspose(double* A,double* B,dim_t cols, dim_t rows);
+static dim_t bli_ciMatCopy_cc(dim_t rows,dim_t cols,const scomplex alpha,scomplex* a,dim_t lda, dim_t ldb);
 
-static void bli_ctranspose(scomplex* A,scomplex* B,dim_t cols, dim_t rows);
+static dim_t bli_ciMatCopy_cr(dim_t rows,dim_t cols,const scomplex alpha,scomplex* a,dim_t lda, dim_t ldb);
 
-static void bli_ztranspose(dcomplex* A,dcomplex* B,dim_t cols, dim_t rows);
+static dim_t bli_ziMatCopy_cn(dim_t rows,dim_t cols,const dcomplex alpha,dcomplex* a,dim_t lda, dim_t ldb);
 
-static void bli_stranspose(float* A,float* B,dim_t cols, dim_t rows)
-{
- for (dim_t i = 0; i < cols; i++)
-  for (dim_t j = 0; j < rows; j++)
-   B[j*cols + i] = A[i*rows +j];
-}
+static dim_t bli_ziMatCopy_ct(dim_t rows,dim_t cols,const dcomplex alpha,dcomplex* a,dim_t lda, dim_t ldb);
 
-static void bli_dtranspose(double* A,double* B,dim_t cols, dim_t rows)
-{
- for (dim_t i = 0; i < cols; i++)
-  for (dim_t j = 0; j < rows; j++)
-   B[j*cols + i] = A[i*rows +j];
-}
+static dim_t bli_ziMatCopy_cc(dim_t rows,dim_t cols,const dcomplex alpha,dcomplex* a,dim_t lda, dim_t ldb);
 
-static void bli_ctranspose(scomplex* A,scomplex* B,dim_t cols, dim_t rows)
-{
- for (dim_t i = 0; i < cols; i++)
-  for (dim_t j = 0; j < rows; j++)
-   B[j*cols + i] = A[i*rows +j];
-}
-
-static void bli_ztranspose(dcomplex* A,dcomplex* B,dim_t cols, dim_t rows)
-{
- for (dim_t i = 0; i < cols; i++)
-  for (dim_t j = 0; j < rows; j++)
-   B[j*cols + i] = A[i*rows +j];
-}
+static dim_t bli_ziMatCopy_cr(dim_t rows,dim_t cols,const dcomplex alpha,dcomplex* a,dim_t lda, dim_t ldb);
 
 void simatcopy_ (f77_char* trans, f77_int* rows, f77_int* cols, const float* alpha,float* aptr, f77_int* lda, f77_int* ldb)
 {
@@ -112,34 +88,11 @@ void simatcopy_ (f77_char* trans, f77_int* rows, f77_int* cols, const float* alp
  }
  else if ( *trans == 't' || *trans == 'T')
  {
-  //pre transpose
-  float* temp = (float* ) bli_malloc_user((*rows)*(*lda)*sizeof(float));
-  bli_stranspose(aptr,temp,*lda,*rows);
-  
-  for (dim_t i = 0; i < *cols; i++)
-   memcpy(&aptr[i*(*lda)],&temp[i*(*lda)],(*rows)*sizeof(float));
- 
-  bli_siMatCopy_cn(*cols,*rows,*alpha,aptr,*lda,*ldb);
-
-  //post transpose
-  //bli_stranspose(temp,aptr,*lda,*cols);
-  bli_free_user(temp);
+  bli_siMatCopy_ct(*rows,*cols,*alpha,aptr,*lda,*ldb);
  }
  else if ( *trans == 'c' || *trans == 'C')
  {
-  //pre transpose
-  float* temp = (float* ) bli_malloc_user((*rows)*(*lda)*sizeof(float));
-  bli_stranspose(aptr,temp,*lda,*rows);
-
-  for (dim_t i = 0; i < *cols; i++)
-   memcpy(&aptr[i*(*lda)],&temp[i*(*lda)],(*rows)*sizeof(float));
-
-  //bli_siMatCopy_cn(*cols,*rows,*alpha,temp,*lda,*ldb);
-  
-  bli_siMatCopy_cn(*cols,*rows,*alpha,aptr,*lda,*ldb);
-  //post transpose
-  //bli_stranspose(temp,aptr,*lda,*cols);
-  bli_free_user(temp);
+  bli_siMatCopy_ct(*rows,*cols,*alpha,aptr,*lda,*ldb);
  }
  else if ( *trans == 'r' || *trans == 'R')
  {
@@ -180,34 +133,11 @@ void dimatcopy_ (f77_char* trans, f77_int* rows, f77_int* cols, const double* al
  }
  else if ( *trans == 't' || *trans == 'T')
  {
-  //pre transpose
-  double* temp = (double* ) bli_malloc_user((*rows)*(*lda)*sizeof(double));
-  bli_dtranspose(aptr,temp,*lda,*rows);
-     
-  for (dim_t i = 0; i < *cols; i++)
-   memcpy(&aptr[i*(*lda)],&temp[i*(*lda)],(*rows)*sizeof(double));
-
-  bli_diMatCopy_cn(*cols,*rows,*alpha,aptr,*lda,*ldb);
-  
-  //post transpose
-  //bli_dtranspose(temp,aptr,*rows,*lda);
-  //bli_dtranspose(temp,aptr,*lda,*cols);
-  bli_free_user(temp);
+  bli_diMatCopy_ct(*rows,*cols,*alpha,aptr,*lda,*ldb);
  }
  else if ( *trans == 'c' || *trans == 'C')
  {
-  //pre transpose
-  double* temp = (double* ) bli_malloc_user((*rows)*(*lda)*sizeof(double));
-  bli_dtranspose(aptr,temp,*lda,*rows);
-
-  for (dim_t i = 0; i < *cols; i++)
-   memcpy(&aptr[i*(*lda)],&temp[i*(*lda)],(*rows)*sizeof(double));
-  
-  bli_diMatCopy_cn(*cols,*rows,*alpha,aptr,*lda,*ldb);
-    
-  //post transpose
-  //bli_dtranspose(temp,aptr,*lda,*cols);
-  bli_free_user(temp);
+  bli_diMatCopy_ct(*rows,*cols,*alpha,aptr,*lda,*ldb);
  }
  else if ( *trans == 'r' || *trans == 'R')
  {
@@ -248,34 +178,11 @@ void cimatcopy_ (f77_char* trans, f77_int* rows, f77_int* cols, const scomplex*
  }
  else if ( *trans == 't' || *trans == 'T')
  {
-  //pre transpose
-  scomplex* temp = (scomplex* ) bli_malloc_user((*rows)*(*lda)*sizeof(scomplex));
-  bli_ctranspose(aptr,temp,*lda,*rows);
-
-  //bli_ciMatCopy_cn(*cols,*rows,*alpha,temp,*lda,*ldb);
-  for (dim_t i = 0; i < *cols; i++)
-   memcpy(&aptr[i*(*lda)],&temp[i*(*lda)],(*rows)*sizeof(scomplex));
-  bli_ciMatCopy_cn(*cols,*rows,*alpha,aptr,*lda,*ldb);
-
-  //post transpose
-  //bli_ctranspose(temp,aptr,*lda,*cols);
-  bli_free_user(temp);
+  bli_ciMatCopy_ct(*rows,*cols,*alpha,aptr,*lda,*ldb);
  }
  else if ( *trans == 'c' || *trans == 'C')
  {
-
-  //pre transpose
-  scomplex* temp = (scomplex* ) bli_malloc_user((*rows)*(*lda)*sizeof(scomplex));
-  bli_ctranspose(aptr,temp,*lda,*rows);
-
-  //bli_ciMatCopy_cr(*cols,*rows,*alpha,temp,*lda,*ldb);
-  for (dim_t i = 0; i < *cols; i++)
-   memcpy(&aptr[i*(*lda)],&temp[i*(*lda)],(*rows)*sizeof(scomplex));
-  bli_ciMatCopy_cr(*cols,*rows,*alpha,aptr,*lda,*ldb);
-
-  //post transpose
-  //bli_ctranspose(temp,aptr,*lda,*cols);
-  bli_free_user(temp);
+  bli_ciMatCopy_cc(*rows,*cols,*alpha,aptr,*lda,*ldb);
  }
  else if ( *trans == 'r' || *trans == 'R')
  {
@@ -316,34 +223,11 @@ void zimatcopy_ (f77_char* trans, f77_int* rows, f77_int* cols, const dcomplex*
  }
  else if ( *trans == 't' || *trans == 'T')
  {
-
-  //pre transpose
-  dcomplex* temp = (dcomplex *) bli_malloc_user((*rows)*(*lda)*sizeof(dcomplex));
-  bli_ztranspose(aptr,temp,*lda,*rows);
-
-  //bli_ziMatCopy_cn(*cols,*rows,*alpha,temp,*lda,*ldb);
-  for (dim_t i = 0; i < *cols; i++)
-   memcpy(&aptr[i*(*lda)],&temp[i*(*lda)],(*rows)*sizeof(dcomplex));
-  bli_ziMatCopy_cn(*cols,*rows,*alpha,aptr,*lda,*ldb);
-
-  //post transpose
-  //bli_ztranspose(temp,aptr,*lda,*cols);
-  bli_free_user(temp);
+  bli_ziMatCopy_ct(*rows,*cols,*alpha,aptr,*lda,*ldb);
  }
  else if ( *trans == 'c' || *trans == 'C')
  {
-  //pre transpose
-  dcomplex* temp = (dcomplex *) bli_malloc_user((*rows)*(*lda)*sizeof(dcomplex));
-  bli_ztranspose(aptr,temp,*lda,*rows);
-
-  //bli_ziMatCopy_cr(*cols,*rows,*alpha,temp,*lda,*ldb);
-  for (dim_t i = 0; i < *cols; i++)
-   memcpy(&aptr[i*(*lda)],&temp[i*(*lda)],(*rows)*sizeof(scomplex));
-  bli_ziMatCopy_cr(*cols,*rows,*alpha,aptr,*lda,*ldb);
-
-  //post transpose
-  //bli_ztranspose(temp,aptr,*lda,*cols);
-  bli_free_user(temp);
+  bli_ziMatCopy_cc(*rows,*cols,*alpha,aptr,*lda,*ldb);
  }
  else if ( *trans == 'r' || *trans == 'R')
  {
@@ -641,4 +525,123 @@ static dim_t bli_ziMatCopy_cr(dim_t rows,dim_t cols,const dcomplex alpha,dcomple
 return(0);
 }
 
-#endif
\ No newline at end of file
+// suffix ct means - column major & trans
+static dim_t bli_siMatCopy_ct(dim_t rows,dim_t cols,const float alpha,float* a,dim_t lda, dim_t ldb)
+{
+ AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
+ float alpha_l = alpha;
+
+ if ( rows <= 0 || cols <= 0 || a == NULL || lda < rows || ldb < cols )
+ {
+  bli_print_msg( " Invalid function parameters bli_siMatCopy_ct() .", __FILE__, __LINE__ );
+  AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "Invalid function parameters");
+  return (0);
+ }
+
+ // Transpose within the caller's buffer; no copy of the matrix is made.
+ bli_sitransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, a, lda, ldb );
+
+ AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+ return(0);
+}
+
+// suffix ct means - column major & trans
+static dim_t bli_diMatCopy_ct(dim_t rows,dim_t cols,const double alpha,double* a,dim_t lda, dim_t ldb)
+{
+ AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
+ double alpha_l = alpha;
+
+ if ( rows <= 0 || cols <= 0 || a == NULL || lda < rows || ldb < cols )
+ {
+  bli_print_msg( " Invalid function parameters bli_diMatCopy_ct() .", __FILE__, __LINE__ );
+  AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "Invalid function parameters");
+  return (0);
+ }
+
+ // Transpose within the caller's buffer; no copy of the matrix is made.
+ bli_ditransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, a, lda, ldb );
+
+ AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+ return(0);
+}
+
+// suffix ct means - column major & trans
+static dim_t bli_ciMatCopy_ct(dim_t rows,dim_t cols,const scomplex alpha,scomplex* a,dim_t lda, dim_t ldb)
+{
+ AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
+ scomplex alpha_l = alpha;
+
+ if ( rows <= 0 || cols <= 0 || a == NULL || lda < rows || ldb < cols )
+ {
+  bli_print_msg( " Invalid function parameters bli_ciMatCopy_ct() .", __FILE__, __LINE__ );
+  AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "Invalid function parameters");
+  return (0);
+ }
+
+ // Transpose within the caller's buffer; no copy of the matrix is made.
+ bli_citransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, a, lda, ldb );
+
+ AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+ return(0);
+}
+
+// suffix cc means - column major & conjugate trans
+static dim_t bli_ciMatCopy_cc(dim_t rows,dim_t cols,const scomplex alpha,scomplex* a,dim_t lda, dim_t ldb)
+{
+ AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
+ scomplex alpha_l = alpha;
+
+ if ( rows <= 0 || cols <= 0 || a == NULL || lda < rows || ldb < cols )
+ {
+  bli_print_msg( " Invalid function parameters bli_ciMatCopy_cc() .", __FILE__, __LINE__ );
+  AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "Invalid function parameters");
+  return (0);
+ }
+
+ // Transpose within the caller's buffer; no copy of the matrix is made.
+ bli_citransposem_blk( BLIS_CONJUGATE, rows, cols, &alpha_l, a, lda, ldb );
+
+ AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+ return(0);
+}
+
+// suffix ct means - column major & trans
+static dim_t bli_ziMatCopy_ct(dim_t rows,dim_t cols,const dcomplex alpha,dcomplex* a,dim_t lda, dim_t ldb)
+{
+ AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
+ dcomplex alpha_l = alpha;
+
+ if ( rows <= 0 || cols <= 0 || a == NULL || lda < rows || ldb < cols )
+ {
+  bli_print_msg( " Invalid function parameters bli_ziMatCopy_ct() .", __FILE__, __LINE__ );
+  AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "Invalid function parameters");
+  return (0);
+ }
+
+ // Transpose within the caller's buffer; no copy of the matrix is made.
+ bli_zitransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, a, lda, ldb );
+
+ AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+ return(0);
+}
+
+// suffix cc means - column major & conjugate trans
+static dim_t bli_ziMatCopy_cc(dim_t rows,dim_t cols,const dcomplex alpha,dcomplex* a,dim_t lda, dim_t ldb)
+{
+ AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
+ dcomplex alpha_l = alpha;
+
+ if ( rows <= 0 || cols <= 0 || a == NULL || lda < rows || ldb < cols )
+ {
+  bli_print_msg( " Invalid function parameters bli_ziMatCopy_cc() .", __FILE__, __LINE__ );
+  AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "Invalid function parameters");
+  return (0);
+ }
+
+ // Transpose within the caller's buffer; no copy of the matrix is made.
+ bli_zitransposem_blk( BLIS_CONJUGATE, rows, cols, &alpha_l, a, lda, ldb );
+
+ AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+ return(0);
+}
+#endif
@@ -44,57 +44,145 @@ static dim_t bli_coMatAdd_cn(dim_t m,dim_t n,const scomplex alpha,scomplex* aptr
 
 static dim_t bli_zoMatAdd_cn(dim_t m,dim_t n,const dcomplex alpha,dcomplex* aptr,dim_t lda,const dcomplex beta,dcomplex* bptr,dim_t ldb,dcomplex* C,dim_t ldc);
 
-static void bli_stranspose(const float* A,float* B,dim_t cols, dim_t rows);
-
-static void bli_dtranspose(const double* A,double* B,dim_t cols, dim_t rows);
-
-static void bli_ctranspose(const scomplex* A,scomplex* B,dim_t cols, dim_t rows);
-
-static void bli_ztranspose(const dcomplex* A,dcomplex* B,dim_t cols, dim_t rows);
-
-static void bli_cconjugate(scomplex* A,dim_t cols,dim_t rows);
-
-static void bli_zconjugate(dcomplex* A,dim_t cols,dim_t rows);
-
-static void bli_stranspose(const float* A,float* B,dim_t cols, dim_t rows)
-{
- for (dim_t i = 0; i < cols; i++)
-  for (dim_t j = 0; j < rows; j++)
-   B[j*cols + i] = A[i*rows +j];
+// Accumulate one term of the sum into C: C := beta * C + alpha * op( A ),
+// where op( A ) is m x n. Transposed operands are handed to the cache-blocked
+// transpose, so no transposed copy of A is ever formed.
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       f77_char trans, \
+       dim_t    m, \
+       dim_t    n, \
+       ctype*   alpha, \
+       ctype*   a, inc_t lda, \
+       ctype*   beta, \
+       ctype*   c, inc_t ldc  \
+     ) \
+{ \
+	const conj_t conja = ( trans == 'c' || trans == 'C' || \
+	                       trans == 'r' || trans == 'R' ) ? BLIS_CONJUGATE \
+	                                                      : BLIS_NO_CONJUGATE; \
+\
+	if ( trans == 't' || trans == 'T' || trans == 'c' || trans == 'C' ) \
+	{ \
+		PASTEMAC(ch,transposem_blk)( conja, n, m, alpha, a, lda, beta, c, ldc ); \
+		return; \
+	} \
+\
+	const bool beta0 = PASTEMAC(ch,eq0)( *beta ); \
+	ctype      ai; \
+\
+	for ( dim_t j = 0; j < n; ++j ) \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		if ( bli_is_conj( conja ) ) \
+		{ \
+			PASTEMAC(ch,scal2js)( *alpha, *(a + i + j*lda), ai ); \
+		} \
+		else \
+		{ \
+			PASTEMAC(ch,scal2s)( *alpha, *(a + i + j*lda), ai ); \
+		} \
+\
+		if ( beta0 ) \
+		{ \
+			PASTEMAC(ch,copys)( ai, *(c + i + j*ldc) ); \
+		} \
+		else \
+		{ \
+			PASTEMAC(ch,xpbys)( ai, *beta, *(c + i + j*ldc) ); \
+		} \
+	} \
 }
 
-static void bli_dtranspose(const double* A,double* B,dim_t cols, dim_t rows)
+INSERT_GENTFUNC_BASIC0( omatadd_term )
+
+// Return whether the m x n matrix at c overlaps the storage of op( a ), where
+// a is stored column-major with leading dimension lda.
+static bool bli_omatadd_overlaps
+     (
+       f77_char trans,
+       dim_t    m,
+       dim_t    n,
+       void*    a, inc_t lda,
+       void*    c, inc_t ldc,
+       siz_t    elem_size
+     )
 {
- for (dim_t i = 0; i < cols; i++)
-  for (dim_t j = 0; j < rows; j++)
-   B[j*cols + i] = A[i*rows +j];
-}
+	const bool  transa = ( trans == 't' || trans == 'T' ||
+	                       trans == 'c' || trans == 'C' );
+	const dim_t m_a    = ( transa ? n : m );
+	const dim_t n_a    = ( transa ? m : n );
 
-static void bli_ctranspose(const scomplex* A,scomplex* B,dim_t cols, dim_t rows)
-{
- for (dim_t i = 0; i < cols; i++)
-  for (dim_t j = 0; j < rows; j++)
-   B[j*cols + i] = A[i*rows +j];
-}
+	const char* a_beg  = a;
+	const char* a_end  = a_beg + ( ( n_a - 1 ) * lda + m_a ) * elem_size;
+	const char* c_beg  = c;
+	const char* c_end  = c_beg + ( ( n - 1 ) * ldc + m ) * elem_size;
 
-static void bli_ztranspose(const dcomplex* A,dcomplex* B,dim_t cols, dim_t rows)
-{
- for (dim_t i = 0; i < cols; i++)
-  for (dim_t j = 0; j < rows; j++)
-   B[j*cols + i] = A[i*rows +j];
+	return ( a_beg < c_end && c_beg < a_end );
 }
 
-static void bli_cconjugate(scomplex* A,dim_t cols,dim_t rows)
-{
- for (dim_t i = 0; i < cols*rows; i++)
-  A[i].imag *=(-1);
+// Compute C := alpha * op( A ) + beta * op( B ) one term at a time. The
+// terms are summed in an order that never overwrites an operand before it
+// is read: if C aliases an operand exactly and that operand is not
+// transposed, its term is computed first, in place. Any other overlap
+// between C and an operand is resolved by forming the sum in a temporary.
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       f77_char transa, \
+       f77_char transb, \
+       dim_t    m, \
+       dim_t    n, \
+       ctype*   alpha, \
+       ctype*   a, inc_t lda, \
+       ctype*   beta, \
+       ctype*   b, inc_t ldb, \
+       ctype*   c, inc_t ldc  \
+     ) \
+{ \
+	ctype zero, one; \
+\
+	PASTEMAC(ch,set0s)( zero ); \
+	PASTEMAC(ch,set1s)( one ); \
+\
+	const bool ova = bli_omatadd_overlaps( transa, m, n, a, lda, c, ldc, sizeof( ctype ) ); \
+	const bool ovb = bli_omatadd_overlaps( transb, m, n, b, ldb, c, ldc, sizeof( ctype ) ); \
+\
+	const bool in_place_a = ( a == c && lda == ldc && \
+	                          ( transa == 'n' || transa == 'N' || \
+	                            transa == 'r' || transa == 'R' ) ); \
+	const bool in_place_b = ( b == c && ldb == ldc && \
+	                          ( transb == 'n' || transb == 'N' || \
+	                            transb == 'r' || transb == 'R' ) ); \
+\
+	if ( ( ova && ovb ) || ( ova && !in_place_a ) || ( ovb && !in_place_b ) ) \
+	{ \
+		ctype* t = bli_malloc_user( m * n * sizeof( ctype ) ); \
+\
+		PASTEMAC(ch,omatadd_term)( transa, m, n, alpha, a, lda, &zero, t, m ); \
+		PASTEMAC(ch,omatadd_term)( transb, m, n, beta,  b, ldb, &one,  t, m ); \
+		PASTEMAC(ch,omatadd_term)( 'n',    m, n, &one,  t,  m,   &zero, c, ldc ); \
+\
+		bli_free_user( t ); \
+	} \
+	else if ( ovb ) \
+	{ \
+		PASTEMAC(ch,omatadd_term)( transb, m, n, beta,  b, ldb, &zero, c, ldc ); \
+		PASTEMAC(ch,omatadd_term)( transa, m, n, alpha, a, lda, &one,  c, ldc ); \
+	} \
+	else \
+	{ \
+		PASTEMAC(ch,omatadd_term)( transa, m, n, alpha, a, lda, &zero, c, ldc ); \
+		PASTEMAC(ch,omatadd_term)( transb, m, n, beta,  b, ldb, &one,  c, ldc ); \
+	} \
 }
 
-static void bli_zconjugate(dcomplex* A,dim_t cols,dim_t rows)
-{
- for (dim_t i = 0; i < cols*rows; i++)
-  A[i].imag *=(-1);
-}
+INSERT_GENTFUNC_BASIC0( omatadd_terms )
 
 void somatadd_ (f77_char* transa,f77_char* transb, f77_int* m, f77_int* n, const float* alpha, const float* A, f77_int* lda, const float* beta, const float* B, f77_int* ldb, float* C, f77_int* ldc)
 {
@@ -125,44 +213,14 @@ void somatadd_ (f77_char* transa,f77_char* transb, f77_int* m, f77_int* n, const
   AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_1, "Invalid value for trans parameter");
   return ;
  }
- float* aptr;
- float* bptr;
-
- //pre transpose
- if(*transa == 't' || *transa == 'T' ||
-  *transa == 'c' || *transa == 'C')
+ if ( ( *transa == 'n' || *transa == 'N' ) &&
+      ( *transb == 'n' || *transb == 'N' ) )
  {
-  aptr = (float *) bli_malloc_user((*m)*(*lda)*sizeof(float));
-  bli_stranspose(A,aptr,*m,*lda);
+  bli_soMatAdd_cn(*m,*n,*alpha,(float*)A,*lda,*beta,(float*)B,*ldb,C,*ldc);
  }
  else
  {
-  aptr = (float *)A;
- }
-
- if(*transb == 't' || *transb == 'T' ||
-  *transb == 'c' || *transb == 'C')
- {
-  bptr = (float *) bli_malloc_user((*m)*(*ldb)*sizeof(float));
-  bli_stranspose(B,bptr,*m,*ldb);
- }
- else
- {
-  bptr = (float *)B;
- }
-
- bli_soMatAdd_cn(*m,*n,*alpha,aptr,*lda,*beta,bptr,*ldb,C,*ldc);
-
- //post transpose
- if(*transa == 't' || *transa == 'T' ||
-  *transa == 'c' || *transa == 'C')
- {
-  bli_free_user(aptr);
- }
- if(*transb == 't' || *transb == 'T' ||
-  *transb == 'c' || *transb == 'C')
- {
-  bli_free_user(bptr);
+  bli_somatadd_terms(*transa,*transb,*m,*n,(float*)alpha,(float*)A,*lda,(float*)beta,(float*)B,*ldb,C,*ldc);
  }
  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
  return ;
@@ -196,44 +254,14 @@ void domatadd_ (f77_char* transa,f77_char* transb, f77_int* m, f77_int* n, const
   AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_1, "Invalid value for trans parameter");
   return ;
  }
- double* aptr;
- double* bptr;
-
- //pre transpose
- if(*transa == 't' || *transa == 'T' ||
-  *transa == 'c' || *transa == 'C')
+ if ( ( *transa == 'n' || *transa == 'N' ) &&
+      ( *transb == 'n' || *transb == 'N' ) )
  {
-  aptr = (double *) bli_malloc_user((*m)*(*lda)*sizeof(double));
-  bli_dtranspose(A,aptr,*m,*lda);
+  bli_doMatAdd_cn(*m,*n,*alpha,(double*)A,*lda,*beta,(double*)B,*ldb,C,*ldc);
  }
  else
  {
-  aptr = (double *)A;
- }
-
- if(*transb == 't' || *transb == 'T' ||
-  *transb == 'c' || *transb == 'C')
- {
-  bptr = (double *) bli_malloc_user((*m)*(*ldb)*sizeof(double));
-  bli_dtranspose(B,bptr,*m,*ldb);
- }
- else
- {
-  bptr = (double *)B;
- }
-
- bli_doMatAdd_cn(*m,*n,*alpha,aptr,*lda,*beta,bptr,*ldb,C,*ldc);
-
- //post transpose
- if(*transa == 't' || *transa == 'T' ||
-  *transa == 'c' || *transa == 'C')
- {
-  bli_free_user(aptr);
- }
- if(*transb == 't' || *transb == 'T' ||
-  *transb == 'c' || *transb == 'C')
- {
-  bli_free_user(bptr);
+  bli_domatadd_terms(*transa,*transb,*m,*n,(double*)alpha,(double*)A,*lda,(double*)beta,(double*)B,*ldb,C,*ldc);
  }
  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
  return ;
@@ -267,57 +295,14 @@ void comatadd_ (f77_char* transa,f77_char* transb, f77_int* m, f77_int* n, const
   AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_1, "Invalid value for trans parameter");
   return ;
  }
- scomplex* aptr;
- scomplex* bptr;
-
- //pre transpose
- if(*transa == 't' || *transa == 'T' ||
-  *transa == 'c' || *transa == 'C')
- {
-  aptr = (scomplex *) bli_malloc_user((*m)*(*lda)*sizeof(scomplex));
-  bli_ctranspose(A,aptr,*m,*lda);
- }
- else
- {
-  aptr = (scomplex*)A;
- }
-
- if(*transb == 't' || *transb == 'T' ||
-  *transb == 'c' || *transb == 'C')
+ if ( ( *transa == 'n' || *transa == 'N' ) &&
+      ( *transb == 'n' || *transb == 'N' ) )
  {
-  bptr = (scomplex *) bli_malloc_user((*m)*(*ldb)*sizeof(scomplex));
-  bli_ctranspose(B,bptr,*m,*ldb);
+  bli_coMatAdd_cn(*m,*n,*alpha,(scomplex*)A,*lda,*beta,(scomplex*)B,*ldb,C,*ldc);
  }
  else
  {
-  bptr = (scomplex*)B;
- }
-
- // If Conjugate
- if( *transa == 'c' || *transa == 'C' ||
-  *transa == 'r' || *transa == 'R')
- {
-  bli_cconjugate(aptr,*m,*lda);
- }
-
- if( *transb == 'c' || *transb == 'C' ||
-  *transb == 'r' || *transb == 'R')
- {
-  bli_cconjugate(bptr,*m,*ldb);
- }
-
- bli_coMatAdd_cn(*m,*n,*alpha,aptr,*lda,*beta,bptr,*ldb,C,*ldc);
-
- //post transpose
- if(*transa == 't' || *transa == 'T' ||
-  *transa == 'c' || *transa == 'C')
- {
-  bli_free_user(aptr);
- }
- if(*transb == 't' || *transb == 'T' ||
-  *transb == 'c' || *transb == 'C')
- {
-  bli_free_user(bptr);
+  bli_comatadd_terms(*transa,*transb,*m,*n,(scomplex*)alpha,(scomplex*)A,*lda,(scomplex*)beta,(scomplex*)B,*ldb,C,*ldc);
  }
  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
  return ;
@@ -353,57 +338,14 @@ void zomatadd_ (f77_char* transa,f77_char* transb, f77_int* m, f77_int* n, const
   return ;
  }
 
- dcomplex* aptr;
- dcomplex* bptr;
-
- //pre transpose
- if(*transa == 't' || *transa == 'T' ||
-  *transa == 'c' || *transa == 'C')
- {
-  aptr = (dcomplex *) bli_malloc_user((*m)*(*lda)*sizeof(dcomplex));
-  bli_ztranspose(A,aptr,*m,*lda);
- }
- else
- {
-  aptr = (dcomplex*)A;
- }
-
- if(*transb == 't' || *transb == 'T' ||
-  *transb == 'c' || *transb == 'C')
+ if ( ( *transa == 'n' || *transa == 'N' ) &&
+      ( *transb == 'n' || *transb == 'N' ) )
  {
-  bptr = (dcomplex *) bli_malloc_user((*m)*(*ldb)*sizeof(dcomplex));
-  bli_ztranspose(B,bptr,*m,*ldb);
+  bli_zoMatAdd_cn(*m,*n,*alpha,(dcomplex*)A,*lda,*beta,(dcomplex*)B,*ldb,C,*ldc);
  }
  else
  {
-  bptr = (dcomplex*)B;
- }
-
- // If Conjugate
- if( *transa == 'c' || *transa == 'C' ||
-  *transa == 'r' || *transa == 'R')
- {
-  bli_zconjugate(aptr,*m,*lda);
- }
-
- if( *transb == 'c' || *transb == 'C' ||
-  *transb == 'r' || *transb == 'R')
- {
-  bli_zconjugate(bptr,*m,*ldb);
- }
-
- bli_zoMatAdd_cn(*m,*n,*alpha,aptr,*lda,*beta,bptr,*ldb,C,*ldc);
-
- //post transpose
- if(*transa == 't' || *transa == 'T' ||
-  *transa == 'c' || *transa == 'C')
- {
-  bli_free_user(aptr);
- }
- if(*transb == 't' || *transb == 'T' ||
-  *transb == 'c' || *transb == 'C')
- {
-  bli_free_user(bptr);
+  bli_zomatadd_terms(*transa,*transb,*m,*n,(dcomplex*)alpha,(dcomplex*)A,*lda,(dcomplex*)beta,(dcomplex*)B,*ldb,C,*ldc);
  }
  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
  return ;
@@ -472,7 +472,6 @@ static dim_t bli_soMatCopy_ct(dim_t rows,dim_t cols,const float alpha,const floa
 {
  AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
  dim_t i,j;
- const float* aptr;
  float* bptr;
  if ( rows <= 0 || cols <= 0 || a == NULL || b == NULL || lda < rows || ldb < rows )
  //if ( rows <= 0 || cols <= 0 || a == NULL || b == NULL || lda < cols || ldb < rows )
@@ -482,8 +481,6 @@ static dim_t bli_soMatCopy_ct(dim_t rows,dim_t cols,const float alpha,const floa
   return (0);
  }
 
- aptr = a;
-
  if ( alpha == 0.0 )
  {
   for ( i=0; i<cols ; i++ )
@@ -497,29 +494,11 @@ static dim_t bli_soMatCopy_ct(dim_t rows,dim_t cols,const float alpha,const floa
   return(0);
  }
 
- if ( alpha == 1.0 )
- {
-  for ( i=0; i<cols ; i++ )
-  {
-   bptr = &b[i];
-   for(j=0; j<rows; j++)
-   {
-    bptr[j*ldb] = aptr[j];
-   }
-   aptr += lda;
-  }
-  return(0);
- }
+ // Transpose in cache-sized tiles using the vectorized kernels.
+ float alpha_l = alpha;
+ float beta_l  = 0.0;
 
- for ( i=0; i<cols ; i++ )
- {
-  bptr = &b[i];
-  for(j=0; j<rows; j++)
-  {
-   bptr[j*ldb] = alpha * aptr[j];
-  }
-  aptr += lda;
- }
+ bli_stransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, ( float* )a, lda, &beta_l, b, ldb );
  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
  return(0);
 }
@@ -529,7 +508,6 @@ static dim_t bli_doMatCopy_ct(dim_t rows,dim_t cols,const double alpha,const dou
 {
  AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
  dim_t i,j;
- const double* aptr;
  double* bptr;
  if ( rows <= 0 || cols <= 0 || a == NULL || b == NULL || lda < rows || ldb < rows )
  {
@@ -538,8 +516,6 @@ static dim_t bli_doMatCopy_ct(dim_t rows,dim_t cols,const double alpha,const dou
   return (0);
  }
 
- aptr = a;
-
  if ( alpha == 0.0 )
  {
   for ( i=0; i<cols ; i++ )
@@ -553,30 +529,11 @@ static dim_t bli_doMatCopy_ct(dim_t rows,dim_t cols,const double alpha,const dou
   return(0);
  }
 
- if ( alpha == 1.0 )
- {
-  for ( i=0; i<cols ; i++ )
-  {
-   bptr = &b[i];
-   for(j=0; j<rows; j++)
-   {
-    bptr[j*ldb] = aptr[j];
-   }
-   aptr += lda;
-  }
-  return(0);
- }
-
- for ( i=0; i<cols ; i++ )
- {
-  bptr = &b[i];
-  for(j=0; j<rows; j++)
-  {
-   bptr[j*ldb] = alpha * aptr[j];
-  }
-  aptr += lda;
- }
+ // Transpose in cache-sized tiles using the vectorized kernels.
+ double alpha_l = alpha;
+ double beta_l  = 0.0;
 
+ bli_dtransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, ( double* )a, lda, &beta_l, b, ldb );
  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
  return(0);
 }
@@ -586,7 +543,6 @@ static dim_t bli_coMatCopy_ct(dim_t rows,dim_t cols,const scomplex alpha,const s
 {
  AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
  dim_t i,j;
- const scomplex* aptr;
  scomplex* bptr;
 
  if ( rows <= 0 || cols <= 0 || a == NULL || b == NULL || lda < rows || ldb < rows )
@@ -595,7 +551,6 @@ static dim_t bli_coMatCopy_ct(dim_t rows,dim_t cols,const scomplex alpha,const s
   AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "Invalid function parameters");
   return (0);
  }
- aptr = a;
 
  if ( alpha.real == 0.0 && alpha.imag == 0.0)
  {
@@ -611,31 +566,11 @@ static dim_t bli_coMatCopy_ct(dim_t rows,dim_t cols,const scomplex alpha,const s
   return(0);
  }
 
- if ( alpha.real == 1.0 && alpha.imag == 1.0)
- {
-  for ( i=0; i<cols ; i++ )
-  {
-   bptr = &b[i];
-   for(j=0; j<rows; j++)
-   {
-    bptr[j*ldb].real = aptr[j].real - aptr[j].imag;
-    bptr[j*ldb].imag = aptr[j].real + aptr[j].imag;
-   }
-   aptr += lda;
-  }
-  return(0);
- }
+ // Transpose in cache-sized tiles using the vectorized kernels.
+ scomplex alpha_l = alpha;
+ scomplex beta_l  = { 0.0, 0.0 };
 
- for ( i=0; i<cols ; i++ )
- {
-  bptr = &b[i];
-  for(j=0; j<rows; j++)
-  {
-   bptr[j*ldb].real = ( (alpha.real * aptr[j].real ) - ( alpha.imag * aptr[j].imag ) );
-   bptr[j*ldb].imag = ( (alpha.real * aptr[j].imag ) + ( alpha.imag * aptr[j].real ) );
-  }
-  aptr += lda;
- }
+ bli_ctransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, ( scomplex* )a, lda, &beta_l, b, ldb );
  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
  return(0);
 }
@@ -645,7 +580,6 @@ static dim_t bli_zoMatCopy_ct(dim_t rows,dim_t cols,const dcomplex alpha,const d
 {
  AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
  dim_t i,j;
- const dcomplex* aptr;
  dcomplex* bptr;
  if ( rows <= 0 || cols <= 0 || a == NULL || b == NULL || lda < rows || ldb < rows )
  {
@@ -653,7 +587,6 @@ static dim_t bli_zoMatCopy_ct(dim_t rows,dim_t cols,const dcomplex alpha,const d
   AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "Invalid function parameters");
   return (0);
  }
- aptr = a;
 
  if ( alpha.real == 0.0 && alpha.imag == 0.0)
  {
@@ -669,31 +602,11 @@ static dim_t bli_zoMatCopy_ct(dim_t rows,dim_t cols,const dcomplex alpha,const d
   return(0);
  }
 
- if ( alpha.real == 1.0 && alpha.imag == 1.0)
- {
-  for ( i=0; i<cols ; i++ )
-  {
-   bptr = &b[i];
-   for(j=0; j<rows; j++)
-   {
-    bptr[j*ldb].real = aptr[j].real - aptr[j].imag;
-    bptr[j*ldb].imag = aptr[j].real + aptr[j].imag;
-   }
-   aptr += lda;
-  }
-  return(0);
- }
+ // Transpose in cache-sized tiles using the vectorized kernels.
+ dcomplex alpha_l = alpha;
+ dcomplex beta_l  = { 0.0, 0.0 };
 
- for ( i=0; i<cols ; i++ )
- {
-  bptr = &b[i];
-  for(j=0; j<rows; j++)
-  {
-   bptr[j*ldb].real = ( (alpha.real * aptr[j].real ) - ( alpha.imag * aptr[j].imag ) );
-   bptr[j*ldb].imag = ( (alpha.real * aptr[j].imag ) + ( alpha.imag * aptr[j].real ) );
-  }
-  aptr += lda;
- }
+ bli_ztransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, ( dcomplex* )a, lda, &beta_l, b, ldb );
  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
  return(0);
 }
@@ -823,7 +736,6 @@ static dim_t bli_coMatCopy_cc(dim_t rows,dim_t cols,const scomplex alpha,const s
 {
  AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
  dim_t i,j;
- const scomplex* aptr;
  scomplex* bptr;
  if ( rows <= 0 || cols <= 0 || a == NULL || b == NULL || lda < rows || ldb < rows )
  {
@@ -831,7 +743,6 @@ static dim_t bli_coMatCopy_cc(dim_t rows,dim_t cols,const scomplex alpha,const s
   AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "Invalid function parameters");
   return (0);
  }
- aptr = a;
 
  if ( alpha.real == 0.0 && alpha.imag == 0.0)
  {
@@ -847,31 +758,11 @@ static dim_t bli_coMatCopy_cc(dim_t rows,dim_t cols,const scomplex alpha,const s
   return(0);
  }
 
- if ( alpha.real == 1.0 && alpha.imag == 1.0)
- {
-  for ( i=0; i<cols ; i++ )
-  {
-   bptr = &b[i];
-   for(j=0; j<rows; j++)
-   {
-    bptr[j*ldb].real = aptr[j].real + aptr[j].imag;
-    bptr[j*ldb].imag = aptr[j].real - aptr[j].imag;
-   }
-   aptr += lda;
-  }
-  return(0);
- }
+ // Transpose in cache-sized tiles using the vectorized kernels.
+ scomplex alpha_l = alpha;
+ scomplex beta_l  = { 0.0, 0.0 };
 
- for ( i=0; i<cols ; i++ )
- {
-  bptr = &b[i];
-  for(j=0; j<rows; j++)
-  {
-   bptr[j*ldb].real = ( (alpha.real * aptr[j].real ) + ( alpha.imag * aptr[j].imag ) );
-   bptr[j*ldb].imag = ( (alpha.imag * aptr[j].real ) - ( alpha.real * aptr[j].imag ) );
-  }
-  aptr += lda;
- }
+ bli_ctransposem_blk( BLIS_CONJUGATE, rows, cols, &alpha_l, ( scomplex* )a, lda, &beta_l, b, ldb );
  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
  return(0);
 }
@@ -881,7 +772,6 @@ static dim_t bli_zoMatCopy_cc(dim_t rows,dim_t cols,const dcomplex alpha,const d
 {
  AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2);
  dim_t i,j;
- const dcomplex* aptr;
  dcomplex* bptr;
  if ( rows <= 0 || cols <= 0 || a == NULL || b == NULL || lda < rows || ldb < rows )
  {
@@ -889,7 +779,6 @@ static dim_t bli_zoMatCopy_cc(dim_t rows,dim_t cols,const dcomplex alpha,const d
   AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_2, "Invalid function parameters");
   return (0);
  }
- aptr = a;
 
  if ( alpha.real == 0.0 && alpha.imag == 0.0)
  {
@@ -905,31 +794,11 @@ static dim_t bli_zoMatCopy_cc(dim_t rows,dim_t cols,const dcomplex alpha,const d
   return(0);
  }
 
- if ( alpha.real == 1.0 && alpha.imag == 1.0)
- {
-  for ( i=0; i<cols ; i++ )
-  {
-   bptr = &b[i];
-   for(j=0; j<rows; j++)
-   {
-    bptr[j*ldb].real = aptr[j].real + aptr[j].imag;
-    bptr[j*ldb].imag = aptr[j].real - aptr[j].imag;
-   }
-   aptr += lda;
-  }
-  return(0);
- }
+ // Transpose in cache-sized tiles using the vectorized kernels.
+ dcomplex alpha_l = alpha;
+ dcomplex beta_l  = { 0.0, 0.0 };
 
- for ( i=0; i<cols ; i++ )
- {
-  bptr = &b[i];
-  for(j=0; j<rows; j++)
-  {
-   bptr[j*ldb].real = ( (alpha.real * aptr[j].real ) + ( alpha.imag * aptr[j].imag ) );
-   bptr[j*ldb].imag = ( (alpha.imag * aptr[j].real ) - ( alpha.real * aptr[j].imag ) );
-  }
-  aptr += lda;
- }
+ bli_ztransposem_blk( BLIS_CONJUGATE, rows, cols, &alpha_l, ( dcomplex* )a, lda, &beta_l, b, ldb );
  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
  return(0);
 }
@@ -496,6 +496,18 @@ static dim_t bli_soMatCopy2_ct(dim_t rows,dim_t cols,const float alpha,const flo
   return(0);
  }
 
+ // With unit strides the operands are ordinary column-major matrices, so
+ // transpose in cache-sized tiles using the vectorized kernels.
+ if ( stridea == 1 && strideb == 1 )
+ {
+  float alpha_l = alpha;
+  float beta_l  = 0.0;
+
+  bli_stransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, ( float* )a, lda, &beta_l, b, ldb );
+  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+  return(0);
+ }
+
  if ( alpha == 1.0 )
  {
   for ( i=0; i<cols ; i++ )
@@ -552,6 +564,18 @@ static dim_t bli_doMatCopy2_ct(dim_t rows,dim_t cols,const double alpha,const do
   return(0);
  }
 
+ // With unit strides the operands are ordinary column-major matrices, so
+ // transpose in cache-sized tiles using the vectorized kernels.
+ if ( stridea == 1 && strideb == 1 )
+ {
+  double alpha_l = alpha;
+  double beta_l  = 0.0;
+
+  bli_dtransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, ( double* )a, lda, &beta_l, b, ldb );
+  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+  return(0);
+ }
+
  if ( alpha == 1.0 )
  {
   for ( i=0; i<cols ; i++ )
@@ -609,6 +633,18 @@ static dim_t bli_coMatCopy2_ct(dim_t rows,dim_t cols,const scomplex alpha,const
   return(0);
  }
 
+ // With unit strides the operands are ordinary column-major matrices, so
+ // transpose in cache-sized tiles using the vectorized kernels.
+ if ( stridea == 1 && strideb == 1 )
+ {
+  scomplex alpha_l = alpha;
+  scomplex beta_l  = { 0.0, 0.0 };
+
+  bli_ctransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, ( scomplex* )a, lda, &beta_l, b, ldb );
+  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+  return(0);
+ }
+
  if ( alpha.real == 1.0 && alpha.imag == 1.0)
  {
   for ( i=0; i<cols ; i++ )
@@ -668,6 +704,18 @@ static dim_t bli_zoMatCopy2_ct(dim_t rows,dim_t cols,const dcomplex alpha,const
   return(0);
  }
 
+ // With unit strides the operands are ordinary column-major matrices, so
+ // transpose in cache-sized tiles using the vectorized kernels.
+ if ( stridea == 1 && strideb == 1 )
+ {
+  dcomplex alpha_l = alpha;
+  dcomplex beta_l  = { 0.0, 0.0 };
+
+  bli_ztransposem_blk( BLIS_NO_CONJUGATE, rows, cols, &alpha_l, ( dcomplex* )a, lda, &beta_l, b, ldb );
+  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+  return(0);
+ }
+
  if ( alpha.real == 1.0 && alpha.imag == 1.0)
  {
   for ( i=0; i<cols ; i++ )
@@ -850,6 +898,18 @@ static dim_t bli_coMatCopy2_cc(dim_t rows,dim_t cols,const scomplex alpha,const
   return(0);
  }
 
+ // With unit strides the operands are ordinary column-major matrices, so
+ // transpose in cache-sized tiles using the vectorized kernels.
+ if ( stridea == 1 && strideb == 1 )
+ {
+  scomplex alpha_l = alpha;
+  scomplex beta_l  = { 0.0, 0.0 };
+
+  bli_ctransposem_blk( BLIS_CONJUGATE, rows, cols, &alpha_l, ( scomplex* )a, lda, &beta_l, b, ldb );
+  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+  return(0);
+ }
+
  if ( alpha.real == 1.0 && alpha.imag == 1.0)
  {
   for ( i=0; i<cols ; i++ )
@@ -910,6 +970,18 @@ static dim_t bli_zoMatCopy2_cc(dim_t rows,dim_t cols,const dcomplex alpha,const
   return(0);
  }
 
+ // With unit strides the operands are ordinary column-major matrices, so
+ // transpose in cache-sized tiles using the vectorized kernels.
+ if ( stridea == 1 && strideb == 1 )
+ {
+  dcomplex alpha_l = alpha;
+  dcomplex beta_l  = { 0.0, 0.0 };
+
+  bli_ztransposem_blk( BLIS_CONJUGATE, rows, cols, &alpha_l, ( dcomplex* )a, lda, &beta_l, b, ldb );
+  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2);
+  return(0);
+ }
+
  if ( alpha.real == 1.0 && alpha.imag == 1.0)
  {
   for ( i=0; i<cols ; i++ )
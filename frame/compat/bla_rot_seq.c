@@ -0,0 +1,352 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_BLAS
+
+//
+// Apply k sequences of plane rotations to the columns of an m x n matrix A.
+// Sequence q consists of the n-1 rotations
+//
+//   ( a_j, a_j+1 ) := ( c a_j + s a_j+1, c a_j+1 - s a_j ),  j = 0, ..., n-2
+//
+// with c = c[ j + q*ldcs ] and s = s[ j + q*ldcs ], applied in order of
+// increasing j, and the sequences are applied in order of increasing q. Each
+// rotation is the same as ?rot on columns j and j+1.
+//
+// Rows of A are independent of each other, so A is processed in panels of
+// rows small enough to stay in the L2 cache while all k*(n-1) rotations are
+// applied to them, instead of streaming the whole of A through the cache
+// once per rotation. Panels are distributed across threads.
+//
+
+// Target size of one row panel of A, in bytes.
+#define BLIS_ROT_SEQ_PANEL_BYTES  ( 256 * 1024 )
+
+// Panel heights are a multiple of this (and at least this) many rows.
+#define BLIS_ROT_SEQ_MR           16
+
+// Minimum number of rotated elements, m*(n-1)*k, before threads are used.
+#define BLIS_ROT_SEQ_MT_THRESH    ( 256 * 1024 )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,rotv,_ker_ft) ker, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, \
+       ctype_r* s, inc_t ldcs, \
+       ctype*   a, inc_t lda, \
+       cntx_t*  cntx  \
+     ) \
+{ \
+	ctype sigma; \
+\
+	for ( dim_t q = 0; q < k; ++q ) \
+	{ \
+		for ( dim_t j = 0; j < n - 1; ++j ) \
+		{ \
+			ctype_r* gamma = c + j + q*ldcs; \
+\
+			PASTEMAC2(chr,ch,copys)( s[ j + q*ldcs ], sigma ); \
+\
+			ker \
+			( \
+			  m, \
+			  a + (j  )*lda, 1, \
+			  a + (j+1)*lda, 1, \
+			  gamma, &sigma, cntx \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( rot_seq_panel )
+
+
+//
+// Apply the sequences to panels [p_start, p_end) of mb rows each.
+//
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,rotv,_ker_ft) ker, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, \
+       ctype_r* s, inc_t ldcs, \
+       ctype*   a, inc_t lda, \
+       dim_t    mb, \
+       dim_t    p_start, \
+       dim_t    p_end, \
+       cntx_t*  cntx  \
+     ) \
+{ \
+	for ( dim_t p = p_start; p < p_end; ++p ) \
+	{ \
+		const dim_t i      = p * mb; \
+		const dim_t m_curr = bli_min( mb, m - i ); \
+\
+		PASTEMAC(ch,rot_seq_panel) \
+		( \
+		  ker, m_curr, n, k, c, s, ldcs, a + i, lda, cntx \
+		); \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( rot_seq_panels )
+
+
+#ifdef BLIS_ENABLE_OPENMP
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,rotv,_ker_ft) ker, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, \
+       ctype_r* s, inc_t ldcs, \
+       ctype*   a, inc_t lda, \
+       dim_t    mb, \
+       dim_t    n_panels, \
+       dim_t    n_threads, \
+       cntx_t*  cntx  \
+     ) \
+{ \
+	if ( n_threads == 1 ) \
+	{ \
+		PASTEMAC(ch,rot_seq_panels) \
+		( \
+		  ker, m, n, k, c, s, ldcs, a, lda, mb, 0, n_panels, cntx \
+		); \
+		return; \
+	} \
+\
+	_Pragma( "omp parallel num_threads(n_threads)" ) \
+	{ \
+		thrinfo_t thread; \
+		dim_t     p_start; \
+		dim_t     p_end; \
+\
+		thread.n_way   = omp_get_num_threads(); \
+		thread.work_id = omp_get_thread_num(); \
+\
+		bli_thread_range_sub( &thread, n_panels, 1, FALSE, &p_start, &p_end ); \
+\
+		PASTEMAC(ch,rot_seq_panels) \
+		( \
+		  ker, m, n, k, c, s, ldcs, a, lda, mb, p_start, p_end, cntx \
+		); \
+	} \
+}
+
+#else
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,rotv,_ker_ft) ker, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, \
+       ctype_r* s, inc_t ldcs, \
+       ctype*   a, inc_t lda, \
+       dim_t    mb, \
+       dim_t    n_panels, \
+       dim_t    n_threads, \
+       cntx_t*  cntx  \
+     ) \
+{ \
+	PASTEMAC(ch,rot_seq_panels) \
+	( \
+	  ker, m, n, k, c, s, ldcs, a, lda, mb, 0, n_panels, cntx \
+	); \
+}
+
+#endif
+
+INSERT_GENTFUNCR_BASIC0( rot_seq_mt )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, \
+       ctype_r* s, inc_t ldcs, \
+       ctype*   a, inc_t lda  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	cntx_t* cntx = bli_gks_query_cntx(); \
+\
+	PASTECH2(ch,rotv,_ker_ft) ker = \
+	bli_cntx_get_l1v_ker_dt( dt, BLIS_ROTV_KER, cntx ); \
+\
+	/* Choose the panel height so that one panel fills the target size,
+	   rounded down to a multiple of BLIS_ROT_SEQ_MR. */ \
+	dim_t mb = BLIS_ROT_SEQ_PANEL_BYTES / ( n * sizeof( ctype ) ); \
+	mb = bli_max( BLIS_ROT_SEQ_MR, mb - mb % BLIS_ROT_SEQ_MR ); \
+	mb = bli_min( mb, m ); \
+\
+	dim_t n_threads = 1; \
+\
+	if ( m * ( n - 1 ) * k >= BLIS_ROT_SEQ_MT_THRESH ) \
+	{ \
+		rntm_t rntm; \
+		bli_rntm_init_from_global( &rntm ); \
+\
+		n_threads = bli_rntm_num_threads( &rntm ); \
+		n_threads = bli_max( 1, bli_min( n_threads, m / BLIS_ROT_SEQ_MR ) ); \
+\
+		/* Make sure every thread gets at least one panel. */ \
+		if ( ( m + mb - 1 ) / mb < n_threads ) \
+		{ \
+			mb = ( m + n_threads - 1 ) / n_threads; \
+			mb = ( ( mb + BLIS_ROT_SEQ_MR - 1 ) / BLIS_ROT_SEQ_MR ) * BLIS_ROT_SEQ_MR; \
+		} \
+	} \
+\
+	const dim_t n_panels = ( m + mb - 1 ) / mb; \
+\
+	n_threads = bli_min( n_threads, n_panels ); \
+\
+	PASTEMAC(ch,rot_seq_mt) \
+	( \
+	  ker, m, n, k, c, s, ldcs, a, lda, mb, n_panels, n_threads, cntx \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC0( rot_seq_blk )
+
+
+void srot_seq_ (f77_int* m, f77_int* n, f77_int* k, const float* c, const float* s, f77_int* ldcs, float* aptr, f77_int* lda)
+{
+ AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_1);
+ if ( *m < 0 || *n < 0 || *k < 0 || *ldcs < bli_max( 1, *n - 1 ) || *lda < bli_max( 1, *m ) )
+ {
+  bli_print_msg( " Invalid function parameter in srot_seq_() .", __FILE__, __LINE__ );
+  AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_1, "Invalid function parameters");
+  return ;
+ }
+ if ( *m == 0 || *n < 2 || *k == 0 )
+ {
+  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
+  return ;
+ }
+ bli_srot_seq_blk(*m,*n,*k,(float*)c,(float*)s,*ldcs,aptr,*lda);
+ AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
+ return ;
+}
+
+void drot_seq_ (f77_int* m, f77_int* n, f77_int* k, const double* c, const double* s, f77_int* ldcs, double* aptr, f77_int* lda)
+{
+ AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_1);
+ if ( *m < 0 || *n < 0 || *k < 0 || *ldcs < bli_max( 1, *n - 1 ) || *lda < bli_max( 1, *m ) )
+ {
+  bli_print_msg( " Invalid function parameter in drot_seq_() .", __FILE__, __LINE__ );
+  AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_1, "Invalid function parameters");
+  return ;
+ }
+ if ( *m == 0 || *n < 2 || *k == 0 )
+ {
+  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
+  return ;
+ }
+ bli_drot_seq_blk(*m,*n,*k,(double*)c,(double*)s,*ldcs,aptr,*lda);
+ AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
+ return ;
+}
+
+void csrot_seq_ (f77_int* m, f77_int* n, f77_int* k, const float* c, const float* s, f77_int* ldcs, scomplex* aptr, f77_int* lda)
+{
+ AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_1);
+ if ( *m < 0 || *n < 0 || *k < 0 || *ldcs < bli_max( 1, *n - 1 ) || *lda < bli_max( 1, *m ) )
+ {
+  bli_print_msg( " Invalid function parameter in csrot_seq_() .", __FILE__, __LINE__ );
+  AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_1, "Invalid function parameters");
+  return ;
+ }
+ if ( *m == 0 || *n < 2 || *k == 0 )
+ {
+  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
+  return ;
+ }
+ bli_crot_seq_blk(*m,*n,*k,(float*)c,(float*)s,*ldcs,aptr,*lda);
+ AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
+ return ;
+}
+
+void zdrot_seq_ (f77_int* m, f77_int* n, f77_int* k, const double* c, const double* s, f77_int* ldcs, dcomplex* aptr, f77_int* lda)
+{
+ AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_1);
+ if ( *m < 0 || *n < 0 || *k < 0 || *ldcs < bli_max( 1, *n - 1 ) || *lda < bli_max( 1, *m ) )
+ {
+  bli_print_msg( " Invalid function parameter in zdrot_seq_() .", __FILE__, __LINE__ );
+  AOCL_DTL_TRACE_EXIT_ERR(AOCL_DTL_LEVEL_TRACE_1, "Invalid function parameters");
+  return ;
+ }
+ if ( *m == 0 || *n < 2 || *k == 0 )
+ {
+  AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
+  return ;
+ }
+ bli_zrot_seq_blk(*m,*n,*k,(double*)c,(double*)s,*ldcs,aptr,*lda);
+ AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_1);
+ return ;
+}
+
+#endif
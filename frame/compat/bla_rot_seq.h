@@ -0,0 +1,56 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Prototype BLAS-like interfaces for applying sequences of plane rotations.
+//
+// ?rot_seq applies k sequences of n-1 plane rotations to the columns of the
+// m x n matrix A. Rotation j of sequence q acts on columns j and j+1 exactly
+// like ?rot, with cosine c[ j + q*ldcs ] and sine s[ j + q*ldcs ] (0-based).
+// Within a sequence the rotations are applied in order of increasing j, and
+// the sequences in order of increasing q.
+//
+
+#ifdef BLIS_ENABLE_BLAS
+
+BLIS_EXPORT_BLAS void srot_seq_ (f77_int* m, f77_int* n, f77_int* k, const float* c, const float* s, f77_int* ldcs, float* aptr, f77_int* lda);
+
+BLIS_EXPORT_BLAS void drot_seq_ (f77_int* m, f77_int* n, f77_int* k, const double* c, const double* s, f77_int* ldcs, double* aptr, f77_int* lda);
+
+BLIS_EXPORT_BLAS void csrot_seq_ (f77_int* m, f77_int* n, f77_int* k, const float* c, const float* s, f77_int* ldcs, scomplex* aptr, f77_int* lda);
+
+BLIS_EXPORT_BLAS void zdrot_seq_ (f77_int* m, f77_int* n, f77_int* k, const double* c, const double* s, f77_int* ldcs, dcomplex* aptr, f77_int* lda);
+
+#endif
@@ -0,0 +1,783 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_BLAS
+
+// Edge length (in elements) of the square tiles into which the operands are
+// partitioned. One tile of a plus the matching tile of b fits in the L1 cache
+// for every datatype, so the cache lines of b that are written with a large
+// stride stay resident until the whole line has been filled.
+#define BLIS_TRANSPOSEM_BLK          32
+
+// Matrices with fewer elements than this are transposed by the calling
+// thread alone; below this size the cost of waking the thread team exceeds
+// the time spent moving data.
+#define BLIS_TRANSPOSEM_MT_THRESH    ( 256 * 256 )
+
+//
+// Reference kernel, used when no vectorized kernel is available.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       conj_t           conja, \
+       dim_t            m, \
+       dim_t            n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t lda, \
+       ctype*  restrict beta, \
+       ctype*  restrict b, inc_t ldb  \
+     ) \
+{ \
+	const bool beta0 = PASTEMAC(ch,eq0)( *beta ); \
+	ctype      ai; \
+\
+	for ( dim_t j = 0; j < n; ++j ) \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		if ( bli_is_conj( conja ) ) \
+		{ \
+			PASTEMAC(ch,scal2js)( *alpha, *(a + i + j*lda), ai ); \
+		} \
+		else \
+		{ \
+			PASTEMAC(ch,scal2s)( *alpha, *(a + i + j*lda), ai ); \
+		} \
+\
+		if ( beta0 ) \
+		{ \
+			PASTEMAC(ch,copys)( ai, *(b + j + i*ldb) ); \
+		} \
+		else \
+		{ \
+			PASTEMAC(ch,xpbys)( ai, *beta, *(b + j + i*ldb) ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( transposem_ref )
+
+//
+// Select the tile kernel based on the kernel sets compiled into the library
+// and the instruction sets supported by the processor.
+//
+
+#if defined(BLIS_KERNELS_ZEN4)
+#define TRANSPOSEM_KER_AVX512( ker ) \
+	if ( bli_cpuid_is_avx512_supported() ) return ker;
+#else
+#define TRANSPOSEM_KER_AVX512( ker )
+#endif
+
+#if defined(BLIS_KERNELS_ZEN)
+#define TRANSPOSEM_KER_AVX2( ker ) \
+	if ( bli_cpuid_is_avx_supported() ) return ker;
+#else
+#define TRANSPOSEM_KER_AVX2( ker )
+#endif
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, keravx512, keravx2 ) \
+\
+static PASTECH2(ch,transposem,_ker_ft) PASTEMAC(ch,opname)( void ) \
+{ \
+	TRANSPOSEM_KER_AVX512( PASTEMAC(ch,keravx512) ) \
+	TRANSPOSEM_KER_AVX2( PASTEMAC(ch,keravx2) ) \
+\
+	return PASTEMAC(ch,transposem_ref); \
+}
+
+GENTFUNC( float,    s, transposem_ker_query, transposem_zen_int_avx512_16x16, transposem_zen_int_8x8 )
+GENTFUNC( double,   d, transposem_ker_query, transposem_zen_int_avx512_8x8,   transposem_zen_int_4x4 )
+GENTFUNC( scomplex, c, transposem_ker_query, transposem_zen_int_avx512_8x8,   transposem_zen_int_4x4 )
+GENTFUNC( dcomplex, z, transposem_ker_query, transposem_zen_int_avx512_4x4,   transposem_zen_int_2x2 )
+
+//
+// Transpose the tiles with linear indices [t_start, t_end). Tiles are
+// numbered in column-major order, so a contiguous range of tiles reads a
+// contiguous band of columns of a.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,transposem,_ker_ft) ker, \
+       conj_t  conja, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  beta, \
+       ctype*  b, inc_t ldb, \
+       dim_t   t_start, \
+       dim_t   t_end  \
+     ) \
+{ \
+	const dim_t blk     = BLIS_TRANSPOSEM_BLK; \
+	const dim_t m_tiles = ( m + blk - 1 ) / blk; \
+\
+	for ( dim_t t = t_start; t < t_end; ++t ) \
+	{ \
+		const dim_t i  = ( t % m_tiles ) * blk; \
+		const dim_t j  = ( t / m_tiles ) * blk; \
+		const dim_t mt = bli_min( blk, m - i ); \
+		const dim_t nt = bli_min( blk, n - j ); \
+\
+		ker \
+		( \
+		  conja, \
+		  mt, \
+		  nt, \
+		  alpha, \
+		  a + i + j*lda, lda, \
+		  beta, \
+		  b + j + i*ldb, ldb  \
+		); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( transposem_tiles )
+
+
+//
+// Distribute the tiles evenly across the thread team.
+//
+
+#ifdef BLIS_ENABLE_OPENMP
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,transposem,_ker_ft) ker, \
+       conj_t  conja, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  beta, \
+       ctype*  b, inc_t ldb, \
+       dim_t   n_tiles, \
+       dim_t   n_threads  \
+     ) \
+{ \
+	if ( n_threads == 1 ) \
+	{ \
+		PASTEMAC(ch,transposem_tiles) \
+		( \
+		  ker, conja, m, n, alpha, a, lda, beta, b, ldb, 0, n_tiles \
+		); \
+		return; \
+	} \
+\
+	_Pragma( "omp parallel num_threads(n_threads)" ) \
+	{ \
+		thrinfo_t thread; \
+		dim_t     t_start; \
+		dim_t     t_end; \
+\
+		thread.n_way   = omp_get_num_threads(); \
+		thread.work_id = omp_get_thread_num(); \
+\
+		bli_thread_range_sub( &thread, n_tiles, 1, FALSE, &t_start, &t_end ); \
+\
+		PASTEMAC(ch,transposem_tiles) \
+		( \
+		  ker, conja, m, n, alpha, a, lda, beta, b, ldb, t_start, t_end \
+		); \
+	} \
+}
+
+#else
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,transposem,_ker_ft) ker, \
+       conj_t  conja, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  beta, \
+       ctype*  b, inc_t ldb, \
+       dim_t   n_tiles, \
+       dim_t   n_threads  \
+     ) \
+{ \
+	PASTEMAC(ch,transposem_tiles) \
+	( \
+	  ker, conja, m, n, alpha, a, lda, beta, b, ldb, 0, n_tiles \
+	); \
+}
+
+#endif
+
+INSERT_GENTFUNC_BASIC0( transposem_blk_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conja, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       ctype*  beta, \
+       ctype*  b, inc_t ldb  \
+     ) \
+{ \
+	AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2); \
+\
+	if ( bli_zero_dim2( m, n ) ) \
+	{ \
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2); \
+		return; \
+	} \
+\
+	PASTECH2(ch,transposem,_ker_ft) ker = PASTEMAC(ch,transposem_ker_query)(); \
+\
+	const dim_t blk     = BLIS_TRANSPOSEM_BLK; \
+	const dim_t n_tiles = ( ( m + blk - 1 ) / blk ) * \
+	                      ( ( n + blk - 1 ) / blk ); \
+\
+	dim_t n_threads = 1; \
+\
+	if ( m * n >= BLIS_TRANSPOSEM_MT_THRESH ) \
+	{ \
+		rntm_t rntm; \
+		bli_rntm_init_from_global( &rntm ); \
+\
+		n_threads = bli_rntm_num_threads( &rntm ); \
+		n_threads = bli_max( 1, bli_min( n_threads, n_tiles ) ); \
+	} \
+\
+	PASTEMAC(ch,transposem_blk_mt) \
+	( \
+	  ker, conja, m, n, alpha, a, lda, beta, b, ldb, n_tiles, n_threads \
+	); \
+\
+	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2); \
+}
+
+INSERT_GENTFUNC_BASIC0( transposem_blk )
+
+//
+// In-place transpose of a square matrix. The matrix is partitioned into
+// tiles, and each pair of tiles ( I, J ) and ( J, I ) with I <= J is
+// exchanged through a tile-sized buffer on the stack. Pairs are numbered
+// column by column over the upper triangle of tiles; this function handles
+// pairs with indices in [p_start, p_end).
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,transposem,_ker_ft) ker, \
+       conj_t  conja, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       dim_t   p_start, \
+       dim_t   p_end  \
+     ) \
+{ \
+	const dim_t blk     = BLIS_TRANSPOSEM_BLK; \
+	const dim_t m_tiles = ( m + blk - 1 ) / blk; \
+\
+	ctype       buf[ BLIS_TRANSPOSEM_BLK * BLIS_TRANSPOSEM_BLK ]; \
+	ctype       zero; \
+	dim_t       p = 0; \
+\
+	PASTEMAC(ch,set0s)( zero ); \
+\
+	for ( dim_t jt = 0; jt < m_tiles; ++jt ) \
+	for ( dim_t it = 0; it <= jt; ++it, ++p ) \
+	{ \
+		if ( p <  p_start ) continue; \
+		if ( p >= p_end   ) return; \
+\
+		const dim_t i  = it * blk; \
+		const dim_t j  = jt * blk; \
+		const dim_t mi = bli_min( blk, m - i ); \
+		const dim_t nj = bli_min( blk, m - j ); \
+\
+		ctype* restrict a_ij = a + i + j*lda; \
+		ctype* restrict a_ji = a + j + i*lda; \
+\
+		/* buf := alpha * conja( A(I,J) )^T */ \
+		ker( conja, mi, nj, alpha, a_ij, lda, &zero, buf, blk ); \
+\
+		/* A(I,J) := alpha * conja( A(J,I) )^T, unless the tile is on the
+		   diagonal, in which case buf already holds the whole result. */ \
+		if ( it != jt ) \
+			ker( conja, nj, mi, alpha, a_ji, lda, &zero, a_ij, lda ); \
+\
+		/* A(J,I) := buf */ \
+		for ( dim_t c = 0; c < mi; ++c ) \
+			memcpy( a_ji + c*lda, buf + c*blk, nj * sizeof( ctype ) ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( itransposem_sq_pairs )
+
+
+#ifdef BLIS_ENABLE_OPENMP
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,transposem,_ker_ft) ker, \
+       conj_t  conja, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       dim_t   n_pairs, \
+       dim_t   n_threads  \
+     ) \
+{ \
+	if ( n_threads == 1 ) \
+	{ \
+		PASTEMAC(ch,itransposem_sq_pairs) \
+		( \
+		  ker, conja, m, alpha, a, lda, 0, n_pairs \
+		); \
+		return; \
+	} \
+\
+	_Pragma( "omp parallel num_threads(n_threads)" ) \
+	{ \
+		thrinfo_t thread; \
+		dim_t     p_start; \
+		dim_t     p_end; \
+\
+		thread.n_way   = omp_get_num_threads(); \
+		thread.work_id = omp_get_thread_num(); \
+\
+		bli_thread_range_sub( &thread, n_pairs, 1, FALSE, &p_start, &p_end ); \
+\
+		PASTEMAC(ch,itransposem_sq_pairs) \
+		( \
+		  ker, conja, m, alpha, a, lda, p_start, p_end \
+		); \
+	} \
+}
+
+#else
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,transposem,_ker_ft) ker, \
+       conj_t  conja, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+       dim_t   n_pairs, \
+       dim_t   n_threads  \
+     ) \
+{ \
+	PASTEMAC(ch,itransposem_sq_pairs) \
+	( \
+	  ker, conja, m, alpha, a, lda, 0, n_pairs \
+	); \
+}
+
+#endif
+
+INSERT_GENTFUNC_BASIC0( itransposem_sq_mt )
+
+//
+// In-place transpose of a rectangular matrix. Once the columns of A are
+// packed together, A occupies m*n contiguous elements, and the transpose is
+// carried out in units of u contiguous elements, where u is the largest
+// divisor of m (or, if it is larger, of n) that is at most
+// BLIS_TRANSPOSEM_BLK. When u divides m:
+//
+//  1. A is viewed as an ( m / u ) x n matrix of units, which is transposed
+//     by cycle-following, one unit at a time. Afterwards, rows I*u through
+//     I*u + u - 1 of A form the contiguous u x n panel I.
+//  2. Each panel is transposed in place into the n x u panel of A^T that
+//     occupies the same storage.
+//
+// When u divides n, the same steps are applied in the opposite order to the
+// m x u panels formed by the columns of A. The panels are transposed by the
+// tile kernels, which also apply alpha and conja, through a buffer of one
+// panel taken from the memory pool, and are distributed across the threads.
+//
+
+//
+// Transpose the m x n matrix of units of u elements stored at a, following
+// each cycle of the permutation that takes unit i + j*m to unit j + i*n. A
+// bitmap (one bit per unit) records which units already hold their final
+// value.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   u, \
+       ctype*  a  \
+     ) \
+{ \
+	const siz_t  n_unit = ( siz_t )m * ( siz_t )n; \
+	const siz_t  n_word = ( n_unit + 63 ) / 64; \
+	const size_t u_size = u * sizeof( ctype ); \
+\
+	uint64_t*    done   = bli_malloc_user( n_word * sizeof( uint64_t ) ); \
+	ctype        buf0[ BLIS_TRANSPOSEM_BLK ]; \
+	ctype        buf1[ BLIS_TRANSPOSEM_BLK ]; \
+\
+	memset( done, 0, n_word * sizeof( uint64_t ) ); \
+\
+	for ( siz_t k = 0; k < n_unit; ++k ) \
+	{ \
+		if ( done[ k / 64 ] & ( 1ULL << ( k % 64 ) ) ) continue; \
+\
+		ctype* val = buf0; \
+		ctype* tmp = buf1; \
+		siz_t  cur = k; \
+\
+		memcpy( val, a + k * u, u_size ); \
+\
+		while ( TRUE ) \
+		{ \
+			/* Unit ( i, j ) moves to unit ( j, i ) of the transpose. */ \
+			const siz_t i   = cur % m; \
+			const siz_t j   = cur / m; \
+			const siz_t dst = j + i * n; \
+\
+			done[ dst / 64 ] |= ( 1ULL << ( dst % 64 ) ); \
+\
+			if ( dst == k ) \
+			{ \
+				memcpy( a + dst * u, val, u_size ); \
+				break; \
+			} \
+\
+			memcpy( tmp, a + dst * u, u_size ); \
+			memcpy( a + dst * u, val, u_size ); \
+\
+			ctype* t = val; val = tmp; tmp = t; \
+			cur = dst; \
+		} \
+	} \
+\
+	bli_free_user( done ); \
+}
+
+INSERT_GENTFUNC_BASIC0( itransposem_units )
+
+//
+// Transpose the contiguous pm x pn panels with indices [p_start, p_end) of
+// the panels stored at a, each into the pn x pm panel that occupies the same
+// storage.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,transposem,_ker_ft) ker, \
+       conj_t  conja, \
+       dim_t   pm, \
+       dim_t   pn, \
+       ctype*  alpha, \
+       ctype*  a, \
+       dim_t   p_start, \
+       dim_t   p_end  \
+     ) \
+{ \
+	if ( p_start >= p_end ) return; \
+\
+	const dim_t blk     = BLIS_TRANSPOSEM_BLK; \
+	const dim_t n_tiles = ( ( pm + blk - 1 ) / blk ) * \
+	                      ( ( pn + blk - 1 ) / blk ); \
+	const siz_t p_size  = ( siz_t )pm * ( siz_t )pn; \
+\
+	rntm_t rntm; \
+	mem_t  mem; \
+	ctype  zero; \
+\
+	PASTEMAC(ch,set0s)( zero ); \
+\
+	bli_rntm_init_from_global( &rntm ); \
+	bli_rntm_set_num_threads_only( 1, &rntm ); \
+	bli_membrk_rntm_set_membrk( &rntm ); \
+	bli_membrk_acquire_m \
+	( \
+	  &rntm, p_size * sizeof( ctype ), \
+	  BLIS_BITVAL_BUFFER_FOR_A_BLOCK, &mem \
+	); \
+\
+	ctype* buf = bli_mem_buffer( &mem ); \
+\
+	for ( dim_t p = p_start; p < p_end; ++p ) \
+	{ \
+		ctype* ap = a + p * p_size; \
+\
+		memcpy( buf, ap, p_size * sizeof( ctype ) ); \
+\
+		PASTEMAC(ch,transposem_tiles) \
+		( \
+		  ker, conja, pm, pn, alpha, buf, pm, &zero, ap, pn, 0, n_tiles \
+		); \
+	} \
+\
+	bli_membrk_release( &rntm, &mem ); \
+}
+
+INSERT_GENTFUNC_BASIC0( itransposem_panels )
+
+
+#ifdef BLIS_ENABLE_OPENMP
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,transposem,_ker_ft) ker, \
+       conj_t  conja, \
+       dim_t   pm, \
+       dim_t   pn, \
+       ctype*  alpha, \
+       ctype*  a, \
+       dim_t   n_panels, \
+       dim_t   n_threads  \
+     ) \
+{ \
+	if ( n_threads == 1 ) \
+	{ \
+		PASTEMAC(ch,itransposem_panels) \
+		( \
+		  ker, conja, pm, pn, alpha, a, 0, n_panels \
+		); \
+		return; \
+	} \
+\
+	_Pragma( "omp parallel num_threads(n_threads)" ) \
+	{ \
+		thrinfo_t thread; \
+		dim_t     p_start; \
+		dim_t     p_end; \
+\
+		thread.n_way   = omp_get_num_threads(); \
+		thread.work_id = omp_get_thread_num(); \
+\
+		bli_thread_range_sub( &thread, n_panels, 1, FALSE, &p_start, &p_end ); \
+\
+		PASTEMAC(ch,itransposem_panels) \
+		( \
+		  ker, conja, pm, pn, alpha, a, p_start, p_end \
+		); \
+	} \
+}
+
+#else
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,transposem,_ker_ft) ker, \
+       conj_t  conja, \
+       dim_t   pm, \
+       dim_t   pn, \
+       ctype*  alpha, \
+       ctype*  a, \
+       dim_t   n_panels, \
+       dim_t   n_threads  \
+     ) \
+{ \
+	PASTEMAC(ch,itransposem_panels) \
+	( \
+	  ker, conja, pm, pn, alpha, a, 0, n_panels \
+	); \
+}
+
+#endif
+
+INSERT_GENTFUNC_BASIC0( itransposem_panels_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH2(ch,transposem,_ker_ft) ker, \
+       conj_t  conja, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+                  inc_t ldb, \
+       dim_t   n_threads  \
+     ) \
+{ \
+	dim_t um = BLIS_TRANSPOSEM_BLK; \
+	dim_t un = BLIS_TRANSPOSEM_BLK; \
+\
+	while ( m % um != 0 ) --um; \
+	while ( n % un != 0 ) --un; \
+\
+	/* Pack the columns of A. */ \
+	if ( lda != m ) \
+	{ \
+		for ( dim_t j = 1; j < n; ++j ) \
+			memmove( a + j*m, a + j*lda, m * sizeof( ctype ) ); \
+	} \
+\
+	if ( um >= un ) \
+	{ \
+		const dim_t n_panels = m / um; \
+\
+		PASTEMAC(ch,itransposem_units)( n_panels, n, um, a ); \
+		PASTEMAC(ch,itransposem_panels_mt) \
+		( \
+		  ker, conja, um, n, alpha, a, n_panels, \
+		  bli_min( n_threads, n_panels ) \
+		); \
+	} \
+	else \
+	{ \
+		const dim_t n_panels = n / un; \
+\
+		PASTEMAC(ch,itransposem_panels_mt) \
+		( \
+		  ker, conja, m, un, alpha, a, n_panels, \
+		  bli_min( n_threads, n_panels ) \
+		); \
+		PASTEMAC(ch,itransposem_units)( m, n_panels, un, a ); \
+	} \
+\
+	/* Spread the columns of A^T out to the requested leading dimension. */ \
+	if ( ldb != n ) \
+	{ \
+		for ( dim_t i = m - 1; i > 0; --i ) \
+			memmove( a + i*ldb, a + i*n, n * sizeof( ctype ) ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( itransposem_rect )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conja, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t lda, \
+                  inc_t ldb  \
+     ) \
+{ \
+	AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_2); \
+\
+	if ( bli_zero_dim2( m, n ) ) \
+	{ \
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2); \
+		return; \
+	} \
+\
+	PASTECH2(ch,transposem,_ker_ft) ker = PASTEMAC(ch,transposem_ker_query)(); \
+\
+	dim_t n_threads = 1; \
+\
+	if ( m * n >= BLIS_TRANSPOSEM_MT_THRESH ) \
+	{ \
+		rntm_t rntm; \
+		bli_rntm_init_from_global( &rntm ); \
+\
+		n_threads = bli_max( 1, bli_rntm_num_threads( &rntm ) ); \
+	} \
+\
+	if ( m != n || lda != ldb ) \
+	{ \
+		PASTEMAC(ch,itransposem_rect) \
+		( \
+		  ker, conja, m, n, alpha, a, lda, ldb, n_threads \
+		); \
+\
+		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2); \
+		return; \
+	} \
+\
+	const dim_t blk     = BLIS_TRANSPOSEM_BLK; \
+	const dim_t m_tiles = ( m + blk - 1 ) / blk; \
+	const dim_t n_pairs = ( m_tiles * ( m_tiles + 1 ) ) / 2; \
+\
+	n_threads = bli_min( n_threads, n_pairs ); \
+\
+	PASTEMAC(ch,itransposem_sq_mt) \
+	( \
+	  ker, conja, m, alpha, a, lda, n_pairs, n_threads \
+	); \
+\
+	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_2); \
+}
+
+INSERT_GENTFUNC_BASIC0( itransposem_blk )
+
+#endif
@@ -102,6 +102,8 @@
 #include "bla_xerbla.h"
 #include "bla_xerbla_array.h"
 
+#include "bla_fast_path.h"
+
 
 // -- Level-1 BLAS prototypes --
 
@@ -197,13 +199,19 @@
 
 // -- Batch Extension prototypes --
 #include "bla_gemm_batch.h"
+#include "bla_gemm_batch_strided.h"
+#include "bla_gemm_batch_strided_check.h"
 #include "bla_gemm3m.h"
 #include "bla_gemm3m_check.h"
+#include "bla_gemm3m_blk.h"
 // -- Transpose and Copy Routines --
+#include "bla_transposem.h"
 #include "bla_omatadd.h"
 #include "bla_omatcopy.h"
 #include "bla_omatcopy2.h"
 #include "bla_imatcopy.h"
+// -- Plane Rotation Sequences --
+#include "bla_rot_seq.h"
 
 // -- Fortran-compatible APIs to BLIS functions --
 #ifndef _WIN32
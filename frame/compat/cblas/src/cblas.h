@@ -685,6 +685,38 @@ void BLIS_EXPORT_BLAS cblas_zgemm_batch(enum CBLAS_ORDER Order,
                  f77_int *lda_array, const void **B, f77_int *ldb_array,
                  const void *beta_array, void **C, f77_int *ldc_array,
                  f77_int group_count, f77_int *group_size);
+void BLIS_EXPORT_BLAS cblas_sgemm_batch_strided(enum CBLAS_ORDER Order,
+                 enum CBLAS_TRANSPOSE TransA,
+                 enum CBLAS_TRANSPOSE TransB, f77_int M, f77_int N,
+                 f77_int K, float alpha, const float *A,
+                 f77_int lda, f77_int stridea, const float *B,
+                 f77_int ldb, f77_int strideb, float beta,
+                 float *C, f77_int ldc, f77_int stridec,
+                 f77_int batch_size);
+void BLIS_EXPORT_BLAS cblas_dgemm_batch_strided(enum CBLAS_ORDER Order,
+                 enum CBLAS_TRANSPOSE TransA,
+                 enum CBLAS_TRANSPOSE TransB, f77_int M, f77_int N,
+                 f77_int K, double alpha, const double *A,
+                 f77_int lda, f77_int stridea, const double *B,
+                 f77_int ldb, f77_int strideb, double beta,
+                 double *C, f77_int ldc, f77_int stridec,
+                 f77_int batch_size);
+void BLIS_EXPORT_BLAS cblas_cgemm_batch_strided(enum CBLAS_ORDER Order,
+                 enum CBLAS_TRANSPOSE TransA,
+                 enum CBLAS_TRANSPOSE TransB, f77_int M, f77_int N,
+                 f77_int K, const void *alpha, const void *A,
+                 f77_int lda, f77_int stridea, const void *B,
+                 f77_int ldb, f77_int strideb, const void *beta,
+                 void *C, f77_int ldc, f77_int stridec,
+                 f77_int batch_size);
+void BLIS_EXPORT_BLAS cblas_zgemm_batch_strided(enum CBLAS_ORDER Order,
+                 enum CBLAS_TRANSPOSE TransA,
+                 enum CBLAS_TRANSPOSE TransB, f77_int M, f77_int N,
+                 f77_int K, const void *alpha, const void *A,
+                 f77_int lda, f77_int stridea, const void *B,
+                 f77_int ldb, f77_int strideb, const void *beta,
+                 void *C, f77_int ldc, f77_int stridec,
+                 f77_int batch_size);
 void BLIS_EXPORT_BLAS cblas_cgemm3m(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA,
                  enum CBLAS_TRANSPOSE TransB, f77_int M, f77_int N,
                  f77_int K, const void *alpha, const void *A,
@@ -200,6 +200,10 @@
 #define F77_dgemm_batch  dgemm_batch
 #define F77_cgemm_batch  cgemm_batch
 #define F77_zgemm_batch  zgemm_batch
+#define F77_sgemm_batch_strided  sgemm_batch_strided
+#define F77_dgemm_batch_strided  dgemm_batch_strided
+#define F77_cgemm_batch_strided  cgemm_batch_strided
+#define F77_zgemm_batch_strided  zgemm_batch_strided
 
 // (BLIS_ENABLE_NO_UNDERSCORE_API) ends
 #else
@@ -388,6 +392,10 @@
 #define F77_dgemm_batch  dgemm_batch_
 #define F77_cgemm_batch  cgemm_batch_
 #define F77_zgemm_batch  zgemm_batch_
+#define F77_sgemm_batch_strided  sgemm_batch_strided_
+#define F77_dgemm_batch_strided  dgemm_batch_strided_
+#define F77_cgemm_batch_strided  cgemm_batch_strided_
+#define F77_zgemm_batch_strided  zgemm_batch_strided_
 #endif
 
 #endif /*  CBLAS_F77_H */
\ No newline at end of file
@@ -43,64 +43,28 @@
 
 /* Subroutine */ int PASTEF77(s,rot)(const bla_integer *n, bla_real *sx, const bla_integer *incx, bla_real *sy, const bla_integer *incy, const bla_real *c__, const bla_real *s)
 {
-    /* System generated locals */
-    bla_integer i__1;
-
-    /* Local variables */
-    bla_integer i__;
-    bla_real stemp;
-    bla_integer ix, iy;
-
+    float* x0;
+    float* y0;
+    inc_t incx0;
+    inc_t incy0;
 
 /*     applies a plane rotation. */
 /*     jack dongarra, linpack, 3/11/78. */
 /*     modified 12/3/93, array(1) declarations changed to array(*) */
 
-
-    /* Parameter adjustments */
-    --sy;
-    --sx;
-
     /* Function Body */
     if (*n <= 0) {
 	return 0;
     }
-    if (*incx == 1 && *incy == 1) {
-	goto L20;
-    }
 
-/*       code for unequal increments or equal increments not equal */
-/*         to 1 */
+    bli_convert_blas_incv(*n, (float*)sx, *incx, x0, incx0);
+    bli_convert_blas_incv(*n, (float*)sy, *incy, y0, incy0);
 
-    ix = 1;
-    iy = 1;
-    if (*incx < 0) {
-	ix = (-(*n) + 1) * *incx + 1;
-    }
-    if (*incy < 0) {
-	iy = (-(*n) + 1) * *incy + 1;
-    }
-    i__1 = *n;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	stemp = *c__ * sx[ix] + *s * sy[iy];
-	sy[iy] = *c__ * sy[iy] - *s * sx[ix];
-	sx[ix] = stemp;
-	ix += *incx;
-	iy += *incy;
-/* L10: */
-    }
-    return 0;
+    cntx_t* cntx = bli_gks_query_cntx();
+    srotv_ker_ft f = bli_cntx_get_l1v_ker_dt(BLIS_FLOAT, BLIS_ROTV_KER, cntx);
 
-/*       code for both increments equal to 1 */
+    f(*n, x0, incx0, y0, incy0, (float*)c__, (float*)s, cntx);
 
-L20:
-    i__1 = *n;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	stemp = *c__ * sx[i__] + *s * sy[i__];
-	sy[i__] = *c__ * sy[i__] - *s * sx[i__];
-	sx[i__] = stemp;
-/* L30: */
-    }
     return 0;
 } /* srot_ */
 
@@ -111,64 +75,28 @@ L20:
 
 /* Subroutine */ int PASTEF77(d,rot)(const bla_integer *n, bla_double *dx, const bla_integer *incx, bla_double *dy, const bla_integer *incy, const bla_double *c__, const bla_double *s)
 {
-    /* System generated locals */
-    bla_integer i__1;
-
-    /* Local variables */
-    bla_integer i__;
-    bla_double dtemp;
-    bla_integer ix, iy;
-
+    double* x0;
+    double* y0;
+    inc_t incx0;
+    inc_t incy0;
 
 /*     applies a plane rotation. */
 /*     jack dongarra, linpack, 3/11/78. */
 /*     modified 12/3/93, array(1) declarations changed to array(*) */
 
-
-    /* Parameter adjustments */
-    --dy;
-    --dx;
-
     /* Function Body */
     if (*n <= 0) {
 	return 0;
     }
-    if (*incx == 1 && *incy == 1) {
-	goto L20;
-    }
 
-/*       code for unequal increments or equal increments not equal */
-/*         to 1 */
+    bli_convert_blas_incv(*n, (double*)dx, *incx, x0, incx0);
+    bli_convert_blas_incv(*n, (double*)dy, *incy, y0, incy0);
 
-    ix = 1;
-    iy = 1;
-    if (*incx < 0) {
-	ix = (-(*n) + 1) * *incx + 1;
-    }
-    if (*incy < 0) {
-	iy = (-(*n) + 1) * *incy + 1;
-    }
-    i__1 = *n;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	dtemp = *c__ * dx[ix] + *s * dy[iy];
-	dy[iy] = *c__ * dy[iy] - *s * dx[ix];
-	dx[ix] = dtemp;
-	ix += *incx;
-	iy += *incy;
-/* L10: */
-    }
-    return 0;
+    cntx_t* cntx = bli_gks_query_cntx();
+    drotv_ker_ft f = bli_cntx_get_l1v_ker_dt(BLIS_DOUBLE, BLIS_ROTV_KER, cntx);
 
-/*       code for both increments equal to 1 */
+    f(*n, x0, incx0, y0, incy0, (double*)c__, (double*)s, cntx);
 
-L20:
-    i__1 = *n;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	dtemp = *c__ * dx[i__] + *s * dy[i__];
-	dy[i__] = *c__ * dy[i__] - *s * dx[i__];
-	dx[i__] = dtemp;
-/* L30: */
-    }
     return 0;
 } /* drot_ */
 
@@ -179,89 +107,33 @@ L20:
 
 /* Subroutine */ int PASTEF77(cs,rot)(const bla_integer *n, bla_scomplex *cx, const bla_integer *incx, bla_scomplex *cy, const bla_integer *incy, const bla_real *c__, const bla_real *s)
 {
-    /* System generated locals */
-    bla_integer i__1, i__2, i__3, i__4;
-    bla_scomplex q__1, q__2, q__3;
-
-    /* Local variables */
-    bla_integer i__;
-    bla_scomplex ctemp;
-    bla_integer ix, iy;
-
+    scomplex* x0;
+    scomplex* y0;
+    inc_t incx0;
+    inc_t incy0;
+    scomplex sigma;
 
 /*     applies a plane rotation, where the cos and sin (c and s) are bla_real */
 /*     and the vectors cx and cy are complex. */
 /*     jack dongarra, linpack, 3/11/78. */
 
-
-    /* Parameter adjustments */
-    --cy;
-    --cx;
-
     /* Function Body */
     if (*n <= 0) {
 	return 0;
     }
-    if (*incx == 1 && *incy == 1) {
-	goto L20;
-    }
 
-/*       code for unequal increments or equal increments not equal */
-/*         to 1 */
+    bli_convert_blas_incv(*n, (scomplex*)cx, *incx, x0, incx0);
+    bli_convert_blas_incv(*n, (scomplex*)cy, *incy, y0, incy0);
 
-    ix = 1;
-    iy = 1;
-    if (*incx < 0) {
-	ix = (-(*n) + 1) * *incx + 1;
-    }
-    if (*incy < 0) {
-	iy = (-(*n) + 1) * *incy + 1;
-    }
-    i__1 = *n;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	i__2 = ix;
-	bli_csets( (*c__ * bli_creal(cx[i__2])), (*c__ * bli_cimag(cx[i__2])), q__2 );
-	i__3 = iy;
-	bli_csets( (*s * bli_creal(cy[i__3])), (*s * bli_cimag(cy[i__3])), q__3 );
-	bli_csets( (bli_creal(q__2) + bli_creal(q__3)), (bli_cimag(q__2) + bli_cimag(q__3)), q__1 );
-	bli_csets( (bli_creal(q__1)), (bli_cimag(q__1)), ctemp );
-	i__2 = iy;
-	i__3 = iy;
-	bli_csets( (*c__ * bli_creal(cy[i__3])), (*c__ * bli_cimag(cy[i__3])), q__2 );
-	i__4 = ix;
-	bli_csets( (*s * bli_creal(cx[i__4])), (*s * bli_cimag(cx[i__4])), q__3 );
-	bli_csets( (bli_creal(q__2) - bli_creal(q__3)), (bli_cimag(q__2) - bli_cimag(q__3)), q__1 );
-	bli_csets( (bli_creal(q__1)), (bli_cimag(q__1)), cy[i__2] );
-	i__2 = ix;
-	bli_csets( (bli_creal(ctemp)), (bli_cimag(ctemp)), cx[i__2] );
-	ix += *incx;
-	iy += *incy;
-/* L10: */
-    }
-    return 0;
+    /* The complex kernel takes a complex sine; one with a zero imaginary
+       part selects the same code path as the real kernel. */
+    bli_csets( *s, 0.0f, sigma );
+
+    cntx_t* cntx = bli_gks_query_cntx();
+    crotv_ker_ft f = bli_cntx_get_l1v_ker_dt(BLIS_SCOMPLEX, BLIS_ROTV_KER, cntx);
+
+    f(*n, x0, incx0, y0, incy0, (float*)c__, &sigma, cntx);
 
-/*       code for both increments equal to 1 */
-
-L20:
-    i__1 = *n;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	i__2 = i__;
-	bli_csets( (*c__ * bli_creal(cx[i__2])), (*c__ * bli_cimag(cx[i__2])), q__2 );
-	i__3 = i__;
-	bli_csets( (*s * bli_creal(cy[i__3])), (*s * bli_cimag(cy[i__3])), q__3 );
-	bli_csets( (bli_creal(q__2) + bli_creal(q__3)), (bli_cimag(q__2) + bli_cimag(q__3)), q__1 );
-	bli_csets( (bli_creal(q__1)), (bli_cimag(q__1)), ctemp );
-	i__2 = i__;
-	i__3 = i__;
-	bli_csets( (*c__ * bli_creal(cy[i__3])), (*c__ * bli_cimag(cy[i__3])), q__2 );
-	i__4 = i__;
-	bli_csets( (*s * bli_creal(cx[i__4])), (*s * bli_cimag(cx[i__4])), q__3 );
-	bli_csets( (bli_creal(q__2) - bli_creal(q__3)), (bli_cimag(q__2) - bli_cimag(q__3)), q__1 );
-	bli_csets( (bli_creal(q__1)), (bli_cimag(q__1)), cy[i__2] );
-	i__2 = i__;
-	bli_csets( (bli_creal(ctemp)), (bli_cimag(ctemp)), cx[i__2] );
-/* L30: */
-    }
     return 0;
 } /* csrot_ */
 
@@ -272,89 +144,33 @@ L20:
 
 /* Subroutine */ int PASTEF77(zd,rot)(const bla_integer *n, bla_dcomplex *zx, const bla_integer *incx, bla_dcomplex *zy, const bla_integer *incy, const bla_double *c__, const bla_double *s)
 {
-    /* System generated locals */
-    bla_integer i__1, i__2, i__3, i__4;
-    bla_dcomplex z__1, z__2, z__3;
-
-    /* Local variables */
-    bla_integer i__;
-    bla_dcomplex ztemp;
-    bla_integer ix, iy;
-
+    dcomplex* x0;
+    dcomplex* y0;
+    inc_t incx0;
+    inc_t incy0;
+    dcomplex sigma;
 
 /*     applies a plane rotation, where the cos and sin (c and s) are */
 /*     double precision and the vectors zx and zy are double complex. */
 /*     jack dongarra, linpack, 3/11/78. */
 
-
-    /* Parameter adjustments */
-    --zy;
-    --zx;
-
     /* Function Body */
     if (*n <= 0) {
 	return 0;
     }
-    if (*incx == 1 && *incy == 1) {
-	goto L20;
-    }
 
-/*       code for unequal increments or equal increments not equal */
-/*         to 1 */
+    bli_convert_blas_incv(*n, (dcomplex*)zx, *incx, x0, incx0);
+    bli_convert_blas_incv(*n, (dcomplex*)zy, *incy, y0, incy0);
 
-    ix = 1;
-    iy = 1;
-    if (*incx < 0) {
-	ix = (-(*n) + 1) * *incx + 1;
-    }
-    if (*incy < 0) {
-	iy = (-(*n) + 1) * *incy + 1;
-    }
-    i__1 = *n;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	i__2 = ix;
-	bli_zsets( (*c__ * bli_zreal(zx[i__2])), (*c__ * bli_zimag(zx[i__2])), z__2 );
-	i__3 = iy;
-	bli_zsets( (*s * bli_zreal(zy[i__3])), (*s * bli_zimag(zy[i__3])), z__3 );
-	bli_zsets( (bli_zreal(z__2) + bli_zreal(z__3)), (bli_zimag(z__2) + bli_zimag(z__3)), z__1 );
-	bli_zsets( (bli_zreal(z__1)), (bli_zimag(z__1)), ztemp );
-	i__2 = iy;
-	i__3 = iy;
-	bli_zsets( (*c__ * bli_zreal(zy[i__3])), (*c__ * bli_zimag(zy[i__3])), z__2 );
-	i__4 = ix;
-	bli_zsets( (*s * bli_zreal(zx[i__4])), (*s * bli_zimag(zx[i__4])), z__3 );
-	bli_zsets( (bli_zreal(z__2) - bli_zreal(z__3)), (bli_zimag(z__2) - bli_zimag(z__3)), z__1 );
-	bli_zsets( (bli_zreal(z__1)), (bli_zimag(z__1)), zy[i__2] );
-	i__2 = ix;
-	bli_zsets( (bli_zreal(ztemp)), (bli_zimag(ztemp)), zx[i__2] );
-	ix += *incx;
-	iy += *incy;
-/* L10: */
-    }
-    return 0;
+    /* The complex kernel takes a complex sine; one with a zero imaginary
+       part selects the same code path as the real kernel. */
+    bli_zsets( *s, 0.0, sigma );
+
+    cntx_t* cntx = bli_gks_query_cntx();
+    zrotv_ker_ft f = bli_cntx_get_l1v_ker_dt(BLIS_DCOMPLEX, BLIS_ROTV_KER, cntx);
+
+    f(*n, x0, incx0, y0, incy0, (double*)c__, &sigma, cntx);
 
-/*       code for both increments equal to 1 */
-
-L20:
-    i__1 = *n;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	i__2 = i__;
-	bli_zsets( (*c__ * bli_zreal(zx[i__2])), (*c__ * bli_zimag(zx[i__2])), z__2 );
-	i__3 = i__;
-	bli_zsets( (*s * bli_zreal(zy[i__3])), (*s * bli_zimag(zy[i__3])), z__3 );
-	bli_zsets( (bli_zreal(z__2) + bli_zreal(z__3)), (bli_zimag(z__2) + bli_zimag(z__3)), z__1 );
-	bli_zsets( (bli_zreal(z__1)), (bli_zimag(z__1)), ztemp );
-	i__2 = i__;
-	i__3 = i__;
-	bli_zsets( (*c__ * bli_zreal(zy[i__3])), (*c__ * bli_zimag(zy[i__3])), z__2 );
-	i__4 = i__;
-	bli_zsets( (*s * bli_zreal(zx[i__4])), (*s * bli_zimag(zx[i__4])), z__3 );
-	bli_zsets( (bli_zreal(z__2) - bli_zreal(z__3)), (bli_zimag(z__2) - bli_zimag(z__3)), z__1 );
-	bli_zsets( (bli_zreal(z__1)), (bli_zimag(z__1)), zy[i__2] );
-	i__2 = i__;
-	bli_zsets( (bli_zreal(ztemp)), (bli_zimag(ztemp)), zx[i__2] );
-/* L30: */
-    }
     return 0;
 } /* zdrot_ */
 
@@ -43,20 +43,12 @@
 
 /* Subroutine */ int PASTEF77(s,rotm)(const bla_integer *n, bla_real *sx, const bla_integer *incx, bla_real *sy, const bla_integer *incy, const bla_real *sparam)
 {
-    /* Initialized data */
-
-    static bla_real zero = 0.f;
-    static bla_real two = 2.f;
-
-    /* System generated locals */
-    bla_integer i__1, i__2;
-
-    /* Local variables */
-    bla_integer i__;
-    bla_real w, z__, sflag;
-    bla_integer kx, ky, nsteps;
-    bla_real sh11, sh12, sh21, sh22;
-
+    float* x0;
+    float* y0;
+    inc_t incx0;
+    inc_t incy0;
+    float sflag;
+    float h[4];
 
 /*     APPLY THE MODIFIED GIVENS TRANSFORMATION, H, TO THE 2 BY N MATRIX */
 
@@ -74,131 +66,40 @@
 /*       (SH21  SH22),   (SH21  1.E0),   (-1.E0 SH22),   (0.E0  1.E0). */
 /*     SEE  SROTMG FOR A DESCRIPTION OF DATA STORAGE IN SPARAM. */
 
-    /* Parameter adjustments */
-    --sparam;
-    --sy;
-    --sx;
-
     /* Function Body */
 
-    sflag = sparam[1];
-    if (*n <= 0 || sflag + two == zero) {
-	goto L140;
-    }
-    if (! (*incx == *incy && *incx > 0)) {
-	goto L70;
-    }
-
-    nsteps = *n * *incx;
-    if (sflag < 0.f) {
-	goto L50;
-    } else if (sflag == 0) {
-	goto L10;
+    sflag = sparam[0];
+    if (*n <= 0 || sflag == -2.) {
+	return 0;
+    }
+
+    /* Expand the packed form of H into a full 2x2 matrix stored by
+       columns, which is what the rotmv kernel expects. */
+    if (sflag < 0.) {
+	h[0] = sparam[1];
+	h[1] = sparam[2];
+	h[2] = sparam[3];
+	h[3] = sparam[4];
+    } else if (sflag == 0.) {
+	h[0] = 1.f;
+	h[1] = sparam[2];
+	h[2] = sparam[3];
+	h[3] = 1.f;
     } else {
-	goto L30;
-    }
-L10:
-    sh12 = sparam[4];
-    sh21 = sparam[3];
-    i__1 = nsteps;
-    i__2 = *incx;
-    for (i__ = 1; i__2 < 0 ? i__ >= i__1 : i__ <= i__1; i__ += i__2) {
-	w = sx[i__];
-	z__ = sy[i__];
-	sx[i__] = w + z__ * sh12;
-	sy[i__] = w * sh21 + z__;
-/* L20: */
-    }
-    goto L140;
-L30:
-    sh11 = sparam[2];
-    sh22 = sparam[5];
-    i__2 = nsteps;
-    i__1 = *incx;
-    for (i__ = 1; i__1 < 0 ? i__ >= i__2 : i__ <= i__2; i__ += i__1) {
-	w = sx[i__];
-	z__ = sy[i__];
-	sx[i__] = w * sh11 + z__;
-	sy[i__] = -w + sh22 * z__;
-/* L40: */
-    }
-    goto L140;
-L50:
-    sh11 = sparam[2];
-    sh12 = sparam[4];
-    sh21 = sparam[3];
-    sh22 = sparam[5];
-    i__1 = nsteps;
-    i__2 = *incx;
-    for (i__ = 1; i__2 < 0 ? i__ >= i__1 : i__ <= i__1; i__ += i__2) {
-	w = sx[i__];
-	z__ = sy[i__];
-	sx[i__] = w * sh11 + z__ * sh12;
-	sy[i__] = w * sh21 + z__ * sh22;
-/* L60: */
-    }
-    goto L140;
-L70:
-    kx = 1;
-    ky = 1;
-    if (*incx < 0) {
-	kx = (1 - *n) * *incx + 1;
-    }
-    if (*incy < 0) {
-	ky = (1 - *n) * *incy + 1;
+	h[0] = sparam[1];
+	h[1] = -1.f;
+	h[2] = 1.f;
+	h[3] = sparam[4];
     }
 
-    if (sflag < 0.f) {
-	goto L120;
-    } else if (sflag == 0) {
-	goto L80;
-    } else {
-	goto L100;
-    }
-L80:
-    sh12 = sparam[4];
-    sh21 = sparam[3];
-    i__2 = *n;
-    for (i__ = 1; i__ <= i__2; ++i__) {
-	w = sx[kx];
-	z__ = sy[ky];
-	sx[kx] = w + z__ * sh12;
-	sy[ky] = w * sh21 + z__;
-	kx += *incx;
-	ky += *incy;
-/* L90: */
-    }
-    goto L140;
-L100:
-    sh11 = sparam[2];
-    sh22 = sparam[5];
-    i__2 = *n;
-    for (i__ = 1; i__ <= i__2; ++i__) {
-	w = sx[kx];
-	z__ = sy[ky];
-	sx[kx] = w * sh11 + z__;
-	sy[ky] = -w + sh22 * z__;
-	kx += *incx;
-	ky += *incy;
-/* L110: */
-    }
-    goto L140;
-L120:
-    sh11 = sparam[2];
-    sh12 = sparam[4];
-    sh21 = sparam[3];
-    sh22 = sparam[5];
-    i__2 = *n;
-    for (i__ = 1; i__ <= i__2; ++i__) {
-	w = sx[kx];
-	z__ = sy[ky];
-	sx[kx] = w * sh11 + z__ * sh12;
-	sy[ky] = w * sh21 + z__ * sh22;
-	kx += *incx;
-	ky += *incy;
-/* L130: */
-    }
-L140:
+    bli_convert_blas_incv(*n, (float*)sx, *incx, x0, incx0);
+    bli_convert_blas_incv(*n, (float*)sy, *incy, y0, incy0);
+
+    cntx_t* cntx = bli_gks_query_cntx();
+    srotmv_ker_ft f = bli_cntx_get_l1v_ker_dt(BLIS_FLOAT, BLIS_ROTMV_KER, cntx);
+
+    f(*n, x0, incx0, y0, incy0, h, cntx);
+
     return 0;
 } /* srotm_ */
 
@@ -209,20 +110,12 @@ L140:
 
 /* Subroutine */ int PASTEF77(d,rotm)(const bla_integer *n, bla_double *dx, const bla_integer *incx, bla_double *dy, const bla_integer *incy, const bla_double *dparam)
 {
-    /* Initialized data */
-
-    static bla_double zero = 0.;
-    static bla_double two = 2.;
-
-    /* System generated locals */
-    bla_integer i__1, i__2;
-
-    /* Local variables */
-    bla_integer i__;
-    bla_double dflag, w, z__;
-    bla_integer kx, ky, nsteps;
-    bla_double dh11, dh12, dh22, dh21;
-
+    double* x0;
+    double* y0;
+    inc_t incx0;
+    inc_t incy0;
+    double dflag;
+    double h[4];
 
 /*     APPLY THE MODIFIED GIVENS TRANSFORMATION, H, TO THE 2 BY N MATRIX */
 
@@ -240,131 +133,40 @@ L140:
 /*       (DH21  DH22),   (DH21  1.D0),   (-1.D0 DH22),   (0.D0  1.D0). */
 /*     SEE DROTMG FOR A DESCRIPTION OF DATA STORAGE IN DPARAM. */
 
-    /* Parameter adjustments */
-    --dparam;
-    --dy;
-    --dx;
-
     /* Function Body */
 
-    dflag = dparam[1];
-    if (*n <= 0 || dflag + two == zero) {
-	goto L140;
-    }
-    if (! (*incx == *incy && *incx > 0)) {
-	goto L70;
+    dflag = dparam[0];
+    if (*n <= 0 || dflag == -2.) {
+	return 0;
     }
 
-    nsteps = *n * *incx;
+    /* Expand the packed form of H into a full 2x2 matrix stored by
+       columns, which is what the rotmv kernel expects. */
     if (dflag < 0.) {
-	goto L50;
-    } else if (dflag == 0) {
-	goto L10;
+	h[0] = dparam[1];
+	h[1] = dparam[2];
+	h[2] = dparam[3];
+	h[3] = dparam[4];
+    } else if (dflag == 0.) {
+	h[0] = 1.;
+	h[1] = dparam[2];
+	h[2] = dparam[3];
+	h[3] = 1.;
     } else {
-	goto L30;
-    }
-L10:
-    dh12 = dparam[4];
-    dh21 = dparam[3];
-    i__1 = nsteps;
-    i__2 = *incx;
-    for (i__ = 1; i__2 < 0 ? i__ >= i__1 : i__ <= i__1; i__ += i__2) {
-	w = dx[i__];
-	z__ = dy[i__];
-	dx[i__] = w + z__ * dh12;
-	dy[i__] = w * dh21 + z__;
-/* L20: */
-    }
-    goto L140;
-L30:
-    dh11 = dparam[2];
-    dh22 = dparam[5];
-    i__2 = nsteps;
-    i__1 = *incx;
-    for (i__ = 1; i__1 < 0 ? i__ >= i__2 : i__ <= i__2; i__ += i__1) {
-	w = dx[i__];
-	z__ = dy[i__];
-	dx[i__] = w * dh11 + z__;
-	dy[i__] = -w + dh22 * z__;
-/* L40: */
-    }
-    goto L140;
-L50:
-    dh11 = dparam[2];
-    dh12 = dparam[4];
-    dh21 = dparam[3];
-    dh22 = dparam[5];
-    i__1 = nsteps;
-    i__2 = *incx;
-    for (i__ = 1; i__2 < 0 ? i__ >= i__1 : i__ <= i__1; i__ += i__2) {
-	w = dx[i__];
-	z__ = dy[i__];
-	dx[i__] = w * dh11 + z__ * dh12;
-	dy[i__] = w * dh21 + z__ * dh22;
-/* L60: */
-    }
-    goto L140;
-L70:
-    kx = 1;
-    ky = 1;
-    if (*incx < 0) {
-	kx = (1 - *n) * *incx + 1;
-    }
-    if (*incy < 0) {
-	ky = (1 - *n) * *incy + 1;
+	h[0] = dparam[1];
+	h[1] = -1.;
+	h[2] = 1.;
+	h[3] = dparam[4];
     }
 
-    if (dflag < 0.) {
-	goto L120;
-    } else if (dflag == 0) {
-	goto L80;
-    } else {
-	goto L100;
-    }
-L80:
-    dh12 = dparam[4];
-    dh21 = dparam[3];
-    i__2 = *n;
-    for (i__ = 1; i__ <= i__2; ++i__) {
-	w = dx[kx];
-	z__ = dy[ky];
-	dx[kx] = w + z__ * dh12;
-	dy[ky] = w * dh21 + z__;
-	kx += *incx;
-	ky += *incy;
-/* L90: */
-    }
-    goto L140;
-L100:
-    dh11 = dparam[2];
-    dh22 = dparam[5];
-    i__2 = *n;
-    for (i__ = 1; i__ <= i__2; ++i__) {
-	w = dx[kx];
-	z__ = dy[ky];
-	dx[kx] = w * dh11 + z__;
-	dy[ky] = -w + dh22 * z__;
-	kx += *incx;
-	ky += *incy;
-/* L110: */
-    }
-    goto L140;
-L120:
-    dh11 = dparam[2];
-    dh12 = dparam[4];
-    dh21 = dparam[3];
-    dh22 = dparam[5];
-    i__2 = *n;
-    for (i__ = 1; i__ <= i__2; ++i__) {
-	w = dx[kx];
-	z__ = dy[ky];
-	dx[kx] = w * dh11 + z__ * dh12;
-	dy[ky] = w * dh21 + z__ * dh22;
-	kx += *incx;
-	ky += *incy;
-/* L130: */
-    }
-L140:
+    bli_convert_blas_incv(*n, (double*)dx, *incx, x0, incx0);
+    bli_convert_blas_incv(*n, (double*)dy, *incy, y0, incy0);
+
+    cntx_t* cntx = bli_gks_query_cntx();
+    drotmv_ker_ft f = bli_cntx_get_l1v_ker_dt(BLIS_DOUBLE, BLIS_ROTMV_KER, cntx);
+
+    f(*n, x0, incx0, y0, incy0, h, cntx);
+
     return 0;
 } /* drotm_ */
 
@@ -704,10 +704,12 @@ typedef enum
 	BLIS_SETV_KER,
 	BLIS_SUBV_KER,
 	BLIS_SWAPV_KER,
-	BLIS_XPBYV_KER
+	BLIS_XPBYV_KER,
+	BLIS_ROTV_KER,
+	BLIS_ROTMV_KER
 } l1vkr_t;
 
-#define BLIS_NUM_LEVEL1V_KERS 15
+#define BLIS_NUM_LEVEL1V_KERS 17
 
 
 typedef enum
@@ -803,10 +805,14 @@ typedef enum
 	BLIS_GEMMTRSM_U_UKR,
 	BLIS_TRSM_L_UKR,
 	BLIS_TRSM_U_UKR,
-	BLIS_GEMM_AVX2_UKR
+	BLIS_GEMM_AVX2_UKR,
+	BLIS_GEMMT_L_UKR,
+	BLIS_GEMMT_U_UKR,
+	BLIS_TRMM_L_UKR,
+	BLIS_TRMM_U_UKR
 } l3ukr_t;
 
-#define BLIS_NUM_LEVEL3_UKRS 6
+#define BLIS_NUM_LEVEL3_UKRS 10
 
 
 typedef enum
@@ -1216,6 +1222,11 @@ typedef struct
 	inc_t  ps_a;
 	inc_t  ps_b;
 
+	// The diagonal offset of the micro-tile of C. This is only used by the
+	// gemmt micro-kernels, which update only the lower (or upper) part of
+	// a micro-tile that intersects the diagonal.
+	doff_t diagoff;
+
 	// The type to convert to on output.
 	//num_t  dt_on_output;
 
@@ -1488,6 +1499,8 @@ typedef struct rntm_s
 	bool      l3_sup; // enable/disable small matrix handling in level-3 ops.
 	                  // blis_mt, flag to figure out whether number of
 	bool      blis_mt;// threads is set using BLIS APIS or OpenMP APIs.
+	dim_t     strassen_levels; // levels of Strassen recursion for large gemm.
+	bool      pack_b_pipeline; // overlap packing of B with computation.
 
 	// "Internal" fields: these should not be exposed to the end-user.
 
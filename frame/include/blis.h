@@ -135,6 +135,7 @@ extern "C" {
 #include "bli_info.h"
 #include "bli_arch.h"
 #include "bli_cpuid.h"
+#include "bli_cache.h"
 #include "bli_string.h"
 #include "bli_setgetij.h"
 #include "bli_setri.h"
@@ -0,0 +1,321 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+
+#include "blis.h"
+
+#ifdef __linux__
+
+// The affinity policy, and the CPUs that the process may run on, in
+// topology order (see bli_affinity.h). The CPUs of L3 domain d are
+// topo_cpus[ topo_dom_start[ d ] ] through
+// topo_cpus[ topo_dom_start[ d + 1 ] - 1 ].
+static affinity_t policy         = BLIS_AFFINITY_NONE;
+static int*       topo_cpus      = NULL;
+static int        topo_n_cpus    = 0;
+static int*       topo_dom_start = NULL;
+static int        topo_n_doms    = 0;
+static int        topo_dom_min   = 0;
+
+static bli_pthread_once_t affinity_once = BLIS_PTHREAD_ONCE_INIT;
+
+// The affinity of the calling thread before it was bound. Only the thread
+// with id 0, which is the application thread that called BLIS, saves and
+// restores its affinity.
+static BLIS_THREAD_LOCAL bool      is_bound = FALSE;
+static BLIS_THREAD_LOCAL cpu_set_t saved_mask;
+
+typedef struct
+{
+	int pkg;
+	int l3;
+	int smt;
+	int cpu;
+} topo_cpu_t;
+
+// Read the first integer in a sysfs file, or return -1 if there is none.
+static int bli_affinity_read_int( const char* path )
+{
+	FILE* f = fopen( path, "r" );
+	int   v = -1;
+
+	if ( f == NULL ) return -1;
+	if ( fscanf( f, "%d", &v ) != 1 ) v = -1;
+	fclose( f );
+
+	return v;
+}
+
+// Return the first CPU that shares the L3 cache with the given CPU, which
+// identifies its L3 domain, or -1 if it is unknown.
+static int bli_affinity_query_l3( int cpu )
+{
+	char path[ 128 ];
+
+	for ( int i = 0; i < 8; ++i )
+	{
+		sprintf( path, "/sys/devices/system/cpu/cpu%d/cache/index%d/level", cpu, i );
+
+		const int level = bli_affinity_read_int( path );
+
+		if ( level < 0 ) break;
+		if ( level != 3 ) continue;
+
+		sprintf( path, "/sys/devices/system/cpu/cpu%d/cache/index%d/shared_cpu_list", cpu, i );
+
+		return bli_affinity_read_int( path );
+	}
+
+	return -1;
+}
+
+static int bli_affinity_cmp( const void* p0, const void* p1 )
+{
+	const topo_cpu_t* c0 = p0;
+	const topo_cpu_t* c1 = p1;
+
+	if ( c0->pkg != c1->pkg ) return c0->pkg < c1->pkg ? -1 : 1;
+	if ( c0->l3  != c1->l3  ) return c0->l3  < c1->l3  ? -1 : 1;
+	if ( c0->smt != c1->smt ) return c0->smt < c1->smt ? -1 : 1;
+	if ( c0->cpu != c1->cpu ) return c0->cpu < c1->cpu ? -1 : 1;
+
+	return 0;
+}
+
+static void bli_affinity_init( void )
+{
+	const char* env = getenv( "BLIS_AFFINITY" );
+	cpu_set_t   mask;
+	char        path[ 128 ];
+
+	if ( env == NULL ) return;
+
+	if      ( strcmp( env, "compact" ) == 0 ) policy = BLIS_AFFINITY_COMPACT;
+	else if ( strcmp( env, "l3" ) == 0 ||
+	          strcmp( env, "ccx" ) == 0 )     policy = BLIS_AFFINITY_L3;
+	else                                      return;
+
+	// Only the CPUs that the process may run on are used.
+	if ( sched_getaffinity( 0, sizeof( mask ), &mask ) != 0 ||
+	     CPU_COUNT( &mask ) == 0 )
+	{
+		policy = BLIS_AFFINITY_NONE;
+		return;
+	}
+
+	const int   n_cpus = CPU_COUNT( &mask );
+	topo_cpu_t* cpus   = bli_malloc_intl( n_cpus * sizeof( topo_cpu_t ) );
+	int         n      = 0;
+
+	for ( int cpu = 0; cpu < CPU_SETSIZE && n < n_cpus; ++cpu )
+	{
+		if ( !CPU_ISSET( cpu, &mask ) ) continue;
+
+		sprintf( path, "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu );
+		cpus[ n ].pkg = bli_affinity_read_int( path );
+
+		sprintf( path, "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", cpu );
+		const int sibling0 = bli_affinity_read_int( path );
+
+		// A CPU other than the first of its core is an SMT sibling.
+		cpus[ n ].smt = ( sibling0 >= 0 && sibling0 != cpu );
+		cpus[ n ].l3  = bli_affinity_query_l3( cpu );
+		cpus[ n ].cpu = cpu;
+
+		// Without an L3, each package is a domain.
+		if ( cpus[ n ].l3 < 0 ) cpus[ n ].l3 = cpus[ n ].pkg;
+
+		++n;
+	}
+
+	qsort( cpus, n, sizeof( topo_cpu_t ), bli_affinity_cmp );
+
+	topo_cpus      = bli_malloc_intl( n * sizeof( int ) );
+	topo_dom_start = bli_malloc_intl( ( n + 1 ) * sizeof( int ) );
+	topo_n_cpus    = n;
+
+	for ( int i = 0; i < n; ++i )
+	{
+		if ( i == 0 || cpus[ i ].pkg != cpus[ i - 1 ].pkg ||
+		               cpus[ i ].l3  != cpus[ i - 1 ].l3 )
+			topo_dom_start[ topo_n_doms++ ] = i;
+
+		topo_cpus[ i ] = cpus[ i ].cpu;
+	}
+
+	topo_dom_start[ topo_n_doms ] = n;
+
+	topo_dom_min = n;
+	for ( int d = 0; d < topo_n_doms; ++d )
+		topo_dom_min = bli_min( topo_dom_min,
+		                        topo_dom_start[ d + 1 ] - topo_dom_start[ d ] );
+
+	bli_free_intl( cpus );
+}
+
+affinity_t bli_affinity_policy( void )
+{
+	bli_pthread_once( &affinity_once, bli_affinity_init );
+
+	return policy;
+}
+
+dim_t bli_affinity_l3_domains( dim_t n_threads )
+{
+	if ( bli_affinity_policy() != BLIS_AFFINITY_L3 || n_threads < 1 )
+		return 1;
+
+	// Use as many domains as possible while giving each the same number of
+	// threads, which must not exceed the number of CPUs of any domain.
+	// Otherwise, the threads fill the CPUs in order, as if one domain were
+	// used.
+	dim_t n_doms = bli_min( topo_n_doms, n_threads );
+
+	while ( n_doms > 1 && ( n_threads % n_doms != 0 ||
+	                        n_threads / n_doms > topo_dom_min ) ) --n_doms;
+
+	return n_doms;
+}
+
+// Return the CPU to which the thread with id tid in a team of n_threads
+// threads should be bound.
+static int bli_affinity_cpu( dim_t tid, dim_t n_threads, rntm_t* rntm )
+{
+	if ( policy == BLIS_AFFINITY_COMPACT )
+		return topo_cpus[ tid % topo_n_cpus ];
+
+	// Thread ids are assigned to the loops from the outside in, so the ic
+	// caucuses consist of consecutive threads and are numbered in jc-major
+	// order.
+	dim_t n_cauc = bli_max( bli_rntm_jc_ways( rntm ), 1 ) *
+	               bli_max( bli_rntm_pc_ways( rntm ), 1 ) *
+	               bli_max( bli_rntm_ic_ways( rntm ), 1 );
+
+	if ( n_threads % n_cauc != 0 ) n_cauc = 1;
+
+	const dim_t tpc    = n_threads / n_cauc;
+	const dim_t cauc   = tid / tpc;
+	const dim_t n_used = bli_affinity_l3_domains( n_threads );
+
+	// Assign consecutive caucuses to each of the n_used domains, which are
+	// spread evenly over those of the system, and compute the position of
+	// the thread among those assigned to the domain. If the jc ways are a
+	// multiple of n_used, each jc group (and thus each packed block of B)
+	// stays within one domain. If a domain has too few CPUs, the threads
+	// spill over into the next domains.
+	const dim_t used  = ( cauc * n_used ) / n_cauc;
+	const dim_t dom   = ( used * topo_n_doms ) / n_used;
+	const dim_t cauc0 = ( used * n_cauc + n_used - 1 ) / n_used;
+	const dim_t slot  = tid - cauc0 * tpc;
+
+	return topo_cpus[ ( topo_dom_start[ dom ] + slot ) % topo_n_cpus ];
+}
+
+void bli_affinity_bind( dim_t tid, rntm_t* rntm )
+{
+	const dim_t n_threads = bli_rntm_num_threads( rntm );
+	cpu_set_t   cur;
+	cpu_set_t   mask;
+
+	if ( bli_affinity_policy() == BLIS_AFFINITY_NONE || n_threads <= 1 )
+		return;
+
+	const int cpu = bli_affinity_cpu( tid, n_threads, rntm );
+
+	if ( sched_getaffinity( 0, sizeof( cur ), &cur ) != 0 )
+		return;
+
+	// The worker threads stay bound between operations. A worker that is
+	// reused with the same placement (e.g. from the OpenMP thread pool)
+	// needs no further system call. The current mask is checked rather than
+	// remembered, since the application may have changed it in the meantime.
+	if ( CPU_COUNT( &cur ) == 1 && CPU_ISSET( cpu, &cur ) )
+		return;
+
+	CPU_ZERO( &mask );
+	CPU_SET( cpu, &mask );
+
+	if ( sched_setaffinity( 0, sizeof( mask ), &mask ) != 0 )
+		return;
+
+	// The application thread gets its previous affinity back at the end of
+	// the operation, so that neither it nor the threads it creates later
+	// inherit the binding.
+	if ( tid == 0 )
+	{
+		saved_mask = cur;
+		is_bound   = TRUE;
+	}
+}
+
+void bli_affinity_unbind( void )
+{
+	if ( !is_bound ) return;
+
+	sched_setaffinity( 0, sizeof( saved_mask ), &saved_mask );
+
+	is_bound = FALSE;
+}
+
+#else
+
+affinity_t bli_affinity_policy( void )
+{
+	return BLIS_AFFINITY_NONE;
+}
+
+void bli_affinity_bind( dim_t tid, rntm_t* rntm )
+{
+	( void )tid;
+	( void )rntm;
+}
+
+dim_t bli_affinity_l3_domains( dim_t n_threads )
+{
+	( void )n_threads;
+
+	return 1;
+}
+
+void bli_affinity_unbind( void )
+{
+}
+
+#endif
+
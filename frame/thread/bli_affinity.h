@@ -0,0 +1,86 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_AFFINITY_H
+#define BLIS_AFFINITY_H
+
+// Thread affinity policies, as selected by the BLIS_AFFINITY environment
+// variable.
+typedef enum
+{
+	// Leave thread placement to the caller and the OS (the default).
+	BLIS_AFFINITY_NONE = 0,
+
+	// Bind thread i to the ith CPU in topology order, that is, with the
+	// CPUs grouped by package and then by the L3 cache that they share,
+	// and with one CPU per core preceding any SMT siblings.
+	BLIS_AFFINITY_COMPACT,
+
+	// Spread the threads evenly over as many L3 domains (e.g. CCXs) as
+	// possible (see bli_affinity_l3_domains()), in package order, and bind
+	// consecutive ic caucuses (the groups of threads that share a packed
+	// block of A) to each domain, with the threads of each caucus filling
+	// the cores of its domain. The automatic factorization of the ways of
+	// parallelism then gives each domain its own jc groups, so that each
+	// packed block of B is shared only by threads that share an L3.
+	BLIS_AFFINITY_L3,
+} affinity_t;
+
+affinity_t bli_affinity_policy( void );
+
+// Return the number of L3 domains over which a team of n_threads threads is
+// spread, which is the largest divisor of n_threads that does not exceed the
+// number of domains of the system and leaves no domain with more threads than
+// CPUs, or 1 if there is none or if the policy is not BLIS_AFFINITY_L3.
+dim_t bli_affinity_l3_domains( dim_t n_threads );
+
+// The minimum number of columns of C per L3 domain for which the automatic
+// factorization of the ways of parallelism partitions the jc loop by domain.
+#ifndef BLIS_AFFINITY_L3_MIN_N
+#define BLIS_AFFINITY_L3_MIN_N 256
+#endif
+
+// Bind the calling thread, which has id tid in a team with the ways of
+// parallelism in rntm, according to the affinity policy. Worker threads
+// (tid > 0) remain bound afterwards; the calling thread (tid 0) gets its
+// previous affinity back from bli_affinity_unbind(), which does nothing on
+// the other threads. Neither does anything if the policy is
+// BLIS_AFFINITY_NONE, if the team has only one thread, or if the OS does not
+// support it.
+void bli_affinity_bind( dim_t tid, rntm_t* rntm );
+void bli_affinity_unbind( void );
+
+#endif
+
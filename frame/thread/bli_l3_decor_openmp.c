@@ -78,25 +78,51 @@ void bli_l3_thread_decorator
 
 	// NOTE: The sba was initialized in bli_init().
 
-	// Check out an array_t from the small block allocator. This is done
-	// with an internal lock to ensure only one application thread accesses
-	// the sba at a time. bli_sba_checkout_array() will also automatically
-	// resize the array_t, if necessary.
-	array_t* restrict array = bli_sba_checkout_array( n_threads );
+	// Look for a cached plan (see bli_l3_plan.h) that matches this call.
+	// A plan provides the array_t and global communicator, as well as the
+	// control and thrinfo_t trees that the threads will reuse below.
+	// Plans are not used when we are already inside a parallel region,
+	// since OpenMP may then give us fewer threads than requested.
+	l3plan_t* plan = NULL;
 
-	// Access the pool_t* for thread 0 and embed it into the rntm. We do
-	// this up-front only so that we have the rntm_t.sba_pool field
-	// initialized and ready for the global communicator creation below.
-	bli_sba_rntm_set_pool( 0, array, rntm );
+	if ( n_threads == 1 || !omp_in_parallel() )
+		plan = bli_l3_plan_checkout( family, schema_a, schema_b, a, rntm, cntl );
+
+	array_t*   restrict array;
+	thrcomm_t* restrict gl_comm;
+
+	if ( plan != NULL )
+	{
+		array   = bli_l3_plan_array( plan );
+		gl_comm = bli_l3_plan_gl_comm( plan );
+	}
+	else
+	{
+		// Check out an array_t from the small block allocator. This is done
+		// with an internal lock to ensure only one application thread
+		// accesses the sba at a time. bli_sba_checkout_array() will also
+		// automatically resize the array_t, if necessary.
+		array = bli_sba_checkout_array( n_threads );
+
+		// Access the pool_t* for thread 0 and embed it into the rntm. We do
+		// this up-front only so that we have the rntm_t.sba_pool field
+		// initialized and ready for the global communicator creation below.
+		bli_sba_rntm_set_pool( 0, array, rntm );
+
+		// Allocate a global communicator for the root thrinfo_t structures.
+		gl_comm = bli_thrcomm_create( rntm, n_threads );
+	}
 
 	// Set the packing block allocator field of the rntm. This will be
 	// inherited by all of the child threads when they make local copies of
 	// the rntm below.
 	bli_membrk_rntm_set_membrk( rntm );
 
-	// Allocate a global communicator for the root thrinfo_t structures.
-	thrcomm_t* restrict gl_comm = bli_thrcomm_create( rntm, n_threads );
-
+	// If a plan was checked out but the team turns out to be smaller than
+	// the plan was built for, the threads fall back to the uncached path
+	// below. The chief thread then creates the global communicator and
+	// shares it with the team through this variable.
+	thrcomm_t* gl_comm_fb = NULL;
 
 	_Pragma( "omp parallel num_threads(n_threads)" )
 	{
@@ -109,15 +135,19 @@ void bli_l3_thread_decorator
 		// Query the thread's id from OpenMP.
 		const dim_t tid = omp_get_thread_num();
 
-		// Check for a somewhat obscure OpenMP thread-mistmatch issue.
-		bli_l3_thread_decorator_thread_check( n_threads, tid, gl_comm, rntm_p );
-
 		// Use the thread id to access the appropriate pool_t* within the
 		// array_t, and use it to set the sba_pool field within the rntm_t.
 		// If the pool_t* element within the array_t is NULL, it will first
 		// be allocated/initialized.
 		bli_sba_rntm_set_pool( tid, array, rntm_p );
 
+		// Bind the thread to a CPU if an affinity policy was requested.
+		bli_affinity_bind( tid, rntm_p );
+
+		// The plan's trees were built for a team of n_threads, so they may
+		// only be used if that is what we got.
+		const bool use_plan = ( plan != NULL &&
+		                        omp_get_num_threads() == n_threads );
 
 		obj_t      a_t, b_t, c_t;
 		cntl_t*    cntl_use;
@@ -132,12 +162,42 @@ void bli_l3_thread_decorator
 		bli_obj_alias_to( b, &b_t );
 		bli_obj_alias_to( c, &c_t );
 
-		// Create a default control tree for the operation, if needed.
-		bli_l3_cntl_create_if( family, schema_a, schema_b,
-		                       &a_t, &b_t, &c_t, rntm_p, cntl, &cntl_use );
+		if ( use_plan )
+		{
+			// Fetch the thread's control tree and thrinfo_t tree from the
+			// plan, creating them if this is the plan's first use.
+			bli_l3_plan_thread_init( plan, tid, family, schema_a, schema_b,
+			                         &a_t, &b_t, &c_t, rntm_p,
+			                         &cntl_use, &thread );
+		}
+		else
+		{
+			thrcomm_t* gl_comm_use = gl_comm;
+
+			// Leave the plan's communicator alone if the team is not the
+			// size we asked for. Every thread of the team takes this branch,
+			// so the chief can create one communicator for all of them; like
+			// any other, it is freed by the chief in bli_l3_thrinfo_free().
+			if ( plan != NULL )
+			{
+				if ( tid == 0 )
+					gl_comm_fb = bli_thrcomm_create( rntm_p, n_threads );
+
+				_Pragma( "omp barrier" )
+
+				gl_comm_use = gl_comm_fb;
+			}
 
-		// Create the root node of the current thread's thrinfo_t structure.
-		bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
+			// Check for a somewhat obscure OpenMP thread-mistmatch issue.
+			bli_l3_thread_decorator_thread_check( n_threads, tid, gl_comm_use, rntm_p );
+
+			// Create a default control tree for the operation, if needed.
+			bli_l3_cntl_create_if( family, schema_a, schema_b,
+			                       &a_t, &b_t, &c_t, rntm_p, cntl, &cntl_use );
+
+			// Create the root node of the current thread's thrinfo_t structure.
+			bli_l3_thrinfo_create_root( tid, gl_comm_use, rntm_p, cntl_use, &thread );
+		}
 
 #if 1
 		// Reset the progress state to 0 as we are starting new operations.
@@ -172,15 +232,21 @@ void bli_l3_thread_decorator
 		);
 #endif
 
+		// The control tree and thrinfo_t structure of a plan are kept for
+		// the next call; otherwise free them.
+
 		// Free the thread's local control tree.
-		bli_l3_cntl_free( rntm_p, cntl_use, thread );
+		if ( !use_plan ) bli_l3_cntl_free( rntm_p, cntl_use, thread );
 
 		#ifdef PRINT_THRINFO
 		threads[tid] = thread;
 		#else
 		// Free the current thread's thrinfo_t structure.
-		bli_l3_thrinfo_free( rntm_p, thread );
+		if ( !use_plan ) bli_l3_thrinfo_free( rntm_p, thread );
 		#endif
+
+		// Restore the thread's previous affinity.
+		bli_affinity_unbind();
 	}
 
 	// We shouldn't free the global communicator since it was already freed
@@ -193,10 +259,11 @@ void bli_l3_thread_decorator
 	exit(1);
 	#endif
 
-	// Check the array_t back into the small block allocator. Similar to the
-	// check-out, this is done using a lock embedded within the sba to ensure
-	// mutual exclusion.
-	bli_sba_checkin_array( array );
+	// Return the plan to the cache, or check the array_t back into the
+	// small block allocator. Similar to the check-out, this is done using
+	// a lock to ensure mutual exclusion.
+	if ( plan != NULL ) bli_l3_plan_checkin( plan );
+	else                bli_sba_checkin_array( array );
 }
 
 // -----------------------------------------------------------------------------
@@ -55,6 +55,7 @@ typedef struct thread_data
 	dim_t      tid;
 	thrcomm_t* gl_comm;
 	array_t*   array;
+	l3plan_t*  plan;
 } thread_data_t;
 
 // Entry point for additional threads
@@ -77,6 +78,7 @@ void* bli_l3_thread_entry( void* data_void )
 	dim_t          tid      = data->tid;
 	array_t*       array    = data->array;
 	thrcomm_t*     gl_comm  = data->gl_comm;
+	l3plan_t*      plan     = data->plan;
 
 	// Create a thread-local copy of the master thread's rntm_t. This is
 	// necessary since we want each thread to be able to track its own
@@ -90,6 +92,9 @@ void* bli_l3_thread_entry( void* data_void )
 	// be allocated/initialized.
 	bli_sba_rntm_set_pool( tid, array, rntm_p );
 
+	// Bind the thread to a CPU if an affinity policy was requested.
+	bli_affinity_bind( tid, rntm_p );
+
 	obj_t          a_t, b_t, c_t;
 	cntl_t*        cntl_use;
 	thrinfo_t*     thread;
@@ -103,12 +108,23 @@ void* bli_l3_thread_entry( void* data_void )
 	bli_obj_alias_to( b, &b_t );
 	bli_obj_alias_to( c, &c_t );
 
-	// Create a default control tree for the operation, if needed.
-	bli_l3_cntl_create_if( family, schema_a, schema_b,
-	                       &a_t, &b_t, &c_t, rntm_p, cntl, &cntl_use );
+	if ( plan != NULL )
+	{
+		// Fetch the thread's control tree and thrinfo_t tree from the plan,
+		// creating them if this is the plan's first use.
+		bli_l3_plan_thread_init( plan, tid, family, schema_a, schema_b,
+		                         &a_t, &b_t, &c_t, rntm_p,
+		                         &cntl_use, &thread );
+	}
+	else
+	{
+		// Create a default control tree for the operation, if needed.
+		bli_l3_cntl_create_if( family, schema_a, schema_b,
+		                       &a_t, &b_t, &c_t, rntm_p, cntl, &cntl_use );
 
-	// Create the root node of the current thread's thrinfo_t structure.
-	bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
+		// Create the root node of the current thread's thrinfo_t structure.
+		bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
+	}
 
 	func
 	(
@@ -123,11 +139,19 @@ void* bli_l3_thread_entry( void* data_void )
 	  thread
 	);
 
-	// Free the thread's local control tree.
-	bli_l3_cntl_free( rntm_p, cntl_use, thread );
+	// The control tree and thrinfo_t structure of a plan are kept for the
+	// next call; otherwise free them.
+	if ( plan == NULL )
+	{
+		// Free the thread's local control tree.
+		bli_l3_cntl_free( rntm_p, cntl_use, thread );
+
+		// Free the current thread's thrinfo_t structure.
+		bli_l3_thrinfo_free( rntm_p, thread );
+	}
 
-	// Free the current thread's thrinfo_t structure.
-	bli_l3_thrinfo_free( rntm_p, thread );
+	// Restore the thread's previous affinity.
+	bli_affinity_unbind();
 
 	return NULL;
 }
@@ -162,25 +186,41 @@ void bli_l3_thread_decorator
 
 	// NOTE: The sba was initialized in bli_init().
 
-	// Check out an array_t from the small block allocator. This is done
-	// with an internal lock to ensure only one application thread accesses
-	// the sba at a time. bli_sba_checkout_array() will also automatically
-	// resize the array_t, if necessary.
-	array_t* restrict array = bli_sba_checkout_array( n_threads );
+	// Look for a cached plan (see bli_l3_plan.h) that matches this call.
+	// A plan provides the array_t and global communicator, as well as the
+	// control and thrinfo_t trees that the threads will reuse.
+	l3plan_t* plan = bli_l3_plan_checkout( family, schema_a, schema_b, a, rntm, cntl );
 
-	// Access the pool_t* for thread 0 and embed it into the rntm. We do
-	// this up-front only so that we have the rntm_t.sba_pool field
-	// initialized and ready for the global communicator creation below.
-	bli_sba_rntm_set_pool( 0, array, rntm );
+	array_t*   restrict array;
+	thrcomm_t* restrict gl_comm;
+
+	if ( plan != NULL )
+	{
+		array   = bli_l3_plan_array( plan );
+		gl_comm = bli_l3_plan_gl_comm( plan );
+	}
+	else
+	{
+		// Check out an array_t from the small block allocator. This is done
+		// with an internal lock to ensure only one application thread
+		// accesses the sba at a time. bli_sba_checkout_array() will also
+		// automatically resize the array_t, if necessary.
+		array = bli_sba_checkout_array( n_threads );
+
+		// Access the pool_t* for thread 0 and embed it into the rntm. We do
+		// this up-front only so that we have the rntm_t.sba_pool field
+		// initialized and ready for the global communicator creation below.
+		bli_sba_rntm_set_pool( 0, array, rntm );
+
+		// Allocate a global communicator for the root thrinfo_t structures.
+		gl_comm = bli_thrcomm_create( rntm, n_threads );
+	}
 
 	// Set the packing block allocator field of the rntm. This will be
 	// inherited by all of the child threads when they make local copies of
 	// the rntm below.
 	bli_membrk_rntm_set_membrk( rntm );
 
-	// Allocate a global communicator for the root thrinfo_t structures.
-	thrcomm_t* restrict gl_comm = bli_thrcomm_create( rntm, n_threads );
-
 	// Allocate an array of pthread objects and auxiliary data structs to pass
 	// to the thread entry functions.
 
@@ -214,6 +254,7 @@ void bli_l3_thread_decorator
 		datas[tid].tid      = tid;
 		datas[tid].gl_comm  = gl_comm;
 		datas[tid].array    = array;
+		datas[tid].plan     = plan;
 
 		// Spawn additional threads for ids greater than 1.
 		if ( tid != 0 )
@@ -232,10 +273,11 @@ void bli_l3_thread_decorator
 		bli_pthread_join( pthreads[tid], NULL );
 	}
 
-	// Check the array_t back into the small block allocator. Similar to the
-	// check-out, this is done using a lock embedded within the sba to ensure
-	// mutual exclusion.
-	bli_sba_checkin_array( array );
+	// Return the plan to the cache, or check the array_t back into the
+	// small block allocator. Similar to the check-out, this is done using
+	// a lock to ensure mutual exclusion.
+	if ( plan != NULL ) bli_l3_plan_checkin( plan );
+	else                bli_sba_checkin_array( array );
 
 	#ifdef BLIS_ENABLE_MEM_TRACING
 	printf( "bli_l3_thread_decorator().pth: " );
@@ -67,22 +67,41 @@ void bli_l3_thread_decorator
 
 	// NOTE: The sba was initialized in bli_init().
 
-	// Check out an array_t from the small block allocator. This is done
-	// with an internal lock to ensure only one application thread accesses
-	// the sba at a time. bli_sba_checkout_array() will also automatically
-	// resize the array_t, if necessary.
-	array_t* restrict array = bli_sba_checkout_array( n_threads );
+	// Look for a cached plan (see bli_l3_plan.h) that matches this call.
+	// A plan provides the array_t and global communicator, as well as the
+	// control and thrinfo_t trees that are reused below.
+	l3plan_t* plan = bli_l3_plan_checkout( family, schema_a, schema_b, a, rntm, cntl );
 
-	// Access the pool_t* for thread 0 and embed it into the rntm. We do
-	// this up-front only so that we can create the global comm below.
-	bli_sba_rntm_set_pool( 0, array, rntm );
+	array_t*   restrict array;
+	thrcomm_t* restrict gl_comm;
+
+	if ( plan != NULL )
+	{
+		array   = bli_l3_plan_array( plan );
+		gl_comm = bli_l3_plan_gl_comm( plan );
+
+		// Access the pool_t* for thread 0 and embed it into the rntm.
+		bli_sba_rntm_set_pool( 0, array, rntm );
+	}
+	else
+	{
+		// Check out an array_t from the small block allocator. This is done
+		// with an internal lock to ensure only one application thread
+		// accesses the sba at a time. bli_sba_checkout_array() will also
+		// automatically resize the array_t, if necessary.
+		array = bli_sba_checkout_array( n_threads );
+
+		// Access the pool_t* for thread 0 and embed it into the rntm. We do
+		// this up-front only so that we can create the global comm below.
+		bli_sba_rntm_set_pool( 0, array, rntm );
+
+		// Allcoate a global communicator for the root thrinfo_t structures.
+		gl_comm = bli_thrcomm_create( rntm, n_threads );
+	}
 
 	// Set the packing block allocator field of the rntm.
 	bli_membrk_rntm_set_membrk( rntm );
 
-	// Allcoate a global communicator for the root thrinfo_t structures.
-	thrcomm_t* restrict gl_comm = bli_thrcomm_create( rntm, n_threads );
-
 
 	{
 		// NOTE: We don't need to create another copy of the rntm_t since
@@ -109,12 +128,22 @@ void bli_l3_thread_decorator
 		// consistently providing local aliases, we can then eliminate aliasing
 		// elsewhere.
 
-		// Create a default control tree for the operation, if needed.
-		bli_l3_cntl_create_if( family, schema_a, schema_b,
-		                       a, b, c, rntm_p, cntl, &cntl_use );
-
-		// Create the root node of the thread's thrinfo_t structure.
-		bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
+		if ( plan != NULL )
+		{
+			// Fetch the control tree and thrinfo_t tree from the plan,
+			// creating them if this is the plan's first use.
+			bli_l3_plan_thread_init( plan, tid, family, schema_a, schema_b,
+			                         a, b, c, rntm_p, &cntl_use, &thread );
+		}
+		else
+		{
+			// Create a default control tree for the operation, if needed.
+			bli_l3_cntl_create_if( family, schema_a, schema_b,
+			                       a, b, c, rntm_p, cntl, &cntl_use );
+
+			// Create the root node of the thread's thrinfo_t structure.
+			bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
+		}
 		
 		// Reset the progress state to 0 as we are starting new operations.
 		// This counter track running progress in current thread.
@@ -140,21 +169,27 @@ void bli_l3_thread_decorator
 		  thread
 		);
 
-		// Free the thread's local control tree.
-		bli_l3_cntl_free( rntm_p, cntl_use, thread );
+		// The control tree and thrinfo_t structure of a plan are kept for
+		// the next call; otherwise free them.
+		if ( plan == NULL )
+		{
+			// Free the thread's local control tree.
+			bli_l3_cntl_free( rntm_p, cntl_use, thread );
 
-		// Free the current thread's thrinfo_t structure.
-		bli_l3_thrinfo_free( rntm_p, thread );
+			// Free the current thread's thrinfo_t structure.
+			bli_l3_thrinfo_free( rntm_p, thread );
+		}
 	}
 
 	// We shouldn't free the global communicator since it was already freed
 	// by the global communicator's chief thread in bli_l3_thrinfo_free()
 	// (called above).
 
-	// Check the array_t back into the small block allocator. Similar to the
-	// check-out, this is done using a lock embedded within the sba to ensure
-	// mutual exclusion.
-	bli_sba_checkin_array( array );
+	// Return the plan to the cache, or check the array_t back into the
+	// small block allocator. Similar to the check-out, this is done using
+	// a lock to ensure mutual exclusion.
+	if ( plan != NULL ) bli_l3_plan_checkin( plan );
+	else                bli_sba_checkin_array( array );
 }
 
 #endif
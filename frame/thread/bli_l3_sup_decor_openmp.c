@@ -104,6 +104,9 @@ err_t bli_l3_sup_thread_decorator
 		// be allocated/initialized.
 		bli_sba_rntm_set_pool( tid, array, rntm_p );
 
+		// Bind the thread to a CPU if an affinity policy was requested.
+		bli_affinity_bind( tid, rntm_p );
+
 		thrinfo_t* thread = NULL;
 
 		// Create the root node of the thread's thrinfo_t structure.
@@ -123,6 +126,9 @@ err_t bli_l3_sup_thread_decorator
 
 		// Free the current thread's thrinfo_t structure.
 		bli_l3_sup_thrinfo_free( rntm_p, thread );
+
+		// Restore the thread's previous affinity.
+		bli_affinity_unbind();
 	}
 
 	// We shouldn't free the global communicator since it was already freed
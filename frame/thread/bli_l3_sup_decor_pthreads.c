@@ -86,6 +86,9 @@ void* bli_l3_sup_thread_entry( void* data_void )
 	// be allocated/initialized.
 	bli_sba_rntm_set_pool( tid, array, rntm_p );
 
+	// Bind the thread to a CPU if an affinity policy was requested.
+	bli_affinity_bind( tid, rntm_p );
+
 	thrinfo_t* thread = NULL;
 
 	// Create the root node of the current thread's thrinfo_t structure.
@@ -106,6 +109,9 @@ void* bli_l3_sup_thread_entry( void* data_void )
 	// Free the current thread's thrinfo_t structure.
 	bli_l3_sup_thrinfo_free( rntm_p, thread );
 
+	// Restore the thread's previous affinity.
+	bli_affinity_unbind();
+
 	return NULL;
 }
 
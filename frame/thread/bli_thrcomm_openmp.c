@@ -70,6 +70,7 @@ void bli_thrcomm_init( dim_t n_threads, thrcomm_t* comm )
 	if ( comm == NULL ) return;
 	comm->sent_object = NULL;
 	comm->n_threads = n_threads;
+	comm->dyn_count = 0;
 	comm->barrier_sense = 0;
 	comm->barrier_threads_arrived = 0;
 }
@@ -114,6 +115,7 @@ void bli_thrcomm_init( dim_t n_threads, thrcomm_t* comm )
 	if ( comm == NULL ) return;
 	comm->sent_object = NULL;
 	comm->n_threads = n_threads;
+	comm->dyn_count = 0;
 	comm->barriers = bli_malloc_intl( sizeof( barrier_t* ) * n_threads );
 	bli_thrcomm_tree_barrier_create( n_threads, BLIS_TREE_BARRIER_ARITY, comm->barriers, 0 );
 }
@@ -44,6 +44,10 @@ struct thrcomm_s
 	void*                 sent_object;
 	dim_t                 n_threads;
 
+	// The counter from which the threads claim iterations of dynamically
+	// scheduled loops. See bli_thread_range_dyn_next().
+	dim_t                 dyn_count;
+
 	bli_pthread_barrier_t barrier;
 };
 #else
@@ -52,6 +56,10 @@ struct thrcomm_s
 	void*  sent_object;
 	dim_t  n_threads;
 
+	// The counter from which the threads claim iterations of dynamically
+	// scheduled loops. See bli_thread_range_dyn_next().
+	dim_t  dyn_count;
+
 //#ifdef BLIS_USE_PTHREAD_MUTEX
 //	bli_pthread_mutex_t mutex;
 //#endif
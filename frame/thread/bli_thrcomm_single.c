@@ -70,6 +70,7 @@ void bli_thrcomm_init( dim_t n_threads, thrcomm_t* comm )
 
 	comm->sent_object             = NULL;
 	comm->n_threads               = n_threads;
+	comm->dyn_count               = 0;
 	comm->barrier_sense           = 0;
 	comm->barrier_threads_arrived = 0;
 }
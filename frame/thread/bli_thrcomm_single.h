@@ -53,6 +53,11 @@ struct thrcomm_s
 {   
 	void*       sent_object;
 	dim_t       n_threads;
+
+	// The counter from which the threads claim iterations of dynamically
+	// scheduled loops. See bli_thread_range_dyn_next().
+	dim_t       dyn_count;
+
 	barrier_t** barriers;
 }; 
 #else
@@ -60,6 +65,10 @@ struct thrcomm_s
 {
 	void*   sent_object;
 	dim_t   n_threads;
+
+	// The counter from which the threads claim iterations of dynamically
+	// scheduled loops. See bli_thread_range_dyn_next().
+	dim_t   dyn_count;
  
 	// NOTE: barrier_sense was originally a gint_t-based bool_t, but upon
 	// redefining bool_t as bool we discovered that some gcc __atomic built-ins
@@ -639,6 +639,240 @@ siz_t bli_thread_range_weighted_sub
 	return area;
 }
 
+// -----------------------------------------------------------------------------
+
+void bli_thread_range_cost_sub
+     (
+       thrinfo_t*     thread,
+       dim_t          n,
+       thread_cost_ft cost,
+       void*          params,
+       dim_t*         start,
+       dim_t*         end
+     )
+{
+	const dim_t n_way = bli_thread_n_way( thread );
+	const dim_t my_id = bli_thread_work_id( thread );
+
+	double total = 0.0;
+
+	for ( dim_t i = 0; i < n; ++i ) total += cost( i, params );
+
+	if ( n_way == 1 || total <= 0.0 )
+	{
+		bli_thread_range_sub( thread, n, 1, FALSE, start, end );
+		return;
+	}
+
+	// Each thread owns an equal share of the total cost, and unit i is
+	// assigned to the thread whose share contains the midpoint of the unit's
+	// cost. The midpoints increase with i, so every thread receives a
+	// contiguous (possibly empty) range, and the ranges cover [0,n). The
+	// last thread also receives any trailing units without cost.
+	const double lo = total * ( double )my_id / ( double )n_way;
+	const double hi = total * ( double )( my_id + 1 ) / ( double )n_way;
+	const bool   is_last = ( my_id == n_way - 1 );
+
+	double prefix = 0.0;
+
+	*start = n;
+	*end   = n;
+
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		const double cost_i = cost( i, params );
+		const double mid    = prefix + 0.5 * cost_i;
+
+		if ( !is_last && mid >= hi ) { *end = i; break; }
+		if ( *start == n && mid >= lo ) *start = i;
+
+		prefix += cost_i;
+	}
+
+	if ( *start > *end ) *start = *end;
+}
+
+typedef struct
+{
+	doff_t diagoff;
+	uplo_t uplo;
+	dim_t  m;
+	dim_t  n;
+	dim_t  mr;
+	dim_t  nr;
+} thread_tiles_t;
+
+static double bli_thread_tiles_cost( dim_t j, void* params )
+{
+	thread_tiles_t* p = params;
+
+	const dim_t n_cur = bli_min( p->nr, p->n - j * p->nr );
+	double      cost  = 0.0;
+
+	// Count the micro-tiles of the jth micropanel that the macrokernel
+	// computes. An edge tile costs as much as a full one, since it is
+	// computed with a full micro-kernel call.
+	for ( dim_t i = 0; i < p->m; i += p->mr )
+	{
+		const dim_t  m_cur   = bli_min( p->mr, p->m - i );
+		const doff_t diagoff = p->diagoff - ( doff_t )( j * p->nr ) + ( doff_t )i;
+
+		if ( bli_intersects_diag_n( diagoff, m_cur, n_cur ) )
+			cost += BLIS_THREAD_DIAG_TILE_COST;
+		else if ( bli_is_lower( p->uplo ) &&
+		          bli_is_strictly_below_diag_n( diagoff, m_cur, n_cur ) )
+			cost += 1.0;
+		else if ( bli_is_upper( p->uplo ) &&
+		          bli_is_strictly_above_diag_n( diagoff, m_cur, n_cur ) )
+			cost += 1.0;
+	}
+
+	return cost;
+}
+
+void bli_thread_range_tiles_sub
+     (
+       thrinfo_t* thread,
+       doff_t     diagoff,
+       uplo_t     uplo,
+       dim_t      m,
+       dim_t      n,
+       dim_t      mr,
+       dim_t      nr,
+       dim_t*     start,
+       dim_t*     end
+     )
+{
+	thread_tiles_t params = { diagoff, uplo, m, n, mr, nr };
+
+	const dim_t n_iter = ( n + nr - 1 ) / nr;
+
+	bli_thread_range_cost_sub( thread, n_iter, bli_thread_tiles_cost,
+	                           &params, start, end );
+}
+
+// The cost of the jth micropanel counted from the far end of the n
+// dimension, where the (possibly partial) last micropanel comes first.
+static double bli_thread_tiles_cost_rev( dim_t j, void* params )
+{
+	thread_tiles_t* p = params;
+
+	const dim_t n_iter = ( p->n + p->nr - 1 ) / p->nr;
+
+	return bli_thread_tiles_cost( n_iter - 1 - j, params );
+}
+
+// Tile-weighted analogue of bli_thread_range_weighted_t2b() and friends for
+// the ic (is_m) and jc loops of herk and gemmt, which partition the stored
+// triangle of c. The dimension is partitioned in units of bf rows or
+// columns, each weighted by the micro-tiles that the macrokernel computes
+// in it, as in bli_thread_range_tiles_sub(). The range is expressed in the
+// indexing of the given direction: for BLIS_BWD, 0 is the bottom (right)
+// end, where the partial unit lies. Returns the area of the micro-tiles
+// assigned to the calling thread.
+static siz_t bli_thread_range_tiles_blk
+     (
+       dir_t      direct,
+       bool       is_m,
+       thrinfo_t* thr,
+       obj_t*     c,
+       blksz_t*   bmult,
+       cntx_t*    cntx,
+       dim_t*     start,
+       dim_t*     end
+     )
+{
+	num_t  dt      = bli_obj_dt( c );
+	doff_t diagoff = bli_obj_diag_offset( c );
+	uplo_t uplo    = bli_obj_uplo( c );
+	dim_t  m       = bli_obj_length( c );
+	dim_t  n       = bli_obj_width( c );
+	dim_t  bf      = bli_blksz_get_def( dt, bmult );
+	dim_t  tile_m  = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+
+	// Support implicit transposition.
+	if ( bli_obj_has_trans( c ) )
+	{
+		bli_reflect_about_diag( &diagoff, &uplo, &m, &n );
+	}
+
+	// Express the partitioning of the m dimension as that of the n
+	// dimension of the transpose, whose micro-tiles are NR deep.
+	if ( is_m )
+	{
+		bli_reflect_about_diag( &diagoff, &uplo, &m, &n );
+		tile_m = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	}
+
+	thread_tiles_t params = { diagoff, uplo, m, n, tile_m, bf };
+
+	const dim_t    n_iter  = ( n + bf - 1 ) / bf;
+	const dim_t    bf_left = ( n % bf == 0 ? bf : n % bf );
+	thread_cost_ft cost    = ( direct == BLIS_FWD ? bli_thread_tiles_cost
+	                                              : bli_thread_tiles_cost_rev );
+	double         tiles   = 0.0;
+
+	bli_thread_range_cost_sub( thr, n_iter, cost, &params, start, end );
+
+	for ( dim_t j = *start; j < *end; ++j ) tiles += cost( j, &params );
+
+	// Convert the range from units to rows or columns. In the backward
+	// direction, the first unit is the partial one.
+	if ( direct == BLIS_FWD )
+	{
+		*start = bli_min( *start * bf, n );
+		*end   = bli_min( *end   * bf, n );
+	}
+	else
+	{
+		*start = ( *start == 0 ? 0 : bf_left + ( *start - 1 ) * bf );
+		*end   = ( *end   == 0 ? 0 : bf_left + ( *end   - 1 ) * bf );
+	}
+
+	return ( siz_t )( tiles * tile_m * bf );
+}
+
+dim_t bli_thread_range_dyn_next
+     (
+       thrinfo_t* thread,
+       dim_t      n
+     )
+{
+	// The chief of each caucus (ie: of each of the n_way groups of threads
+	// that partition the loop) claims iterations from the counter of the
+	// communicator on behalf of its caucus, and then shares the claim with
+	// the other threads of the caucus.
+	//
+	// Rather than resetting the counter between loops, which would require
+	// an extra barrier, each thread tracks the value at which the current
+	// loop started. Every caucus stops after exactly one claim past the end
+	// of the loop, so the counter advances by n plus n_way over the course
+	// of the loop, and each thread can advance its base by the same amount
+	// without communicating. This requires that all threads of the
+	// communicator run the same sequence of self-scheduled loops, and that
+	// consecutive loops be separated by a barrier (which the packing of A
+	// and B between successive loops provides).
+	thrcomm_t* comm   = bli_thrinfo_ocomm( thread );
+	thrinfo_t* caucus = bli_thrinfo_sub_node( thread );
+	dim_t      i      = 0;
+
+	if ( caucus == NULL || bli_thread_am_ochief( caucus ) )
+		i = __atomic_fetch_add( &comm->dyn_count, 1, __ATOMIC_RELAXED )
+		    - thread->dyn_base;
+
+	// The claim is passed by value (within the pointer) since the chief
+	// may return before the other threads read it.
+	if ( caucus != NULL && bli_thread_num_threads( caucus ) > 1 )
+		i = ( dim_t )( intptr_t )bli_thread_broadcast( caucus,
+		                                               ( void* )( intptr_t )i );
+
+	if ( i < n ) return i;
+
+	thread->dyn_base += n + bli_thread_n_way( thread );
+
+	return n;
+}
+
 siz_t bli_thread_range_mdim
      (
        dir_t      direct,
@@ -683,6 +917,13 @@ siz_t bli_thread_range_mdim
 	else if ( family == BLIS_TRMM ) { x = a; use_weighted = TRUE;  }
 	else    /*family == BLIS_TRSM*/ { x = a; use_weighted = FALSE; }
 
+	// The cost of herk and gemmt lies in the micro-tiles of the stored
+	// triangle of c, so their ranges are weighted by micro-tile counts.
+	if ( ( family == BLIS_HERK || family == BLIS_GEMMT ) &&
+	     bli_obj_intersects_diag( c ) && bli_obj_is_upper_or_lower( c ) )
+		return bli_thread_range_tiles_blk( direct, TRUE, thr, c, bmult, cntx,
+		                                   start, end );
+
 	if ( use_weighted )
 	{
 		if ( direct == BLIS_FWD )
@@ -743,6 +984,13 @@ siz_t bli_thread_range_ndim
 	else if ( family == BLIS_TRMM ) { x = b; use_weighted = TRUE;  }
 	else    /*family == BLIS_TRSM*/ { x = b; use_weighted = FALSE; }
 
+	// The cost of herk and gemmt lies in the micro-tiles of the stored
+	// triangle of c, so their ranges are weighted by micro-tile counts.
+	if ( ( family == BLIS_HERK || family == BLIS_GEMMT ) &&
+	     bli_obj_intersects_diag( c ) && bli_obj_is_upper_or_lower( c ) )
+		return bli_thread_range_tiles_blk( direct, FALSE, thr, c, bmult, cntx,
+		                                   start, end );
+
 	if ( use_weighted )
 	{
 		if ( direct == BLIS_FWD )
@@ -1593,10 +1841,20 @@ void bli_thread_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir )
 	// Acquire the mutex protecting global_rntm.
 	bli_pthread_mutex_lock( &global_rntm_mutex );
 
+	const bool changed = ( jc != bli_rntm_jc_ways( &global_rntm ) ||
+	                       pc != bli_rntm_pc_ways( &global_rntm ) ||
+	                       ic != bli_rntm_ic_ways( &global_rntm ) ||
+	                       jr != bli_rntm_jr_ways( &global_rntm ) ||
+	                       ir != bli_rntm_ir_ways( &global_rntm ) );
+
 	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, &global_rntm );
 
 	// Release the mutex protecting global_rntm.
 	bli_pthread_mutex_unlock( &global_rntm_mutex );
+
+	// Cached level-3 plans for the old ways of parallelism would not be
+	// used again.
+	if ( changed ) bli_l3_plan_invalidate();
 }
 
 void bli_thread_set_num_threads( dim_t n_threads )
@@ -1612,6 +1870,8 @@ void bli_thread_set_num_threads( dim_t n_threads )
 	// Acquire the mutex protecting global_rntm.
 	bli_pthread_mutex_lock( &global_rntm_mutex );
 
+	const bool changed = ( n_threads != bli_rntm_num_threads( &global_rntm ) );
+
 	bli_rntm_set_num_threads_only( n_threads, &global_rntm );
 
 	// BLIS_NUM_THREADS env variable or BLIS API to set the
@@ -1622,6 +1882,10 @@ void bli_thread_set_num_threads( dim_t n_threads )
 
 	// Release the mutex protecting global_rntm.
 	bli_pthread_mutex_unlock( &global_rntm_mutex );
+
+	// Cached level-3 plans for the old thread count would not be used
+	// again.
+	if ( changed ) bli_l3_plan_invalidate();
 }
 
 // ----------------------------------------------------------------------------
@@ -1754,6 +2018,21 @@ void bli_thread_init_rntm_from_env
 	bli_rntm_set_num_threads_only( nt, rntm );
 	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, rntm );
 
+	// Read the number of levels of Strassen's algorithm to apply to large
+	// real gemm problems. Strassen's algorithm is never used unless it is
+	// requested here or via bli_rntm_set_strassen_levels().
+	dim_t sl = bli_env_get_var( "BLIS_STRASSEN_LEVELS", 0 );
+
+	sl = bli_min( bli_max( sl, 0 ), BLIS_GEMM_STRASSEN_MAX_LEVELS );
+
+	bli_rntm_set_strassen_levels( sl, rntm );
+
+	// Read whether the packing of each block of B should be overlapped with
+	// the computation on the previous one.
+	bool pipe = ( bli_env_get_var( "BLIS_PACK_B_PIPELINE", 0 ) != 0 );
+
+	bli_rntm_set_pack_b_pipeline( pipe, rntm );
+
 #if 0
 	printf( "bli_thread_init_rntm_from_env()\n" );
 	bli_rntm_print( rntm );
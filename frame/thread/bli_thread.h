@@ -49,6 +49,9 @@
 #include "bli_packm_thrinfo.h"
 #include "bli_l3_thrinfo.h"
 
+// Include thread affinity definitions and prototypes.
+#include "bli_affinity.h"
+
 // Include the level-3 thread decorator and related definitions and prototypes
 // for the conventional code path.
 #include "bli_l3_decor.h"
@@ -147,6 +150,54 @@ siz_t bli_thread_range_weighted_sub
        dim_t*     restrict j_end_thr
      );
 
+// A function that returns the cost of the unit of work with index i.
+typedef double (*thread_cost_ft)( dim_t i, void* params );
+
+void bli_thread_range_cost_sub
+     (
+       thrinfo_t*     thread,
+       dim_t          n,
+       thread_cost_ft cost,
+       void*          params,
+       dim_t*         start,
+       dim_t*         end
+     );
+
+// The cost of a micro-tile that intersects the diagonal relative to that of
+// a micro-tile that lies entirely in the stored region, as used by
+// bli_thread_range_tiles_sub() and by the ic and jc partitions of herk and
+// gemmt (see bli_thread_range_mdim() and bli_thread_range_ndim()).
+#ifndef BLIS_THREAD_DIAG_TILE_COST
+#define BLIS_THREAD_DIAG_TILE_COST 1.25
+#endif
+
+void bli_thread_range_tiles_sub
+     (
+       thrinfo_t* thread,
+       doff_t     diagoff,
+       uplo_t     uplo,
+       dim_t      m,
+       dim_t      n,
+       dim_t      mr,
+       dim_t      nr,
+       dim_t*     start,
+       dim_t*     end
+     );
+
+dim_t bli_thread_range_dyn_next
+     (
+       thrinfo_t* thread,
+       dim_t      n
+     );
+
+// The number of chunks per thread into which self-scheduled jr loops are
+// divided. Each claim from the shared counter yields a chunk of contiguous
+// micropanels, which preserves some of the locality of slab partitioning
+// while still leaving work for threads that finish early.
+#ifndef BLIS_THREAD_DYN_CHUNKS_PER_THREAD
+#define BLIS_THREAD_DYN_CHUNKS_PER_THREAD 4
+#endif
+
 // -----------------------------------------------------------------------------
 
 // Factorization and partitioning prototypes
@@ -267,7 +318,34 @@ BLIS_INLINE void bli_thread_range_jrir
 #endif
 }
 
-#if 0
+// Cost-weighted analogue of bli_thread_range_jrir() for jr loops over n
+// micropanels whose costs differ, where cost( j, params ) gives the cost of
+// micropanel j.
+BLIS_INLINE void bli_thread_range_cost_jrir
+     (
+       thrinfo_t*     thread,
+       dim_t          n,
+       thread_cost_ft cost,
+       void*          params,
+       dim_t*         start,
+       dim_t*         end,
+       dim_t*         inc
+     )
+{
+#ifdef BLIS_ENABLE_JRIR_SLAB
+	bli_thread_range_cost_sub( thread, n, cost, params, start, end );
+	*inc = 1;
+#else
+	bli_thread_range_jrir_rr( thread, n, 1, FALSE, start, end, inc );
+#endif
+}
+
+// Area-weighted analogue of bli_thread_range_jrir() for the jr loop of
+// macrokernels that update only one triangle of C (herk, gemmt). The m x n
+// panel is partitioned in units of bf columns so that each thread receives
+// roughly the same number of stored elements, and the returned range is
+// expressed in units of micropanels. If the diagonal does not intersect the
+// panel, the ordinary (unweighted) partitioning is used.
 BLIS_INLINE void bli_thread_range_weighted_jrir
      (
        thrinfo_t* thread,
@@ -282,27 +360,237 @@ BLIS_INLINE void bli_thread_range_weighted_jrir
        dim_t*     inc
      )
 {
+	const dim_t n_iter = ( n + bf - 1 ) / bf;
+
+	if ( bli_thread_n_way( thread ) == 1 ||
+	     !bli_intersects_diag_n( diagoff, m, n ) )
+	{
+		bli_thread_range_jrir( thread, n_iter, 1, handle_edge_low,
+		                       start, end, inc );
+		return;
+	}
+
 #ifdef BLIS_ENABLE_JRIR_SLAB
 
 	// Use contiguous slab partitioning for jr/ir loops.
 	bli_thread_range_weighted_sub( thread, diagoff, uplo, m, n, bf,
 	                               handle_edge_low, start, end );
 
-	*start = *start / bf; *inc = 1;
+	// Interior boundaries of the weighted ranges fall on micropanel
+	// boundaries, so only an unaligned end of the pruned region needs to be
+	// rounded outward. An empty range must stay empty; rounding it outward
+	// would hand a micropanel that another thread owns to this one too.
+	*inc = 1;
+
+	if ( *start == *end ) { *start = 0; *end = 0; return; }
 
-	if ( *end % bf ) *end = *end / bf + 1;
-	else             *end = *end / bf;
+	*start = *start / bf;
+	*end   = ( *end + bf - 1 ) / bf;
 
 #else
 
 	// Use interleaved partitioning of jr/ir loops.
 	*start = bli_thread_work_id( thread );
 	*inc   = bli_thread_n_way( thread );
-	*end   = n;
+	*end   = n_iter;
 
 #endif
 }
+
+// A variant of bli_thread_range_weighted_jrir() for loops that always
+// iterate contiguously (e.g. the sup jr loop), regardless of the jr/ir
+// partitioning requested at configure-time.
+BLIS_INLINE void bli_thread_range_weighted_jr_sub
+     (
+       thrinfo_t* thread,
+       doff_t     diagoff,
+       uplo_t     uplo,
+       dim_t      m,
+       dim_t      n,
+       dim_t      bf,
+       dim_t*     start,
+       dim_t*     end
+     )
+{
+	const dim_t n_iter = ( n + bf - 1 ) / bf;
+
+	if ( bli_thread_n_way( thread ) == 1 ||
+	     !bli_intersects_diag_n( diagoff, m, n ) )
+	{
+		bli_thread_range_sub( thread, n_iter, 1, FALSE, start, end );
+		return;
+	}
+
+	bli_thread_range_weighted_sub( thread, diagoff, uplo, m, n, bf,
+	                               FALSE, start, end );
+
+	// Convert to micropanel indices as in bli_thread_range_weighted_jrir().
+	if ( *start == *end ) { *start = 0; *end = 0; return; }
+
+	*start = *start / bf;
+	*end   = ( *end + bf - 1 ) / bf;
+}
+
+// Determine whether iteration j belongs to the range [start,end) traversed
+// with the increment inc (as returned by one of the functions above).
+BLIS_INLINE bool bli_thread_range_jrir_has
+     (
+       dim_t j,
+       dim_t start,
+       dim_t end,
+       dim_t inc
+     )
+{
+	return start <= j && j < end && ( j - start ) % inc == 0;
+}
+
+// Determine whether the jr loop partitioned by 'thread' is self-scheduled.
+// This requires that each thread of the communicator be its own jr caucus
+// (ie: that the ir loop is not parallelized), and is never the case for a
+// single thread, whose communicator may be shared by concurrent calls.
+BLIS_INLINE bool bli_thread_jr_is_dynamic( thrinfo_t* thread )
+{
+#ifdef BLIS_ENABLE_JRIR_DYNAMIC
+	return bli_thread_n_way( thread ) > 1 &&
+	       bli_thread_n_way( thread ) == bli_thread_num_threads( thread );
+#else
+	( void )thread;
+	return FALSE;
 #endif
+}
+
+// Determine whether the ic loop partitioned by 'thread' is self-scheduled.
+// Here, the chief of each ic caucus claims blocks on behalf of its caucus.
+BLIS_INLINE bool bli_thread_ic_is_dynamic( thrinfo_t* thread )
+{
+#ifdef BLIS_ENABLE_JRIR_DYNAMIC
+	return bli_thread_n_way( thread ) > 1;
+#else
+	( void )thread;
+	return FALSE;
+#endif
+}
+
+// Return the number of micropanels in each chunk of a self-scheduled jr loop
+// over n micropanels.
+BLIS_INLINE dim_t bli_thread_range_dyn_chunk
+     (
+       thrinfo_t* thread,
+       dim_t      n
+     )
+{
+	const dim_t chunk = n / ( BLIS_THREAD_DYN_CHUNKS_PER_THREAD *
+	                          bli_thread_n_way( thread ) );
+
+	return bli_max( chunk, 1 );
+}
+
+// Claim the next chunk of a self-scheduled jr loop over n micropanels and
+// return the index of its first micropanel, or n if none are left.
+BLIS_INLINE dim_t bli_thread_range_dyn_next_chunk
+     (
+       thrinfo_t* thread,
+       dim_t      n
+     )
+{
+	const dim_t chunk   = bli_thread_range_dyn_chunk( thread, n );
+	const dim_t n_chunk = ( n + chunk - 1 ) / chunk;
+	const dim_t c       = bli_thread_range_dyn_next( thread, n_chunk );
+
+	return ( c < n_chunk ? c * chunk : n );
+}
+
+// A variant of bli_thread_range_jrir() for jr loops that may be
+// self-scheduled. When the loop is self-scheduled, *inc is set to zero and
+// *start to the first micropanel claimed by the calling thread. In every
+// case, the loop should advance with bli_thread_range_jrir_next().
+BLIS_INLINE void bli_thread_range_dyn_jrir
+     (
+       thrinfo_t* thread,
+       dim_t      n,
+       dim_t*     start,
+       dim_t*     end,
+       dim_t*     inc
+     )
+{
+	if ( bli_thread_jr_is_dynamic( thread ) )
+	{
+		*start = bli_thread_range_dyn_next_chunk( thread, n );
+		*end   = n;
+		*inc   = 0;
+		return;
+	}
+
+	bli_thread_range_jrir( thread, n, 1, FALSE, start, end, inc );
+}
+
+// Tile-weighted analogue of bli_thread_range_jrir() for the jr loop of
+// macrokernels that update only one triangle of an m x n block of C (herk,
+// gemmt). Micropanels are assigned so that each thread computes about the
+// same number of micro-tiles, where tiles that intersect the diagonal are
+// weighted by BLIS_THREAD_DIAG_TILE_COST and edge tiles count as full ones.
+// As with bli_thread_range_dyn_jrir(), the loop should advance with
+// bli_thread_range_jrir_next().
+BLIS_INLINE void bli_thread_range_tiles_jrir
+     (
+       thrinfo_t* thread,
+       doff_t     diagoff,
+       uplo_t     uplo,
+       dim_t      m,
+       dim_t      n,
+       dim_t      mr,
+       dim_t      nr,
+       dim_t*     start,
+       dim_t*     end,
+       dim_t*     inc
+     )
+{
+	const dim_t n_iter = ( n + nr - 1 ) / nr;
+
+	if ( bli_thread_jr_is_dynamic( thread ) )
+	{
+		bli_thread_range_dyn_jrir( thread, n_iter, start, end, inc );
+		return;
+	}
+
+#ifdef BLIS_ENABLE_JRIR_SLAB
+
+	bli_thread_range_tiles_sub( thread, diagoff, uplo, m, n, mr, nr,
+	                            start, end );
+	*inc = 1;
+
+#else
+
+	bli_thread_range_jrir_rr( thread, n_iter, 1, FALSE, start, end, inc );
+
+#endif
+}
+
+// Advance the index j of a jr loop whose range was obtained from
+// bli_thread_range_dyn_jrir() or bli_thread_range_tiles_jrir(). For a
+// self-scheduled loop, the next chunk is claimed from the shared counter
+// once the current one is done. The loop must be run to completion (ie:
+// until the returned index reaches end) by every thread.
+BLIS_INLINE dim_t bli_thread_range_jrir_next
+     (
+       thrinfo_t* thread,
+       dim_t      j,
+       dim_t      inc,
+       dim_t      end
+     )
+{
+	if ( inc == 0 )
+	{
+		j += 1;
+
+		if ( j < end && j % bli_thread_range_dyn_chunk( thread, end ) != 0 )
+			return j;
+
+		return bli_thread_range_dyn_next_chunk( thread, end );
+	}
+
+	return j + inc;
+}
 
 #endif
 
@@ -83,6 +83,7 @@ void bli_thrinfo_init
 	bli_thrinfo_set_n_way( n_way, thread );
 	bli_thrinfo_set_work_id( work_id, thread );
 	bli_thrinfo_set_free_comm( free_comm, thread );
+	thread->dyn_base = 0;
 	bli_thrinfo_set_bszid( bszid, thread );
 
 	bli_thrinfo_set_sub_node( sub_node, thread );
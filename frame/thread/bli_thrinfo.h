@@ -52,6 +52,10 @@ struct thrinfo_s
 	// What we're working on.
 	dim_t              work_id;
 
+	// The value of ocomm's dyn_count at which the next dynamically scheduled
+	// loop executed by this thread starts.
+	dim_t              dyn_base;
+
 	// When freeing, should the communicators in this node be freed? Usually,
 	// this is field is true, but when nodes are created that share the same
 	// communicators as other nodes (such as with packm nodes), this is set
@@ -0,0 +1,518 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Plane rotations ( x, y ) := ( c*x + s*y, c*y - conj( s )*x ) and the
+// modified rotations ( x, y ) := ( h11*x + h12*y, h21*x + h22*y ) of ?rotm.
+// The unit-stride main loops process four registers of each vector per
+// iteration; what remains, and vectors with non-unit stride, is done one
+// element at a time.
+//
+
+// -----------------------------------------------------------------------------
+
+void bli_srotv_zen_int
+     (
+       dim_t            n,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       float*  restrict c,
+       float*  restrict s,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t n_elem_per_reg = 8;
+	dim_t       i = 0;
+
+	if ( bli_zero_dim1( n ) ) return;
+
+	const float gamma = *c;
+	const float sigma = *s;
+
+	if ( incx == 1 && incy == 1 )
+	{
+		__m256 gammav = _mm256_set1_ps( gamma );
+		__m256 sigmav = _mm256_set1_ps( sigma );
+		__m256 xv[4], yv[4], tv[4];
+
+		for ( ; ( i + 31 ) < n; i += 32 )
+		{
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				xv[k] = _mm256_loadu_ps( x + i + k*n_elem_per_reg );
+				yv[k] = _mm256_loadu_ps( y + i + k*n_elem_per_reg );
+			}
+
+			// x = c*x + s*y; y = c*y - s*x;
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				tv[k] = _mm256_mul_ps( sigmav, yv[k] );
+				yv[k] = _mm256_mul_ps( gammav, yv[k] );
+				tv[k] = _mm256_fmadd_ps( gammav, xv[k], tv[k] );
+				yv[k] = _mm256_fnmadd_ps( sigmav, xv[k], yv[k] );
+			}
+
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				_mm256_storeu_ps( x + i + k*n_elem_per_reg, tv[k] );
+				_mm256_storeu_ps( y + i + k*n_elem_per_reg, yv[k] );
+			}
+		}
+
+		for ( ; ( i + 7 ) < n; i += n_elem_per_reg )
+		{
+			xv[0] = _mm256_loadu_ps( x + i );
+			yv[0] = _mm256_loadu_ps( y + i );
+
+			tv[0] = _mm256_mul_ps( sigmav, yv[0] );
+			yv[0] = _mm256_mul_ps( gammav, yv[0] );
+			tv[0] = _mm256_fmadd_ps( gammav, xv[0], tv[0] );
+			yv[0] = _mm256_fnmadd_ps( sigmav, xv[0], yv[0] );
+
+			_mm256_storeu_ps( x + i, tv[0] );
+			_mm256_storeu_ps( y + i, yv[0] );
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from AVX to SSE instructions (which may occur later,
+		// especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+	}
+
+	for ( ; i < n; ++i )
+	{
+		const float chi = x[ i*incx ];
+		const float psi = y[ i*incy ];
+
+		x[ i*incx ] = gamma * chi + sigma * psi;
+		y[ i*incy ] = gamma * psi - sigma * chi;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_drotv_zen_int
+     (
+       dim_t            n,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       double* restrict c,
+       double* restrict s,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t n_elem_per_reg = 4;
+	dim_t       i = 0;
+
+	if ( bli_zero_dim1( n ) ) return;
+
+	const double gamma = *c;
+	const double sigma = *s;
+
+	if ( incx == 1 && incy == 1 )
+	{
+		__m256d gammav = _mm256_set1_pd( gamma );
+		__m256d sigmav = _mm256_set1_pd( sigma );
+		__m256d xv[4], yv[4], tv[4];
+
+		for ( ; ( i + 15 ) < n; i += 16 )
+		{
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				xv[k] = _mm256_loadu_pd( x + i + k*n_elem_per_reg );
+				yv[k] = _mm256_loadu_pd( y + i + k*n_elem_per_reg );
+			}
+
+			// x = c*x + s*y; y = c*y - s*x;
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				tv[k] = _mm256_mul_pd( sigmav, yv[k] );
+				yv[k] = _mm256_mul_pd( gammav, yv[k] );
+				tv[k] = _mm256_fmadd_pd( gammav, xv[k], tv[k] );
+				yv[k] = _mm256_fnmadd_pd( sigmav, xv[k], yv[k] );
+			}
+
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				_mm256_storeu_pd( x + i + k*n_elem_per_reg, tv[k] );
+				_mm256_storeu_pd( y + i + k*n_elem_per_reg, yv[k] );
+			}
+		}
+
+		for ( ; ( i + 3 ) < n; i += n_elem_per_reg )
+		{
+			xv[0] = _mm256_loadu_pd( x + i );
+			yv[0] = _mm256_loadu_pd( y + i );
+
+			tv[0] = _mm256_mul_pd( sigmav, yv[0] );
+			yv[0] = _mm256_mul_pd( gammav, yv[0] );
+			tv[0] = _mm256_fmadd_pd( gammav, xv[0], tv[0] );
+			yv[0] = _mm256_fnmadd_pd( sigmav, xv[0], yv[0] );
+
+			_mm256_storeu_pd( x + i, tv[0] );
+			_mm256_storeu_pd( y + i, yv[0] );
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from AVX to SSE instructions (which may occur later,
+		// especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+	}
+
+	for ( ; i < n; ++i )
+	{
+		const double chi = x[ i*incx ];
+		const double psi = y[ i*incy ];
+
+		x[ i*incx ] = gamma * chi + sigma * psi;
+		y[ i*incy ] = gamma * psi - sigma * chi;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_crotv_zen_int
+     (
+       dim_t              n,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict y, inc_t incy,
+       float*    restrict c,
+       scomplex* restrict s,
+       cntx_t*   restrict cntx
+     )
+{
+	if ( bli_zero_dim1( n ) ) return;
+
+	if ( bli_cimag( *s ) == 0.0 )
+	{
+		// With a real s the real and imaginary parts rotate independently
+		// and in the same way, so the real kernel does the work.
+		float sigma = bli_creal( *s );
+
+		if ( incx == 1 && incy == 1 )
+		{
+			bli_srotv_zen_int
+			(
+			  2 * n,
+			  ( float* )x, 1,
+			  ( float* )y, 1,
+			  c, &sigma, cntx
+			);
+		}
+		else
+		{
+			bli_srotv_zen_int
+			(
+			  n,
+			  ( float* )x, 2 * incx,
+			  ( float* )y, 2 * incy,
+			  c, &sigma, cntx
+			);
+			bli_srotv_zen_int
+			(
+			  n,
+			  ( float* )x + 1, 2 * incx,
+			  ( float* )y + 1, 2 * incy,
+			  c, &sigma, cntx
+			);
+		}
+
+		return;
+	}
+
+	scomplex gamma;
+	scomplex minus_sigma_conj;
+
+	bli_sccopys( *c, gamma );
+	bli_cscal2js( *bli_cm1, *s, minus_sigma_conj );
+
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		scomplex chi;
+		scomplex psi;
+
+		bli_cscal2s( gamma, x[ i*incx ], chi );
+		bli_caxpys( *s, y[ i*incy ], chi );
+		bli_cscal2s( gamma, y[ i*incy ], psi );
+		bli_caxpys( minus_sigma_conj, x[ i*incx ], psi );
+
+		bli_ccopys( chi, x[ i*incx ] );
+		bli_ccopys( psi, y[ i*incy ] );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zrotv_zen_int
+     (
+       dim_t              n,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict y, inc_t incy,
+       double*    restrict c,
+       dcomplex* restrict s,
+       cntx_t*   restrict cntx
+     )
+{
+	if ( bli_zero_dim1( n ) ) return;
+
+	if ( bli_zimag( *s ) == 0.0 )
+	{
+		// With a real s the real and imaginary parts rotate independently
+		// and in the same way, so the real kernel does the work.
+		double sigma = bli_zreal( *s );
+
+		if ( incx == 1 && incy == 1 )
+		{
+			bli_drotv_zen_int
+			(
+			  2 * n,
+			  ( double* )x, 1,
+			  ( double* )y, 1,
+			  c, &sigma, cntx
+			);
+		}
+		else
+		{
+			bli_drotv_zen_int
+			(
+			  n,
+			  ( double* )x, 2 * incx,
+			  ( double* )y, 2 * incy,
+			  c, &sigma, cntx
+			);
+			bli_drotv_zen_int
+			(
+			  n,
+			  ( double* )x + 1, 2 * incx,
+			  ( double* )y + 1, 2 * incy,
+			  c, &sigma, cntx
+			);
+		}
+
+		return;
+	}
+
+	dcomplex gamma;
+	dcomplex minus_sigma_conj;
+
+	bli_dzcopys( *c, gamma );
+	bli_zscal2js( *bli_zm1, *s, minus_sigma_conj );
+
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		dcomplex chi;
+		dcomplex psi;
+
+		bli_zscal2s( gamma, x[ i*incx ], chi );
+		bli_zaxpys( *s, y[ i*incy ], chi );
+		bli_zscal2s( gamma, y[ i*incy ], psi );
+		bli_zaxpys( minus_sigma_conj, x[ i*incx ], psi );
+
+		bli_zcopys( chi, x[ i*incx ] );
+		bli_zcopys( psi, y[ i*incy ] );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_srotmv_zen_int
+     (
+       dim_t            n,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       float*  restrict h,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t n_elem_per_reg = 8;
+	dim_t       i = 0;
+
+	if ( bli_zero_dim1( n ) ) return;
+
+	const float h11 = h[0];
+	const float h21 = h[1];
+	const float h12 = h[2];
+	const float h22 = h[3];
+
+	if ( incx == 1 && incy == 1 )
+	{
+		__m256 h11v = _mm256_set1_ps( h11 );
+		__m256 h21v = _mm256_set1_ps( h21 );
+		__m256 h12v = _mm256_set1_ps( h12 );
+		__m256 h22v = _mm256_set1_ps( h22 );
+		__m256 xv[4], yv[4], tv[4];
+
+		for ( ; ( i + 31 ) < n; i += 32 )
+		{
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				xv[k] = _mm256_loadu_ps( x + i + k*n_elem_per_reg );
+				yv[k] = _mm256_loadu_ps( y + i + k*n_elem_per_reg );
+			}
+
+			// x = h11*x + h12*y; y = h21*x + h22*y;
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				tv[k] = _mm256_mul_ps( h12v, yv[k] );
+				yv[k] = _mm256_mul_ps( h22v, yv[k] );
+				tv[k] = _mm256_fmadd_ps( h11v, xv[k], tv[k] );
+				yv[k] = _mm256_fmadd_ps( h21v, xv[k], yv[k] );
+			}
+
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				_mm256_storeu_ps( x + i + k*n_elem_per_reg, tv[k] );
+				_mm256_storeu_ps( y + i + k*n_elem_per_reg, yv[k] );
+			}
+		}
+
+		for ( ; ( i + 7 ) < n; i += n_elem_per_reg )
+		{
+			xv[0] = _mm256_loadu_ps( x + i );
+			yv[0] = _mm256_loadu_ps( y + i );
+
+			tv[0] = _mm256_mul_ps( h12v, yv[0] );
+			yv[0] = _mm256_mul_ps( h22v, yv[0] );
+			tv[0] = _mm256_fmadd_ps( h11v, xv[0], tv[0] );
+			yv[0] = _mm256_fmadd_ps( h21v, xv[0], yv[0] );
+
+			_mm256_storeu_ps( x + i, tv[0] );
+			_mm256_storeu_ps( y + i, yv[0] );
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from AVX to SSE instructions (which may occur later,
+		// especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+	}
+
+	for ( ; i < n; ++i )
+	{
+		const float chi = x[ i*incx ];
+		const float psi = y[ i*incy ];
+
+		x[ i*incx ] = h11 * chi + h12 * psi;
+		y[ i*incy ] = h21 * chi + h22 * psi;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_drotmv_zen_int
+     (
+       dim_t            n,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       double* restrict h,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t n_elem_per_reg = 4;
+	dim_t       i = 0;
+
+	if ( bli_zero_dim1( n ) ) return;
+
+	const double h11 = h[0];
+	const double h21 = h[1];
+	const double h12 = h[2];
+	const double h22 = h[3];
+
+	if ( incx == 1 && incy == 1 )
+	{
+		__m256d h11v = _mm256_set1_pd( h11 );
+		__m256d h21v = _mm256_set1_pd( h21 );
+		__m256d h12v = _mm256_set1_pd( h12 );
+		__m256d h22v = _mm256_set1_pd( h22 );
+		__m256d xv[4], yv[4], tv[4];
+
+		for ( ; ( i + 15 ) < n; i += 16 )
+		{
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				xv[k] = _mm256_loadu_pd( x + i + k*n_elem_per_reg );
+				yv[k] = _mm256_loadu_pd( y + i + k*n_elem_per_reg );
+			}
+
+			// x = h11*x + h12*y; y = h21*x + h22*y;
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				tv[k] = _mm256_mul_pd( h12v, yv[k] );
+				yv[k] = _mm256_mul_pd( h22v, yv[k] );
+				tv[k] = _mm256_fmadd_pd( h11v, xv[k], tv[k] );
+				yv[k] = _mm256_fmadd_pd( h21v, xv[k], yv[k] );
+			}
+
+			for ( dim_t k = 0; k < 4; ++k )
+			{
+				_mm256_storeu_pd( x + i + k*n_elem_per_reg, tv[k] );
+				_mm256_storeu_pd( y + i + k*n_elem_per_reg, yv[k] );
+			}
+		}
+
+		for ( ; ( i + 3 ) < n; i += n_elem_per_reg )
+		{
+			xv[0] = _mm256_loadu_pd( x + i );
+			yv[0] = _mm256_loadu_pd( y + i );
+
+			tv[0] = _mm256_mul_pd( h12v, yv[0] );
+			yv[0] = _mm256_mul_pd( h22v, yv[0] );
+			tv[0] = _mm256_fmadd_pd( h11v, xv[0], tv[0] );
+			yv[0] = _mm256_fmadd_pd( h21v, xv[0], yv[0] );
+
+			_mm256_storeu_pd( x + i, tv[0] );
+			_mm256_storeu_pd( y + i, yv[0] );
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from AVX to SSE instructions (which may occur later,
+		// especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+	}
+
+	for ( ; i < n; ++i )
+	{
+		const double chi = x[ i*incx ];
+		const double psi = y[ i*incy ];
+
+		x[ i*incx ] = h11 * chi + h12 * psi;
+		y[ i*incy ] = h21 * chi + h22 * psi;
+	}
+}
@@ -0,0 +1,470 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+	- Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	- Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	- Neither the name(s) of the copyright holder(s) nor the names of its
+	  contributors may be used to endorse or promote products derived
+	  from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+// Scalar code used to handle the edges of the matrix that do not fill a full
+// register tile. The semantics are identical to those of the vector kernels.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       conj_t           conja, \
+       dim_t            m, \
+       dim_t            n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t lda, \
+       ctype*  restrict beta, \
+       ctype*  restrict b, inc_t ldb  \
+     ) \
+{ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		if ( bli_is_conj( conja ) ) \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+			for ( dim_t i = 0; i < m; ++i ) \
+				PASTEMAC(ch,scal2js)( *alpha, *(a + i + j*lda), *(b + j + i*ldb) ); \
+		} \
+		else \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+			for ( dim_t i = 0; i < m; ++i ) \
+				PASTEMAC(ch,scal2s)( *alpha, *(a + i + j*lda), *(b + j + i*ldb) ); \
+		} \
+	} \
+	else \
+	{ \
+		ctype ai; \
+\
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			if ( bli_is_conj( conja ) ) \
+			{ \
+				PASTEMAC(ch,scal2js)( *alpha, *(a + i + j*lda), ai ); \
+			} \
+			else \
+			{ \
+				PASTEMAC(ch,scal2s)( *alpha, *(a + i + j*lda), ai ); \
+			} \
+\
+			PASTEMAC(ch,xpbys)( ai, *beta, *(b + j + i*ldb) ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( transposem_zen_edge )
+
+// -----------------------------------------------------------------------------
+
+// Transpose a 4x4 block of 64-bit elements held in four ymm registers, where
+// r<k> holds column k of the block on input and row k on output.
+#define TRANSPOSE_4X4_PD( r0, r1, r2, r3 ) \
+{ \
+	__m256d t0_, t1_, t2_, t3_; \
+\
+	t0_ = _mm256_unpacklo_pd( r0, r1 ); \
+	t1_ = _mm256_unpackhi_pd( r0, r1 ); \
+	t2_ = _mm256_unpacklo_pd( r2, r3 ); \
+	t3_ = _mm256_unpackhi_pd( r2, r3 ); \
+\
+	r0 = _mm256_permute2f128_pd( t0_, t2_, 0x20 ); \
+	r1 = _mm256_permute2f128_pd( t1_, t3_, 0x20 ); \
+	r2 = _mm256_permute2f128_pd( t0_, t2_, 0x31 ); \
+	r3 = _mm256_permute2f128_pd( t1_, t3_, 0x31 ); \
+}
+
+// Complex multiplication of each element of x by the scalar (ar,ai), where
+// ar and ai are the broadcast real and imaginary parts.
+#define CMUL_PS( x, ar, ai ) \
+	_mm256_fmaddsub_ps( x, ar, _mm256_mul_ps( _mm256_permute_ps( x, 0xB1 ), ai ) )
+
+#define CMUL_PD( x, ar, ai ) \
+	_mm256_fmaddsub_pd( x, ar, _mm256_mul_pd( _mm256_permute_pd( x, 0x5 ), ai ) )
+
+// -----------------------------------------------------------------------------
+
+void bli_stransposem_zen_int_8x8
+     (
+       conj_t           conja,
+       dim_t            m,
+       dim_t            n,
+       float*  restrict alpha,
+       float*  restrict a, inc_t lda,
+       float*  restrict beta,
+       float*  restrict b, inc_t ldb
+     )
+{
+	const dim_t mr     = 8;
+	const dim_t nr     = 8;
+	const dim_t m_main = ( m / mr ) * mr;
+	const dim_t n_main = ( n / nr ) * nr;
+
+	const bool  beta0  = bli_seq0( *beta );
+
+	__m256 alphav = _mm256_broadcast_ss( alpha );
+	__m256 betav  = _mm256_broadcast_ss( beta );
+
+	__m256 r0, r1, r2, r3, r4, r5, r6, r7;
+	__m256 t0, t1, t2, t3, t4, t5, t6, t7;
+
+	for ( dim_t j = 0; j < n_main; j += nr )
+	{
+		for ( dim_t i = 0; i < m_main; i += mr )
+		{
+			float* restrict ap = a + i + j*lda;
+			float* restrict bp = b + j + i*ldb;
+
+			r0 = _mm256_loadu_ps( ap + 0*lda );
+			r1 = _mm256_loadu_ps( ap + 1*lda );
+			r2 = _mm256_loadu_ps( ap + 2*lda );
+			r3 = _mm256_loadu_ps( ap + 3*lda );
+			r4 = _mm256_loadu_ps( ap + 4*lda );
+			r5 = _mm256_loadu_ps( ap + 5*lda );
+			r6 = _mm256_loadu_ps( ap + 6*lda );
+			r7 = _mm256_loadu_ps( ap + 7*lda );
+
+			// Interleave pairs of columns.
+			t0 = _mm256_unpacklo_ps( r0, r1 );
+			t1 = _mm256_unpackhi_ps( r0, r1 );
+			t2 = _mm256_unpacklo_ps( r2, r3 );
+			t3 = _mm256_unpackhi_ps( r2, r3 );
+			t4 = _mm256_unpacklo_ps( r4, r5 );
+			t5 = _mm256_unpackhi_ps( r4, r5 );
+			t6 = _mm256_unpacklo_ps( r6, r7 );
+			t7 = _mm256_unpackhi_ps( r6, r7 );
+
+			// Gather groups of four within each 128-bit lane.
+			r0 = _mm256_shuffle_ps( t0, t2, 0x44 );
+			r1 = _mm256_shuffle_ps( t0, t2, 0xEE );
+			r2 = _mm256_shuffle_ps( t1, t3, 0x44 );
+			r3 = _mm256_shuffle_ps( t1, t3, 0xEE );
+			r4 = _mm256_shuffle_ps( t4, t6, 0x44 );
+			r5 = _mm256_shuffle_ps( t4, t6, 0xEE );
+			r6 = _mm256_shuffle_ps( t5, t7, 0x44 );
+			r7 = _mm256_shuffle_ps( t5, t7, 0xEE );
+
+			// Exchange the 128-bit lanes.
+			t0 = _mm256_permute2f128_ps( r0, r4, 0x20 );
+			t1 = _mm256_permute2f128_ps( r1, r5, 0x20 );
+			t2 = _mm256_permute2f128_ps( r2, r6, 0x20 );
+			t3 = _mm256_permute2f128_ps( r3, r7, 0x20 );
+			t4 = _mm256_permute2f128_ps( r0, r4, 0x31 );
+			t5 = _mm256_permute2f128_ps( r1, r5, 0x31 );
+			t6 = _mm256_permute2f128_ps( r2, r6, 0x31 );
+			t7 = _mm256_permute2f128_ps( r3, r7, 0x31 );
+
+			t0 = _mm256_mul_ps( alphav, t0 );
+			t1 = _mm256_mul_ps( alphav, t1 );
+			t2 = _mm256_mul_ps( alphav, t2 );
+			t3 = _mm256_mul_ps( alphav, t3 );
+			t4 = _mm256_mul_ps( alphav, t4 );
+			t5 = _mm256_mul_ps( alphav, t5 );
+			t6 = _mm256_mul_ps( alphav, t6 );
+			t7 = _mm256_mul_ps( alphav, t7 );
+
+			if ( !beta0 )
+			{
+				t0 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( bp + 0*ldb ), t0 );
+				t1 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( bp + 1*ldb ), t1 );
+				t2 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( bp + 2*ldb ), t2 );
+				t3 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( bp + 3*ldb ), t3 );
+				t4 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( bp + 4*ldb ), t4 );
+				t5 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( bp + 5*ldb ), t5 );
+				t6 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( bp + 6*ldb ), t6 );
+				t7 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( bp + 7*ldb ), t7 );
+			}
+
+			_mm256_storeu_ps( bp + 0*ldb, t0 );
+			_mm256_storeu_ps( bp + 1*ldb, t1 );
+			_mm256_storeu_ps( bp + 2*ldb, t2 );
+			_mm256_storeu_ps( bp + 3*ldb, t3 );
+			_mm256_storeu_ps( bp + 4*ldb, t4 );
+			_mm256_storeu_ps( bp + 5*ldb, t5 );
+			_mm256_storeu_ps( bp + 6*ldb, t6 );
+			_mm256_storeu_ps( bp + 7*ldb, t7 );
+		}
+	}
+
+	// Handle the bottom edge (all columns) and the right edge (main rows).
+	if ( m_main < m )
+		bli_stransposem_zen_edge( conja, m - m_main, n, alpha,
+		                          a + m_main, lda, beta, b + m_main*ldb, ldb );
+	if ( n_main < n )
+		bli_stransposem_zen_edge( conja, m_main, n - n_main, alpha,
+		                          a + n_main*lda, lda, beta, b + n_main, ldb );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_dtransposem_zen_int_4x4
+     (
+       conj_t           conja,
+       dim_t            m,
+       dim_t            n,
+       double* restrict alpha,
+       double* restrict a, inc_t lda,
+       double* restrict beta,
+       double* restrict b, inc_t ldb
+     )
+{
+	const dim_t mr     = 4;
+	const dim_t nr     = 4;
+	const dim_t m_main = ( m / mr ) * mr;
+	const dim_t n_main = ( n / nr ) * nr;
+
+	const bool  beta0  = bli_deq0( *beta );
+
+	__m256d alphav = _mm256_broadcast_sd( alpha );
+	__m256d betav  = _mm256_broadcast_sd( beta );
+
+	__m256d r0, r1, r2, r3;
+
+	for ( dim_t j = 0; j < n_main; j += nr )
+	{
+		for ( dim_t i = 0; i < m_main; i += mr )
+		{
+			double* restrict ap = a + i + j*lda;
+			double* restrict bp = b + j + i*ldb;
+
+			r0 = _mm256_loadu_pd( ap + 0*lda );
+			r1 = _mm256_loadu_pd( ap + 1*lda );
+			r2 = _mm256_loadu_pd( ap + 2*lda );
+			r3 = _mm256_loadu_pd( ap + 3*lda );
+
+			TRANSPOSE_4X4_PD( r0, r1, r2, r3 );
+
+			r0 = _mm256_mul_pd( alphav, r0 );
+			r1 = _mm256_mul_pd( alphav, r1 );
+			r2 = _mm256_mul_pd( alphav, r2 );
+			r3 = _mm256_mul_pd( alphav, r3 );
+
+			if ( !beta0 )
+			{
+				r0 = _mm256_fmadd_pd( betav, _mm256_loadu_pd( bp + 0*ldb ), r0 );
+				r1 = _mm256_fmadd_pd( betav, _mm256_loadu_pd( bp + 1*ldb ), r1 );
+				r2 = _mm256_fmadd_pd( betav, _mm256_loadu_pd( bp + 2*ldb ), r2 );
+				r3 = _mm256_fmadd_pd( betav, _mm256_loadu_pd( bp + 3*ldb ), r3 );
+			}
+
+			_mm256_storeu_pd( bp + 0*ldb, r0 );
+			_mm256_storeu_pd( bp + 1*ldb, r1 );
+			_mm256_storeu_pd( bp + 2*ldb, r2 );
+			_mm256_storeu_pd( bp + 3*ldb, r3 );
+		}
+	}
+
+	if ( m_main < m )
+		bli_dtransposem_zen_edge( conja, m - m_main, n, alpha,
+		                          a + m_main, lda, beta, b + m_main*ldb, ldb );
+	if ( n_main < n )
+		bli_dtransposem_zen_edge( conja, m_main, n - n_main, alpha,
+		                          a + n_main*lda, lda, beta, b + n_main, ldb );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_ctransposem_zen_int_4x4
+     (
+       conj_t             conja,
+       dim_t              m,
+       dim_t              n,
+       scomplex* restrict alpha,
+       scomplex* restrict a, inc_t lda,
+       scomplex* restrict beta,
+       scomplex* restrict b, inc_t ldb
+     )
+{
+	const dim_t mr     = 4;
+	const dim_t nr     = 4;
+	const dim_t m_main = ( m / mr ) * mr;
+	const dim_t n_main = ( n / nr ) * nr;
+
+	const bool  beta0  = bli_ceq0( *beta );
+	const bool  conj   = bli_is_conj( conja );
+
+	__m256 alpha_r = _mm256_broadcast_ss( &alpha->real );
+	__m256 alpha_i = _mm256_broadcast_ss( &alpha->imag );
+	__m256 beta_r  = _mm256_broadcast_ss( &beta->real );
+	__m256 beta_i  = _mm256_broadcast_ss( &beta->imag );
+
+	// Flips the sign of the imaginary components.
+	__m256 conjv   = _mm256_set_ps( -0.0f, 0.0f, -0.0f, 0.0f,
+	                                -0.0f, 0.0f, -0.0f, 0.0f );
+
+	__m256d r0, r1, r2, r3;
+	__m256  x0, x1, x2, x3;
+
+	for ( dim_t j = 0; j < n_main; j += nr )
+	{
+		for ( dim_t i = 0; i < m_main; i += mr )
+		{
+			scomplex* restrict ap = a + i + j*lda;
+			scomplex* restrict bp = b + j + i*ldb;
+
+			// A single-precision complex element occupies 64 bits, so the
+			// double-precision 4x4 transpose moves whole elements.
+			r0 = _mm256_loadu_pd( ( double* )( ap + 0*lda ) );
+			r1 = _mm256_loadu_pd( ( double* )( ap + 1*lda ) );
+			r2 = _mm256_loadu_pd( ( double* )( ap + 2*lda ) );
+			r3 = _mm256_loadu_pd( ( double* )( ap + 3*lda ) );
+
+			TRANSPOSE_4X4_PD( r0, r1, r2, r3 );
+
+			x0 = _mm256_castpd_ps( r0 );
+			x1 = _mm256_castpd_ps( r1 );
+			x2 = _mm256_castpd_ps( r2 );
+			x3 = _mm256_castpd_ps( r3 );
+
+			if ( conj )
+			{
+				x0 = _mm256_xor_ps( x0, conjv );
+				x1 = _mm256_xor_ps( x1, conjv );
+				x2 = _mm256_xor_ps( x2, conjv );
+				x3 = _mm256_xor_ps( x3, conjv );
+			}
+
+			x0 = CMUL_PS( x0, alpha_r, alpha_i );
+			x1 = CMUL_PS( x1, alpha_r, alpha_i );
+			x2 = CMUL_PS( x2, alpha_r, alpha_i );
+			x3 = CMUL_PS( x3, alpha_r, alpha_i );
+
+			if ( !beta0 )
+			{
+				__m256 y0 = _mm256_loadu_ps( ( float* )( bp + 0*ldb ) );
+				__m256 y1 = _mm256_loadu_ps( ( float* )( bp + 1*ldb ) );
+				__m256 y2 = _mm256_loadu_ps( ( float* )( bp + 2*ldb ) );
+				__m256 y3 = _mm256_loadu_ps( ( float* )( bp + 3*ldb ) );
+
+				x0 = _mm256_add_ps( x0, CMUL_PS( y0, beta_r, beta_i ) );
+				x1 = _mm256_add_ps( x1, CMUL_PS( y1, beta_r, beta_i ) );
+				x2 = _mm256_add_ps( x2, CMUL_PS( y2, beta_r, beta_i ) );
+				x3 = _mm256_add_ps( x3, CMUL_PS( y3, beta_r, beta_i ) );
+			}
+
+			_mm256_storeu_ps( ( float* )( bp + 0*ldb ), x0 );
+			_mm256_storeu_ps( ( float* )( bp + 1*ldb ), x1 );
+			_mm256_storeu_ps( ( float* )( bp + 2*ldb ), x2 );
+			_mm256_storeu_ps( ( float* )( bp + 3*ldb ), x3 );
+		}
+	}
+
+	if ( m_main < m )
+		bli_ctransposem_zen_edge( conja, m - m_main, n, alpha,
+		                          a + m_main, lda, beta, b + m_main*ldb, ldb );
+	if ( n_main < n )
+		bli_ctransposem_zen_edge( conja, m_main, n - n_main, alpha,
+		                          a + n_main*lda, lda, beta, b + n_main, ldb );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_ztransposem_zen_int_2x2
+     (
+       conj_t             conja,
+       dim_t              m,
+       dim_t              n,
+       dcomplex* restrict alpha,
+       dcomplex* restrict a, inc_t lda,
+       dcomplex* restrict beta,
+       dcomplex* restrict b, inc_t ldb
+     )
+{
+	const dim_t mr     = 2;
+	const dim_t nr     = 2;
+	const dim_t m_main = ( m / mr ) * mr;
+	const dim_t n_main = ( n / nr ) * nr;
+
+	const bool  beta0  = bli_zeq0( *beta );
+	const bool  conj   = bli_is_conj( conja );
+
+	__m256d alpha_r = _mm256_broadcast_sd( &alpha->real );
+	__m256d alpha_i = _mm256_broadcast_sd( &alpha->imag );
+	__m256d beta_r  = _mm256_broadcast_sd( &beta->real );
+	__m256d beta_i  = _mm256_broadcast_sd( &beta->imag );
+
+	__m256d conjv   = _mm256_set_pd( -0.0, 0.0, -0.0, 0.0 );
+
+	__m256d r0, r1, x0, x1;
+
+	for ( dim_t j = 0; j < n_main; j += nr )
+	{
+		for ( dim_t i = 0; i < m_main; i += mr )
+		{
+			dcomplex* restrict ap = a + i + j*lda;
+			dcomplex* restrict bp = b + j + i*ldb;
+
+			r0 = _mm256_loadu_pd( ( double* )( ap + 0*lda ) );
+			r1 = _mm256_loadu_pd( ( double* )( ap + 1*lda ) );
+
+			// Each 128-bit lane holds one element.
+			x0 = _mm256_permute2f128_pd( r0, r1, 0x20 );
+			x1 = _mm256_permute2f128_pd( r0, r1, 0x31 );
+
+			if ( conj )
+			{
+				x0 = _mm256_xor_pd( x0, conjv );
+				x1 = _mm256_xor_pd( x1, conjv );
+			}
+
+			x0 = CMUL_PD( x0, alpha_r, alpha_i );
+			x1 = CMUL_PD( x1, alpha_r, alpha_i );
+
+			if ( !beta0 )
+			{
+				r0 = _mm256_loadu_pd( ( double* )( bp + 0*ldb ) );
+				r1 = _mm256_loadu_pd( ( double* )( bp + 1*ldb ) );
+
+				x0 = _mm256_add_pd( x0, CMUL_PD( r0, beta_r, beta_i ) );
+				x1 = _mm256_add_pd( x1, CMUL_PD( r1, beta_r, beta_i ) );
+			}
+
+			_mm256_storeu_pd( ( double* )( bp + 0*ldb ), x0 );
+			_mm256_storeu_pd( ( double* )( bp + 1*ldb ), x1 );
+		}
+	}
+
+	if ( m_main < m )
+		bli_ztransposem_zen_edge( conja, m - m_main, n, alpha,
+		                          a + m_main, lda, beta, b + m_main*ldb, ldb );
+	if ( n_main < n )
+		bli_ztransposem_zen_edge( conja, m_main, n - n_main, alpha,
+		                          a + n_main*lda, lda, beta, b + n_main, ldb );
+}
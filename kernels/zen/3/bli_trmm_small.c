@@ -0,0 +1,387 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+#ifdef BLIS_ENABLE_SMALL_MATRIX_TRMM
+
+/*
+   Small-matrix trmm.
+
+   For the problem sizes handled here, the cost of the conventional trmm
+   path is dominated by object and control tree management, thread
+   decoration, and repeated packing of B for every diagonal-intersecting
+   block of A. This implementation instead packs the triangular matrix
+   once into micro-panels that only span the nonzero k range of each row
+   panel (with alpha folded in and the unit diagonal made explicit), and
+   then sweeps B one NR-wide column panel at a time. Because each column
+   panel of B is packed before any of its elements are overwritten, the
+   product can be written back into B in place.
+
+   Right-side problems are transposed into left-side ones. Micro-tiles
+   whose k range ends (lower) or begins (upper) with a full MR x MR diagonal
+   block are computed with the trmm micro-kernels when the context provides
+   them, and with the gemm micro-kernel otherwise.
+*/
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static err_t PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	const dim_t     MR         = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t     NR         = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t     PACKMR     = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const dim_t     PACKNR     = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+\
+	const bool      is_lower   = bli_is_lower( uploa ); \
+	const bool      is_unit    = bli_is_unit_diag( diaga ); \
+\
+	PASTECH(ch,gemm_ukr_ft) \
+	                gemm_ukr   = bli_cntx_get_l3_nat_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	PASTECH(ch,gemm_ukr_ft) \
+	                trmm_ukr   = bli_cntx_get_l3_nat_ukr_dt( dt, is_lower ? BLIS_TRMM_L_UKR \
+	                                                                      : BLIS_TRMM_U_UKR, cntx ); \
+\
+	/* Temporary C buffer for edge cases. */ \
+	ctype           ct[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( ctype ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const bool      col_pref   = bli_cntx_l3_nat_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	const inc_t     rs_ct      = ( col_pref ? 1 : NR ); \
+	const inc_t     cs_ct      = ( col_pref ? MR : 1 ); \
+\
+	ctype* restrict one        = PASTEMAC(ch,1); \
+	ctype* restrict zero       = PASTEMAC(ch,0); \
+\
+	if ( MR * NR * sizeof( ctype ) > BLIS_STACK_BUF_MAX_SIZE ) \
+		return BLIS_NOT_YET_IMPLEMENTED; \
+\
+	const dim_t     m_iter     = ( m + MR - 1 ) / MR; \
+	const dim_t     n_iter     = ( n + NR - 1 ) / NR; \
+\
+	/* Compute the size of the packed triangular matrix. Row panel i only
+	   spans columns [i*MR, m) (upper) or [0, i*MR + m_cur) (lower). */ \
+	siz_t           size_a     = 0; \
+	for ( dim_t i = 0; i < m_iter; ++i ) \
+	{ \
+		const dim_t i0    = i * MR; \
+		const dim_t m_cur = bli_min( MR, m - i0 ); \
+		const dim_t k_cur = ( is_lower ? i0 + m_cur : m - i0 ); \
+\
+		size_a += PACKMR * k_cur; \
+	} \
+	const siz_t     size_b     = PACKNR * m; \
+\
+	rntm_t          rntm; \
+	mem_t           mem_a      = BLIS_MEM_INITIALIZER; \
+	mem_t           mem_b      = BLIS_MEM_INITIALIZER; \
+\
+	bli_rntm_init_from_global( &rntm ); \
+	bli_rntm_set_num_threads_only( 1, &rntm ); \
+	bli_membrk_rntm_set_membrk( &rntm ); \
+\
+	bli_membrk_acquire_m( &rntm, size_a * sizeof( ctype ), \
+	                      BLIS_BUFFER_FOR_A_BLOCK, &mem_a ); \
+	if ( !bli_mem_is_alloc( &mem_a ) ) return BLIS_NULL_POINTER; \
+\
+	bli_membrk_acquire_m( &rntm, size_b * sizeof( ctype ), \
+	                      BLIS_BUFFER_FOR_B_PANEL, &mem_b ); \
+	if ( !bli_mem_is_alloc( &mem_b ) ) \
+	{ \
+		bli_membrk_release( &rntm, &mem_a ); \
+		return BLIS_NULL_POINTER; \
+	} \
+\
+	ctype* restrict a_pack     = bli_mem_buffer( &mem_a ); \
+	ctype* restrict b_pack     = bli_mem_buffer( &mem_b ); \
+\
+	/* Pack alpha * A, one micro-panel per row panel. The rectangular part
+	   of each micro-panel is packed with the packm kernel; the MR x MR
+	   diagonal block, in which elements outside of the stored triangle
+	   (and the padding rows of the bottom edge) are set to zero, is packed
+	   separately. */ \
+	ctype* restrict ap         = a_pack; \
+	for ( dim_t i = 0; i < m_iter; ++i ) \
+	{ \
+		const dim_t     i0    = i * MR; \
+		const dim_t     m_cur = bli_min( MR, m - i0 ); \
+		const dim_t     k_rec = ( is_lower ? i0 : m - i0 - m_cur ); \
+		ctype* restrict ap_d  = ( is_lower ? ap + k_rec*PACKMR : ap ); \
+		ctype* restrict ap_r  = ( is_lower ? ap : ap + m_cur*PACKMR ); \
+		ctype* restrict a_r   = ( is_lower ? a + i0*rs_a \
+		                                   : a + i0*rs_a + ( i0 + m_cur )*cs_a ); \
+\
+		if ( k_rec > 0 ) \
+			PASTEMAC(ch,packm_cxk) \
+			( \
+			  BLIS_NO_CONJUGATE, \
+			  BLIS_PACKED_ROW_PANELS, \
+			  m_cur, MR, \
+			  k_rec, k_rec, \
+			  alpha, \
+			  a_r, rs_a, cs_a, \
+			  ap_r,      PACKMR, \
+			  cntx  \
+			); \
+\
+		for ( dim_t l = 0; l < m_cur; ++l ) \
+		{ \
+			ctype* restrict al = a + i0*rs_a + ( i0 + l )*cs_a; \
+			ctype* restrict pl = ap_d + l*PACKMR; \
+\
+			for ( dim_t r = 0; r < PACKMR; ++r ) \
+			{ \
+				if ( r >= m_cur || ( is_lower ? l > r : l < r ) ) \
+				{ \
+					PASTEMAC(ch,set0s)( pl[ r ] ); \
+				} \
+				else if ( l == r && is_unit ) \
+				{ \
+					PASTEMAC(ch,copys)( *alpha, pl[ r ] ); \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,scal2s)( *alpha, *(al + r*rs_a), pl[ r ] ); \
+				} \
+			} \
+		} \
+\
+		ap += PACKMR * ( k_rec + m_cur ); \
+	} \
+\
+	auxinfo_t       aux; \
+\
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+	bli_auxinfo_set_is_a( 1, &aux ); \
+	bli_auxinfo_set_is_b( 1, &aux ); \
+\
+	/* Loop over the n dimension (NR columns at a time). */ \
+	for ( dim_t j = 0; j < n_iter; ++j ) \
+	{ \
+		const dim_t     j0    = j * NR; \
+		const dim_t     n_cur = bli_min( NR, n - j0 ); \
+		ctype* restrict b1    = b + j0*cs_b; \
+\
+		/* Pack the current column panel of B. This must be done before
+		   any of its elements are overwritten below. */ \
+		PASTEMAC(ch,packm_cxk) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  BLIS_PACKED_COL_PANELS, \
+		  n_cur, NR, \
+		  m, m, \
+		  one, \
+		  b1, cs_b, rs_b, \
+		  b_pack, PACKNR, \
+		  cntx  \
+		); \
+\
+		ap = a_pack; \
+\
+		/* Loop over the m dimension (MR rows at a time). */ \
+		for ( dim_t i = 0; i < m_iter; ++i ) \
+		{ \
+			const dim_t     i0    = i * MR; \
+			const dim_t     m_cur = bli_min( MR, m - i0 ); \
+			const dim_t     k0    = ( is_lower ? 0       : i0 ); \
+			const dim_t     k_cur = ( is_lower ? i0 + m_cur : m - i0 ); \
+			ctype* restrict bp    = b_pack + k0*PACKNR; \
+			ctype* restrict c11   = b1 + i0*rs_b; \
+\
+			/* Only full row panels begin or end with a full diagonal
+			   block. */ \
+			PASTECH(ch,gemm_ukr_ft) \
+			                ukr   = ( trmm_ukr != NULL && m_cur == MR ? \
+			                          trmm_ukr : gemm_ukr ); \
+\
+			bli_auxinfo_set_next_a( ap, &aux ); \
+			bli_auxinfo_set_next_b( bp, &aux ); \
+\
+			if ( m_cur == MR && n_cur == NR ) \
+			{ \
+				ukr \
+				( \
+				  k_cur, \
+				  one, \
+				  ap, \
+				  bp, \
+				  zero, \
+				  c11, rs_b, cs_b, \
+				  &aux, \
+				  cntx  \
+				); \
+			} \
+			else \
+			{ \
+				ukr \
+				( \
+				  k_cur, \
+				  one, \
+				  ap, \
+				  bp, \
+				  zero, \
+				  ct, rs_ct, cs_ct, \
+				  &aux, \
+				  cntx  \
+				); \
+\
+				/* Copy the result to the edge of B. */ \
+				PASTEMAC(ch,copys_mxn)( m_cur, n_cur, \
+				                        ct,  rs_ct, cs_ct, \
+				                        c11, rs_b,  cs_b ); \
+			} \
+\
+			ap += PACKMR * k_cur; \
+		} \
+	} \
+\
+	bli_membrk_release( &rntm, &mem_b ); \
+	bli_membrk_release( &rntm, &mem_a ); \
+\
+	return BLIS_SUCCESS; \
+}
+
+INSERT_GENTFUNC_BASIC0_SD( trmm_small_ker )
+
+
+/*
+ * bli_trmm_small computes
+ *
+ *   B := alpha * transa(A) * B   (side == BLIS_LEFT)
+ *   B := alpha * B * transa(A)   (side == BLIS_RIGHT)
+ *
+ * where A is triangular. Only real domain operands of a common datatype
+ * are handled; BLIS_NOT_YET_IMPLEMENTED is returned otherwise so that the
+ * caller can fall back to the conventional implementation.
+ */
+err_t bli_trmm_small
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       cntl_t* cntl
+     )
+{
+	const num_t dt = bli_obj_dt( b );
+
+	if ( bli_obj_dt( a ) != dt ) return BLIS_NOT_YET_IMPLEMENTED;
+	if ( dt != BLIS_FLOAT && dt != BLIS_DOUBLE ) return BLIS_NOT_YET_IMPLEMENTED;
+
+	// The triangle must start at the top-left corner of A.
+	if ( bli_obj_diag_offset( a ) != 0 ) return BLIS_NOT_YET_IMPLEMENTED;
+
+	if ( bli_obj_has_zero_dim( b ) ) return BLIS_SUCCESS;
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	obj_t a_local;
+	obj_t b_local;
+
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+
+	// B * transa(A) == ( transa(A)^T * B^T )^T, so right-side problems are
+	// computed as left-side problems on the transposed operands.
+	if ( bli_is_right( side ) )
+	{
+		bli_obj_toggle_trans( &a_local );
+		bli_obj_induce_trans( &b_local );
+	}
+
+	// Apply any transposition of A to its strides and uplo.
+	if ( bli_obj_has_trans( &a_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
+	}
+
+	const uplo_t uploa = bli_obj_uplo( &a_local );
+	const diag_t diaga = bli_obj_diag( &a_local );
+	const dim_t  m     = bli_obj_length( &b_local );
+	const dim_t  n     = bli_obj_width( &b_local );
+	void*        buf_a = bli_obj_buffer_at_off( &a_local );
+	const inc_t  rs_a  = bli_obj_row_stride( &a_local );
+	const inc_t  cs_a  = bli_obj_col_stride( &a_local );
+	void*        buf_b = bli_obj_buffer_at_off( &b_local );
+	const inc_t  rs_b  = bli_obj_row_stride( &b_local );
+	const inc_t  cs_b  = bli_obj_col_stride( &b_local );
+	void*        buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+
+	if ( dt == BLIS_DOUBLE )
+		return bli_dtrmm_small_ker( uploa, diaga, m, n, buf_alpha,
+		                            buf_a, rs_a, cs_a,
+		                            buf_b, rs_b, cs_b, cntx );
+	else
+		return bli_strmm_small_ker( uploa, diaga, m, n, buf_alpha,
+		                            buf_a, rs_a, cs_a,
+		                            buf_b, rs_b, cs_b, cntx );
+}
+
+/*
+ * Check if the TRMM small path should be taken for this
+ * input and threads combination
+ */
+bool bli_cntx_trmm_small_thresh_is_met_zen( obj_t* a, dim_t m, dim_t n, rntm_t* rntm )
+{
+	dim_t n_threads = bli_rntm_num_threads( rntm );
+
+	// If the parallelism was given as ways per loop, use their product.
+	if ( n_threads < 1 ) n_threads = bli_rntm_calc_num_threads( rntm );
+
+	if ( !bli_obj_is_real( a ) ) return FALSE;
+
+	// The small path is single-threaded. With one thread, it is faster
+	// than the conventional path up to moderate sizes; with more threads,
+	// it only wins while the problem is too small to be worth splitting.
+	if ( n_threads <= 1 ) return ( m <= 512 && n <= 512 );
+	else                  return ( m + n < 320 );
+}
+
+#endif // BLIS_ENABLE_SMALL_MATRIX_TRMM
@@ -0,0 +1,217 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   Diagonal-block micro-kernels for trmm on zen, zen2 and zen3.
+
+   These kernels share the packed micro-panel format and the register
+   blocking of bli_dgemm_haswell_asm_6x8 (MR = 6, NR = 8). They are called
+   for micro-panels of a packed triangular matrix A whose k dimension ends
+   (_l) or begins (_u) with the MR x MR diagonal block. The rectangular
+   part of the k loop is computed by the context's gemm micro-kernel, and
+   the product of the diagonal block is then accumulated into C. Since the
+   elements of A are broadcast one row at a time, the rank-1 updates within
+   that block skip every row of the micro-tile for which the current column
+   of A is known to be zero.
+*/
+
+#define D_MR 6
+#define D_NR 8
+
+#define TRMM_DECL_ROW( i ) \
+	__m256d c##i##_0 = _mm256_setzero_pd(); \
+	__m256d c##i##_1 = _mm256_setzero_pd();
+
+#define TRMM_FMA_ROW( i ) \
+	av = _mm256_broadcast_sd( a + i ); \
+	c##i##_0 = _mm256_fmadd_pd( av, b0, c##i##_0 ); \
+	c##i##_1 = _mm256_fmadd_pd( av, b1, c##i##_1 );
+
+#define TRMM_LOAD_B \
+	__m256d b0 = _mm256_loadu_pd( b + 0 ); \
+	__m256d b1 = _mm256_loadu_pd( b + 4 ); \
+	__m256d av;
+
+#define TRMM_NEXT \
+	a += D_MR; \
+	b += D_NR;
+
+#define TRMM_STORE_ROW( i ) \
+{ \
+	double* restrict ci = c + i*rs_c; \
+	__m256d t0 = _mm256_mul_pd( alphav, c##i##_0 ); \
+	__m256d t1 = _mm256_mul_pd( alphav, c##i##_1 ); \
+	if ( !beta0 ) \
+	{ \
+		t0 = _mm256_fmadd_pd( betav, _mm256_loadu_pd( ci + 0 ), t0 ); \
+		t1 = _mm256_fmadd_pd( betav, _mm256_loadu_pd( ci + 4 ), t1 ); \
+	} \
+	_mm256_storeu_pd( ci + 0, t0 ); \
+	_mm256_storeu_pd( ci + 4, t1 ); \
+}
+
+#define TRMM_SPILL_ROW( i ) \
+	_mm256_store_pd( ab + i*D_NR + 0, c##i##_0 ); \
+	_mm256_store_pd( ab + i*D_NR + 4, c##i##_1 );
+
+static void bli_dtrmm_zen_int_6x8_diag
+     (
+       bool                lower,
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t k_rect = k - D_MR;
+	double      one    = 1.0;
+
+	// Compute the rectangular part with the gemm micro-kernel, and then
+	// accumulate the diagonal block onto its result.
+	if ( k_rect > 0 )
+	{
+		dgemm_ukr_ft gemm_ukr = bli_cntx_get_l3_nat_ukr_dt( BLIS_DOUBLE, BLIS_GEMM_UKR, cntx );
+
+		if ( lower )
+		{
+			gemm_ukr( k_rect, alpha, a, b, beta, c, rs_c, cs_c, data, cntx );
+
+			a += k_rect * D_MR;
+			b += k_rect * D_NR;
+		}
+		else
+		{
+			gemm_ukr( k_rect, alpha, a + D_MR * D_MR, b + D_MR * D_NR,
+			          beta, c, rs_c, cs_c, data, cntx );
+		}
+
+		beta = &one;
+	}
+
+	TRMM_DECL_ROW( 0 ) TRMM_DECL_ROW( 1 ) TRMM_DECL_ROW( 2 )
+	TRMM_DECL_ROW( 3 ) TRMM_DECL_ROW( 4 ) TRMM_DECL_ROW( 5 )
+
+	if ( lower )
+	{
+		// Column p of the lower triangular block is zero in rows 0..p-1.
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 0 ) TRMM_FMA_ROW( 1 ) TRMM_FMA_ROW( 2 )
+		              TRMM_FMA_ROW( 3 ) TRMM_FMA_ROW( 4 ) TRMM_FMA_ROW( 5 ) TRMM_NEXT }
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 1 ) TRMM_FMA_ROW( 2 )
+		              TRMM_FMA_ROW( 3 ) TRMM_FMA_ROW( 4 ) TRMM_FMA_ROW( 5 ) TRMM_NEXT }
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 2 )
+		              TRMM_FMA_ROW( 3 ) TRMM_FMA_ROW( 4 ) TRMM_FMA_ROW( 5 ) TRMM_NEXT }
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 3 ) TRMM_FMA_ROW( 4 ) TRMM_FMA_ROW( 5 ) TRMM_NEXT }
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 4 ) TRMM_FMA_ROW( 5 ) TRMM_NEXT }
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 5 ) TRMM_NEXT }
+	}
+	else
+	{
+		// Column p of the upper triangular block is zero in rows p+1..MR-1.
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 0 ) TRMM_NEXT }
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 0 ) TRMM_FMA_ROW( 1 ) TRMM_NEXT }
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 0 ) TRMM_FMA_ROW( 1 ) TRMM_FMA_ROW( 2 ) TRMM_NEXT }
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 0 ) TRMM_FMA_ROW( 1 ) TRMM_FMA_ROW( 2 )
+		              TRMM_FMA_ROW( 3 ) TRMM_NEXT }
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 0 ) TRMM_FMA_ROW( 1 ) TRMM_FMA_ROW( 2 )
+		              TRMM_FMA_ROW( 3 ) TRMM_FMA_ROW( 4 ) TRMM_NEXT }
+		{ TRMM_LOAD_B TRMM_FMA_ROW( 0 ) TRMM_FMA_ROW( 1 ) TRMM_FMA_ROW( 2 )
+		              TRMM_FMA_ROW( 3 ) TRMM_FMA_ROW( 4 ) TRMM_FMA_ROW( 5 ) TRMM_NEXT }
+	}
+
+	const bool    beta0  = bli_deq0( *beta );
+	const __m256d alphav = _mm256_set1_pd( *alpha );
+	const __m256d betav  = _mm256_set1_pd( *beta );
+
+	if ( cs_c == 1 )
+	{
+		TRMM_STORE_ROW( 0 ) TRMM_STORE_ROW( 1 ) TRMM_STORE_ROW( 2 )
+		TRMM_STORE_ROW( 3 ) TRMM_STORE_ROW( 4 ) TRMM_STORE_ROW( 5 )
+	}
+	else
+	{
+		double ab[ D_MR * D_NR ] __attribute__((aligned(32)));
+
+		TRMM_SPILL_ROW( 0 ) TRMM_SPILL_ROW( 1 ) TRMM_SPILL_ROW( 2 )
+		TRMM_SPILL_ROW( 3 ) TRMM_SPILL_ROW( 4 ) TRMM_SPILL_ROW( 5 )
+
+		for ( dim_t j = 0; j < D_NR; ++j )
+		for ( dim_t i = 0; i < D_MR; ++i )
+		{
+			double* restrict cij = c + i*rs_c + j*cs_c;
+
+			if ( beta0 ) *cij = *alpha * ab[ i*D_NR + j ];
+			else         *cij = *beta * *cij + *alpha * ab[ i*D_NR + j ];
+		}
+	}
+}
+
+void bli_dtrmm_l_zen_int_6x8
+     (
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	bli_dtrmm_zen_int_6x8_diag( TRUE, k, alpha, a, b, beta,
+	                            c, rs_c, cs_c, data, cntx );
+}
+
+void bli_dtrmm_u_zen_int_6x8
+     (
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	bli_dtrmm_zen_int_6x8_diag( FALSE, k, alpha, a, b, beta,
+	                            c, rs_c, cs_c, data, cntx );
+}
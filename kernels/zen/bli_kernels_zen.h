@@ -38,6 +38,12 @@ PACKM_KER_PROT(double, d, packm_6xk_gen_zen)
 PACKM_KER_PROT(double, d, packm_8xk_nn_zen)
 PACKM_KER_PROT(double, d, packm_6xk_nn_zen)
 
+// transposem (intrinsics)
+TRANSPOSEM_KER_PROT( float,    s, transposem_zen_int_8x8 )
+TRANSPOSEM_KER_PROT( double,   d, transposem_zen_int_4x4 )
+TRANSPOSEM_KER_PROT( scomplex, c, transposem_zen_int_4x4 )
+TRANSPOSEM_KER_PROT( dcomplex, z, transposem_zen_int_2x2 )
+
 
 // -- level-1v --
 
@@ -81,6 +87,16 @@ DOTXV_KER_PROT( double,   d, dotxv_zen_int )
 DOTXV_KER_PROT( dcomplex, z, dotxv_zen_int )
 DOTXV_KER_PROT( scomplex, c, dotxv_zen_int )
 
+// rotv (intrinsics)
+ROTV_KER_PROT( float,    float,  s, s, rotv_zen_int )
+ROTV_KER_PROT( double,   double, d, d, rotv_zen_int )
+ROTV_KER_PROT( scomplex, float,  c, s, rotv_zen_int )
+ROTV_KER_PROT( dcomplex, double, z, d, rotv_zen_int )
+
+// rotmv (intrinsics)
+ROTMV_KER_PROT( float,    s, rotmv_zen_int )
+ROTMV_KER_PROT( double,   d, rotmv_zen_int )
+
 // scalv (intrinsics)
 SCALV_KER_PROT( float,    s, scalv_zen_int )
 SCALV_KER_PROT( double,   d, scalv_zen_int )
@@ -142,6 +158,18 @@ GEMV_KER_PROT( dcomplex, z,  gemv_zen_int_4x4 )
 HER_KER_PROT( dcomplex, z,  her_zen_int_var1 )
 HER_KER_PROT( dcomplex, z,  her_zen_int_var2 )
 
+// -- level-3 ------------------------------------------------------------------
+
+// trmm diagonal micro-panels (intrinsics)
+GEMM_UKR_PROT( double,   d, trmm_l_zen_int_6x8 )
+GEMM_UKR_PROT( double,   d, trmm_u_zen_int_6x8 )
+
+// fixed-size batched gemm (intrinsics)
+GEMM_BATCH_FIXED_KER_PROT( float,    s, gemm_batch_fixed_zen_int )
+GEMM_BATCH_FIXED_KER_PROT( double,   d, gemm_batch_fixed_zen_int )
+GEMM_BATCH_FIXED_KER_PROT( scomplex, c, gemm_batch_fixed_zen_int )
+GEMM_BATCH_FIXED_KER_PROT( dcomplex, z, gemm_batch_fixed_zen_int )
+
 // -- level-3 sup --------------------------------------------------------------
 // semmsup_rv
 
@@ -323,6 +351,16 @@ err_t bli_trsm_small
        cntl_t* cntl
      );
 
+err_t bli_trmm_small
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       cntl_t* cntl
+     );
+
 #ifdef BLIS_ENABLE_OPENMP
 err_t bli_trsm_small_mt
      (
@@ -379,6 +417,18 @@ bool bli_cntx_trsm_small_thresh_is_met_zen
         dim_t n
     );
 
+/*
+ * Check if the TRMM small path should be taken for this
+ * input and threads combination
+ */
+bool bli_cntx_trmm_small_thresh_is_met_zen
+     (
+        obj_t*  a,
+        dim_t   m,
+        dim_t   n,
+        rntm_t* rntm
+    );
+
 void bli_dnorm2fv_unb_var1_avx2
      (
        dim_t    n,
@@ -0,0 +1,413 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/* The kernels in this file only handle the part of the operand that fills
+   whole 512-bit register tiles. The remaining rows and columns are passed
+   on to the AVX2 kernels, which in turn fall back to scalar code for the
+   elements that do not fill a 256-bit tile. */
+
+/* Transpose an 8x8 block of 64-bit elements held in eight zmm registers,
+   where r<k> holds column k of the block on input and row k on output. */
+#define TRANSPOSE_8X8_PD( r0, r1, r2, r3, r4, r5, r6, r7 ) \
+{ \
+    __m512d t0_, t1_, t2_, t3_, t4_, t5_, t6_, t7_; \
+\
+    t0_ = _mm512_unpacklo_pd( r0, r1 ); \
+    t1_ = _mm512_unpackhi_pd( r0, r1 ); \
+    t2_ = _mm512_unpacklo_pd( r2, r3 ); \
+    t3_ = _mm512_unpackhi_pd( r2, r3 ); \
+    t4_ = _mm512_unpacklo_pd( r4, r5 ); \
+    t5_ = _mm512_unpackhi_pd( r4, r5 ); \
+    t6_ = _mm512_unpacklo_pd( r6, r7 ); \
+    t7_ = _mm512_unpackhi_pd( r6, r7 ); \
+\
+    r0 = _mm512_shuffle_f64x2( t0_, t2_, 0x88 ); \
+    r1 = _mm512_shuffle_f64x2( t0_, t2_, 0xDD ); \
+    r2 = _mm512_shuffle_f64x2( t1_, t3_, 0x88 ); \
+    r3 = _mm512_shuffle_f64x2( t1_, t3_, 0xDD ); \
+    r4 = _mm512_shuffle_f64x2( t4_, t6_, 0x88 ); \
+    r5 = _mm512_shuffle_f64x2( t4_, t6_, 0xDD ); \
+    r6 = _mm512_shuffle_f64x2( t5_, t7_, 0x88 ); \
+    r7 = _mm512_shuffle_f64x2( t5_, t7_, 0xDD ); \
+\
+    t0_ = _mm512_shuffle_f64x2( r0, r4, 0x88 ); \
+    t4_ = _mm512_shuffle_f64x2( r0, r4, 0xDD ); \
+    t2_ = _mm512_shuffle_f64x2( r1, r5, 0x88 ); \
+    t6_ = _mm512_shuffle_f64x2( r1, r5, 0xDD ); \
+    t1_ = _mm512_shuffle_f64x2( r2, r6, 0x88 ); \
+    t5_ = _mm512_shuffle_f64x2( r2, r6, 0xDD ); \
+    t3_ = _mm512_shuffle_f64x2( r3, r7, 0x88 ); \
+    t7_ = _mm512_shuffle_f64x2( r3, r7, 0xDD ); \
+\
+    r0 = t0_; r1 = t1_; r2 = t2_; r3 = t3_; \
+    r4 = t4_; r5 = t5_; r6 = t6_; r7 = t7_; \
+}
+
+/* Complex multiplication of each element of x by the broadcast scalar
+   (ar,ai). */
+#define CMUL512_PS( x, ar, ai ) \
+    _mm512_fmaddsub_ps( x, ar, _mm512_mul_ps( _mm512_permute_ps( x, 0xB1 ), ai ) )
+
+#define CMUL512_PD( x, ar, ai ) \
+    _mm512_fmaddsub_pd( x, ar, _mm512_mul_pd( _mm512_permute_pd( x, 0x55 ), ai ) )
+
+void bli_stransposem_zen_int_avx512_16x16
+     (
+       conj_t           conja,
+       dim_t            m,
+       dim_t            n,
+       float*  restrict alpha,
+       float*  restrict a, inc_t lda,
+       float*  restrict beta,
+       float*  restrict b, inc_t ldb
+     )
+{
+    const dim_t mr     = 16;
+    const dim_t nr     = 16;
+    const dim_t m_main = ( m / mr ) * mr;
+    const dim_t n_main = ( n / nr ) * nr;
+
+    const bool  beta0  = bli_seq0( *beta );
+
+    __m512 alphav = _mm512_set1_ps( *alpha );
+    __m512 betav  = _mm512_set1_ps( *beta );
+
+    __m512 r[16], t[16];
+
+    for ( dim_t j = 0; j < n_main; j += nr )
+    {
+        for ( dim_t i = 0; i < m_main; i += mr )
+        {
+            float* restrict ap = a + i + j*lda;
+            float* restrict bp = b + j + i*ldb;
+
+            for ( dim_t k = 0; k < 16; ++k )
+                r[k] = _mm512_loadu_ps( ap + k*lda );
+
+            /* Interleave pairs of columns. */
+            for ( dim_t k = 0; k < 16; k += 2 )
+            {
+                t[k]     = _mm512_unpacklo_ps( r[k], r[k+1] );
+                t[k + 1] = _mm512_unpackhi_ps( r[k], r[k+1] );
+            }
+
+            /* Gather groups of four within each 128-bit lane. Afterwards,
+               lane l of r[4*g + c] holds rows 4*g..4*g+3 of column 4*l+c. */
+            for ( dim_t g = 0; g < 4; ++g )
+            {
+                __m512d t0 = _mm512_castps_pd( t[4*g + 0] );
+                __m512d t1 = _mm512_castps_pd( t[4*g + 1] );
+                __m512d t2 = _mm512_castps_pd( t[4*g + 2] );
+                __m512d t3 = _mm512_castps_pd( t[4*g + 3] );
+
+                r[4*g + 0] = _mm512_castpd_ps( _mm512_unpacklo_pd( t0, t2 ) );
+                r[4*g + 1] = _mm512_castpd_ps( _mm512_unpackhi_pd( t0, t2 ) );
+                r[4*g + 2] = _mm512_castpd_ps( _mm512_unpacklo_pd( t1, t3 ) );
+                r[4*g + 3] = _mm512_castpd_ps( _mm512_unpackhi_pd( t1, t3 ) );
+            }
+
+            /* Transpose the 4x4 grid of 128-bit lanes. */
+            for ( dim_t c = 0; c < 4; ++c )
+            {
+                __m512 x0 = _mm512_shuffle_f32x4( r[c],     r[4 + c],  0x88 );
+                __m512 x1 = _mm512_shuffle_f32x4( r[c],     r[4 + c],  0xDD );
+                __m512 y0 = _mm512_shuffle_f32x4( r[8 + c], r[12 + c], 0x88 );
+                __m512 y1 = _mm512_shuffle_f32x4( r[8 + c], r[12 + c], 0xDD );
+
+                t[0  + c] = _mm512_shuffle_f32x4( x0, y0, 0x88 );
+                t[8  + c] = _mm512_shuffle_f32x4( x0, y0, 0xDD );
+                t[4  + c] = _mm512_shuffle_f32x4( x1, y1, 0x88 );
+                t[12 + c] = _mm512_shuffle_f32x4( x1, y1, 0xDD );
+            }
+
+            if ( beta0 )
+            {
+                for ( dim_t k = 0; k < 16; ++k )
+                    _mm512_storeu_ps( bp + k*ldb, _mm512_mul_ps( alphav, t[k] ) );
+            }
+            else
+            {
+                for ( dim_t k = 0; k < 16; ++k )
+                {
+                    t[k] = _mm512_mul_ps( alphav, t[k] );
+                    t[k] = _mm512_fmadd_ps( betav, _mm512_loadu_ps( bp + k*ldb ), t[k] );
+                    _mm512_storeu_ps( bp + k*ldb, t[k] );
+                }
+            }
+        }
+    }
+
+    if ( m_main < m )
+        bli_stransposem_zen_int_8x8( conja, m - m_main, n, alpha,
+                                     a + m_main, lda, beta, b + m_main*ldb, ldb );
+    if ( n_main < n )
+        bli_stransposem_zen_int_8x8( conja, m_main, n - n_main, alpha,
+                                     a + n_main*lda, lda, beta, b + n_main, ldb );
+}
+
+void bli_dtransposem_zen_int_avx512_8x8
+     (
+       conj_t           conja,
+       dim_t            m,
+       dim_t            n,
+       double* restrict alpha,
+       double* restrict a, inc_t lda,
+       double* restrict beta,
+       double* restrict b, inc_t ldb
+     )
+{
+    const dim_t mr     = 8;
+    const dim_t nr     = 8;
+    const dim_t m_main = ( m / mr ) * mr;
+    const dim_t n_main = ( n / nr ) * nr;
+
+    const bool  beta0  = bli_deq0( *beta );
+
+    __m512d alphav = _mm512_set1_pd( *alpha );
+    __m512d betav  = _mm512_set1_pd( *beta );
+
+    __m512d r0, r1, r2, r3, r4, r5, r6, r7;
+
+    for ( dim_t j = 0; j < n_main; j += nr )
+    {
+        for ( dim_t i = 0; i < m_main; i += mr )
+        {
+            double* restrict ap = a + i + j*lda;
+            double* restrict bp = b + j + i*ldb;
+
+            r0 = _mm512_loadu_pd( ap + 0*lda );
+            r1 = _mm512_loadu_pd( ap + 1*lda );
+            r2 = _mm512_loadu_pd( ap + 2*lda );
+            r3 = _mm512_loadu_pd( ap + 3*lda );
+            r4 = _mm512_loadu_pd( ap + 4*lda );
+            r5 = _mm512_loadu_pd( ap + 5*lda );
+            r6 = _mm512_loadu_pd( ap + 6*lda );
+            r7 = _mm512_loadu_pd( ap + 7*lda );
+
+            TRANSPOSE_8X8_PD( r0, r1, r2, r3, r4, r5, r6, r7 );
+
+            r0 = _mm512_mul_pd( alphav, r0 );
+            r1 = _mm512_mul_pd( alphav, r1 );
+            r2 = _mm512_mul_pd( alphav, r2 );
+            r3 = _mm512_mul_pd( alphav, r3 );
+            r4 = _mm512_mul_pd( alphav, r4 );
+            r5 = _mm512_mul_pd( alphav, r5 );
+            r6 = _mm512_mul_pd( alphav, r6 );
+            r7 = _mm512_mul_pd( alphav, r7 );
+
+            if ( !beta0 )
+            {
+                r0 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( bp + 0*ldb ), r0 );
+                r1 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( bp + 1*ldb ), r1 );
+                r2 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( bp + 2*ldb ), r2 );
+                r3 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( bp + 3*ldb ), r3 );
+                r4 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( bp + 4*ldb ), r4 );
+                r5 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( bp + 5*ldb ), r5 );
+                r6 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( bp + 6*ldb ), r6 );
+                r7 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( bp + 7*ldb ), r7 );
+            }
+
+            _mm512_storeu_pd( bp + 0*ldb, r0 );
+            _mm512_storeu_pd( bp + 1*ldb, r1 );
+            _mm512_storeu_pd( bp + 2*ldb, r2 );
+            _mm512_storeu_pd( bp + 3*ldb, r3 );
+            _mm512_storeu_pd( bp + 4*ldb, r4 );
+            _mm512_storeu_pd( bp + 5*ldb, r5 );
+            _mm512_storeu_pd( bp + 6*ldb, r6 );
+            _mm512_storeu_pd( bp + 7*ldb, r7 );
+        }
+    }
+
+    if ( m_main < m )
+        bli_dtransposem_zen_int_4x4( conja, m - m_main, n, alpha,
+                                     a + m_main, lda, beta, b + m_main*ldb, ldb );
+    if ( n_main < n )
+        bli_dtransposem_zen_int_4x4( conja, m_main, n - n_main, alpha,
+                                     a + n_main*lda, lda, beta, b + n_main, ldb );
+}
+
+void bli_ctransposem_zen_int_avx512_8x8
+     (
+       conj_t             conja,
+       dim_t              m,
+       dim_t              n,
+       scomplex* restrict alpha,
+       scomplex* restrict a, inc_t lda,
+       scomplex* restrict beta,
+       scomplex* restrict b, inc_t ldb
+     )
+{
+    const dim_t mr     = 8;
+    const dim_t nr     = 8;
+    const dim_t m_main = ( m / mr ) * mr;
+    const dim_t n_main = ( n / nr ) * nr;
+
+    const bool  beta0  = bli_ceq0( *beta );
+    const bool  conj   = bli_is_conj( conja );
+
+    __m512 alpha_r = _mm512_set1_ps( alpha->real );
+    __m512 alpha_i = _mm512_set1_ps( alpha->imag );
+    __m512 beta_r  = _mm512_set1_ps( beta->real );
+    __m512 beta_i  = _mm512_set1_ps( beta->imag );
+
+    /* Flips the sign of the imaginary components. */
+    __m512 conjv   = _mm512_castsi512_ps(
+                       _mm512_set1_epi64( ( long long )0x8000000000000000ULL ) );
+
+    __m512d r[8];
+    __m512  x;
+
+    for ( dim_t j = 0; j < n_main; j += nr )
+    {
+        for ( dim_t i = 0; i < m_main; i += mr )
+        {
+            scomplex* restrict ap = a + i + j*lda;
+            scomplex* restrict bp = b + j + i*ldb;
+
+            /* A single-precision complex element occupies 64 bits, so the
+               double-precision 8x8 transpose moves whole elements. */
+            for ( dim_t k = 0; k < 8; ++k )
+                r[k] = _mm512_loadu_pd( ( double* )( ap + k*lda ) );
+
+            TRANSPOSE_8X8_PD( r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7] );
+
+            for ( dim_t k = 0; k < 8; ++k )
+            {
+                x = _mm512_castpd_ps( r[k] );
+
+                if ( conj ) x = _mm512_xor_ps( x, conjv );
+
+                x = CMUL512_PS( x, alpha_r, alpha_i );
+
+                if ( !beta0 )
+                {
+                    __m512 y = _mm512_loadu_ps( ( float* )( bp + k*ldb ) );
+                    x = _mm512_add_ps( x, CMUL512_PS( y, beta_r, beta_i ) );
+                }
+
+                _mm512_storeu_ps( ( float* )( bp + k*ldb ), x );
+            }
+        }
+    }
+
+    if ( m_main < m )
+        bli_ctransposem_zen_int_4x4( conja, m - m_main, n, alpha,
+                                     a + m_main, lda, beta, b + m_main*ldb, ldb );
+    if ( n_main < n )
+        bli_ctransposem_zen_int_4x4( conja, m_main, n - n_main, alpha,
+                                     a + n_main*lda, lda, beta, b + n_main, ldb );
+}
+
+void bli_ztransposem_zen_int_avx512_4x4
+     (
+       conj_t             conja,
+       dim_t              m,
+       dim_t              n,
+       dcomplex* restrict alpha,
+       dcomplex* restrict a, inc_t lda,
+       dcomplex* restrict beta,
+       dcomplex* restrict b, inc_t ldb
+     )
+{
+    const dim_t mr     = 4;
+    const dim_t nr     = 4;
+    const dim_t m_main = ( m / mr ) * mr;
+    const dim_t n_main = ( n / nr ) * nr;
+
+    const bool  beta0  = bli_zeq0( *beta );
+    const bool  conj   = bli_is_conj( conja );
+
+    __m512d alpha_r = _mm512_set1_pd( alpha->real );
+    __m512d alpha_i = _mm512_set1_pd( alpha->imag );
+    __m512d beta_r  = _mm512_set1_pd( beta->real );
+    __m512d beta_i  = _mm512_set1_pd( beta->imag );
+
+    __m512d conjv   = _mm512_set_pd( -0.0, 0.0, -0.0, 0.0,
+                                     -0.0, 0.0, -0.0, 0.0 );
+
+    __m512d r0, r1, r2, r3;
+    __m512d x0, x1, y0, y1;
+    __m512d c[4];
+
+    for ( dim_t j = 0; j < n_main; j += nr )
+    {
+        for ( dim_t i = 0; i < m_main; i += mr )
+        {
+            dcomplex* restrict ap = a + i + j*lda;
+            dcomplex* restrict bp = b + j + i*ldb;
+
+            r0 = _mm512_loadu_pd( ( double* )( ap + 0*lda ) );
+            r1 = _mm512_loadu_pd( ( double* )( ap + 1*lda ) );
+            r2 = _mm512_loadu_pd( ( double* )( ap + 2*lda ) );
+            r3 = _mm512_loadu_pd( ( double* )( ap + 3*lda ) );
+
+            /* Each 128-bit lane holds one element, so a 4x4 transpose of
+               lanes is all that is needed. */
+            x0 = _mm512_shuffle_f64x2( r0, r1, 0x88 );
+            x1 = _mm512_shuffle_f64x2( r0, r1, 0xDD );
+            y0 = _mm512_shuffle_f64x2( r2, r3, 0x88 );
+            y1 = _mm512_shuffle_f64x2( r2, r3, 0xDD );
+
+            c[0] = _mm512_shuffle_f64x2( x0, y0, 0x88 );
+            c[2] = _mm512_shuffle_f64x2( x0, y0, 0xDD );
+            c[1] = _mm512_shuffle_f64x2( x1, y1, 0x88 );
+            c[3] = _mm512_shuffle_f64x2( x1, y1, 0xDD );
+
+            for ( dim_t k = 0; k < 4; ++k )
+            {
+                if ( conj ) c[k] = _mm512_xor_pd( c[k], conjv );
+
+                c[k] = CMUL512_PD( c[k], alpha_r, alpha_i );
+
+                if ( !beta0 )
+                {
+                    __m512d y = _mm512_loadu_pd( ( double* )( bp + k*ldb ) );
+                    c[k] = _mm512_add_pd( c[k], CMUL512_PD( y, beta_r, beta_i ) );
+                }
+
+                _mm512_storeu_pd( ( double* )( bp + k*ldb ), c[k] );
+            }
+        }
+    }
+
+    if ( m_main < m )
+        bli_ztransposem_zen_int_2x2( conja, m - m_main, n, alpha,
+                                     a + m_main, lda, beta, b + m_main*ldb, ldb );
+    if ( n_main < n )
+        bli_ztransposem_zen_int_2x2( conja, m_main, n - n_main, alpha,
+                                     a + n_main*lda, lda, beta, b + n_main, ldb );
+}
@@ -0,0 +1,232 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   Fixed-size batched gemm kernels (AVX-512).
+
+   Each kernel computes up to 16 (single precision) or 8 (double precision)
+   independent problems at once, one problem per SIMD lane, from operands
+   in the compact layout described with GEMM_BATCH_FIXED_KER_PROT. Since
+   every vector instruction performs the same scalar operation for all
+   problems in the group, no horizontal reductions, masking or edge cases
+   are needed regardless of how small m, n and k are.
+
+   The common square sizes are instantiated with compile-time dimensions so
+   that the loops over i are fully unrolled and the column of c stays in
+   registers; other sizes up to BLIS_GEMM_BATCH_FIXED_MAX use the same code
+   with run-time dimensions.
+*/
+
+// Square sizes that are given their own specialized kernels.
+#define GEMMBF_FOR_SIZES( F, ch, ctype ) \
+	F( ch, ctype, 2 ) F( ch, ctype, 3 ) F( ch, ctype, 4 ) \
+	F( ch, ctype, 6 ) F( ch, ctype, 8 ) F( ch, ctype, 16 )
+
+#define GEMMBF_CASE( ch, ctype, size ) \
+	case size: \
+		bli_##ch##gemm_batch_fixed_zen_int_avx512_##size( alpha, a, b, beta, c ); \
+		return;
+
+// Real domain: c(i,j) := beta * c(i,j) + alpha * sum_p a(i,p) * b(p,j).
+#define GEMMBF_REAL_BODY( ch, vec, lanes, load, store, set1, setzero, fmadd, mul ) \
+{ \
+	const vec  alphav = set1( *alpha ); \
+	const vec  betav  = set1( *beta ); \
+	const bool beta0  = PASTEMAC(ch,eq0)( *beta ); \
+\
+	for ( dim_t j = 0; j < n; ++j ) \
+	{ \
+		vec cv[ BLIS_GEMM_BATCH_FIXED_MAX ]; \
+\
+		/* Clear all of cv (not just the first m elements) so that the \
+		   compiler can see that it is initialized for any run-time m. */ \
+		_Pragma( "GCC unroll 16" ) \
+		for ( dim_t i = 0; i < BLIS_GEMM_BATCH_FIXED_MAX; ++i ) cv[ i ] = setzero(); \
+\
+		for ( dim_t p = 0; p < k; ++p ) \
+		{ \
+			const vec bv = load( b + ( p + j*k )*lanes ); \
+\
+			_Pragma( "GCC unroll 16" ) \
+			for ( dim_t i = 0; i < m; ++i ) \
+				cv[ i ] = fmadd( load( a + ( i + p*m )*lanes ), bv, cv[ i ] ); \
+		} \
+\
+		_Pragma( "GCC unroll 16" ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			vec t = mul( alphav, cv[ i ] ); \
+			if ( !beta0 ) t = fmadd( betav, load( c + ( i + j*m )*lanes ), t ); \
+			store( c + ( i + j*m )*lanes, t ); \
+		} \
+	} \
+}
+
+// Complex domain, with the real and imaginary parts of each element held
+// in separate vectors.
+#define GEMMBF_CMPLX_BODY( ch, ctype_r, vec, lanes, load, store, set1, setzero, fmadd, fnmadd, mul ) \
+{ \
+	ctype_r* restrict ar = ( ctype_r* )a; \
+	ctype_r* restrict br = ( ctype_r* )b; \
+	ctype_r* restrict cr = ( ctype_r* )c; \
+\
+	const vec  alpha_r = set1( PASTEMAC(ch,real)( *alpha ) ); \
+	const vec  alpha_i = set1( PASTEMAC(ch,imag)( *alpha ) ); \
+	const vec  beta_r  = set1( PASTEMAC(ch,real)( *beta ) ); \
+	const vec  beta_i  = set1( PASTEMAC(ch,imag)( *beta ) ); \
+	const bool beta0   = PASTEMAC(ch,eq0)( *beta ); \
+\
+	for ( dim_t j = 0; j < n; ++j ) \
+	{ \
+		vec sr[ BLIS_GEMM_BATCH_FIXED_MAX ]; \
+		vec si[ BLIS_GEMM_BATCH_FIXED_MAX ]; \
+\
+		_Pragma( "GCC unroll 16" ) \
+		for ( dim_t i = 0; i < BLIS_GEMM_BATCH_FIXED_MAX; ++i ) \
+		{ \
+			sr[ i ] = setzero(); \
+			si[ i ] = setzero(); \
+		} \
+\
+		for ( dim_t p = 0; p < k; ++p ) \
+		{ \
+			const vec bvr = load( br + ( p + j*k )*2*lanes ); \
+			const vec bvi = load( br + ( p + j*k )*2*lanes + lanes ); \
+\
+			_Pragma( "GCC unroll 16" ) \
+			for ( dim_t i = 0; i < m; ++i ) \
+			{ \
+				const vec avr = load( ar + ( i + p*m )*2*lanes ); \
+				const vec avi = load( ar + ( i + p*m )*2*lanes + lanes ); \
+\
+				sr[ i ] = fmadd ( avr, bvr, sr[ i ] ); \
+				sr[ i ] = fnmadd( avi, bvi, sr[ i ] ); \
+				si[ i ] = fmadd ( avr, bvi, si[ i ] ); \
+				si[ i ] = fmadd ( avi, bvr, si[ i ] ); \
+			} \
+		} \
+\
+		_Pragma( "GCC unroll 16" ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			ctype_r* restrict cij = cr + ( i + j*m )*2*lanes; \
+\
+			vec tr = fnmadd( alpha_i, si[ i ], mul( alpha_r, sr[ i ] ) ); \
+			vec ti = fmadd ( alpha_i, sr[ i ], mul( alpha_r, si[ i ] ) ); \
+\
+			if ( !beta0 ) \
+			{ \
+				const vec yr = load( cij ); \
+				const vec yi = load( cij + lanes ); \
+\
+				tr = fmadd ( beta_r, yr, tr ); \
+				tr = fnmadd( beta_i, yi, tr ); \
+				ti = fmadd ( beta_r, yi, ti ); \
+				ti = fmadd ( beta_i, yr, ti ); \
+			} \
+\
+			store( cij,         tr ); \
+			store( cij + lanes, ti ); \
+		} \
+	} \
+}
+
+#define GEMMBF_BODY_s \
+	GEMMBF_REAL_BODY( s, __m512, 16, _mm512_load_ps, _mm512_store_ps, _mm512_set1_ps, \
+	                  _mm512_setzero_ps, _mm512_fmadd_ps, _mm512_mul_ps )
+#define GEMMBF_BODY_d \
+	GEMMBF_REAL_BODY( d, __m512d, 8, _mm512_load_pd, _mm512_store_pd, _mm512_set1_pd, \
+	                  _mm512_setzero_pd, _mm512_fmadd_pd, _mm512_mul_pd )
+#define GEMMBF_BODY_c \
+	GEMMBF_CMPLX_BODY( c, float, __m512, 16, _mm512_load_ps, _mm512_store_ps, _mm512_set1_ps, \
+	                   _mm512_setzero_ps, _mm512_fmadd_ps, _mm512_fnmadd_ps, _mm512_mul_ps )
+#define GEMMBF_BODY_z \
+	GEMMBF_CMPLX_BODY( z, double, __m512d, 8, _mm512_load_pd, _mm512_store_pd, _mm512_set1_pd, \
+	                   _mm512_setzero_pd, _mm512_fmadd_pd, _mm512_fnmadd_pd, _mm512_mul_pd )
+
+// Specialized kernel for m = n = k = size.
+#define GEMMBF_FIXED( ch, ctype, size ) \
+\
+static void bli_##ch##gemm_batch_fixed_zen_int_avx512_##size \
+     ( \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, \
+       ctype*  restrict b, \
+       ctype*  restrict beta, \
+       ctype*  restrict c  \
+     ) \
+{ \
+	const dim_t m = size; \
+	const dim_t n = size; \
+	const dim_t k = size; \
+\
+	GEMMBF_BODY_##ch \
+}
+
+#define GEMMBF_KER( ch, ctype ) \
+\
+GEMMBF_FOR_SIZES( GEMMBF_FIXED, ch, ctype ) \
+\
+void bli_##ch##gemm_batch_fixed_zen_int_avx512 \
+     ( \
+       dim_t            m, \
+       dim_t            n, \
+       dim_t            k, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, \
+       ctype*  restrict b, \
+       ctype*  restrict beta, \
+       ctype*  restrict c  \
+     ) \
+{ \
+	if ( m == n && m == k ) \
+	{ \
+		switch ( m ) \
+		{ \
+			GEMMBF_FOR_SIZES( GEMMBF_CASE, ch, ctype ) \
+			default: break; \
+		} \
+	} \
+\
+	GEMMBF_BODY_##ch \
+}
+
+GEMMBF_KER( s, float )
+GEMMBF_KER( d, double )
+GEMMBF_KER( c, scomplex )
+GEMMBF_KER( z, dcomplex )
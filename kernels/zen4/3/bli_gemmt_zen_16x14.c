@@ -0,0 +1,196 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   Diagonal micro-kernels for gemmt/syrk/herk on zen4.
+
+   These kernels share the packed micro-panel format and the register
+   blocking of bli_dgemm_skx_asm_16x14 (MR = 16, NR = 14), but they are only
+   called by the macro-kernels for micro-tiles that intersect the diagonal
+   of C. Instead of computing the full micro-tile into a temporary buffer
+   and then copying the stored triangle back to C, they update only the
+   elements of C that lie on or below (_l) or on or above (_u) the diagonal,
+   using AVX-512 masked loads and stores when C is column-stored. The
+   diagonal offset of the micro-tile is passed through the auxinfo_t
+   object.
+*/
+
+#define D_MR 16
+#define D_NR 14
+
+#define GEMMT_DECL_COL( j ) \
+	__m512d c##j##_0 = _mm512_setzero_pd(); \
+	__m512d c##j##_1 = _mm512_setzero_pd();
+
+#define GEMMT_FMA_COL( j ) \
+	bv = _mm512_set1_pd( b[ j ] ); \
+	c##j##_0 = _mm512_fmadd_pd( a0, bv, c##j##_0 ); \
+	c##j##_1 = _mm512_fmadd_pd( a1, bv, c##j##_1 );
+
+#define GEMMT_SPILL_COL( j ) \
+	_mm512_store_pd( ab + j*D_MR + 0, c##j##_0 ); \
+	_mm512_store_pd( ab + j*D_MR + 8, c##j##_1 );
+
+static void bli_dgemmt_zen_int_16x14_diag
+     (
+       bool                lower,
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data
+     )
+{
+	double ab[ D_MR * D_NR ] __attribute__((aligned(64)));
+
+	GEMMT_DECL_COL( 0 )  GEMMT_DECL_COL( 1 )  GEMMT_DECL_COL( 2 )
+	GEMMT_DECL_COL( 3 )  GEMMT_DECL_COL( 4 )  GEMMT_DECL_COL( 5 )
+	GEMMT_DECL_COL( 6 )  GEMMT_DECL_COL( 7 )  GEMMT_DECL_COL( 8 )
+	GEMMT_DECL_COL( 9 )  GEMMT_DECL_COL( 10 ) GEMMT_DECL_COL( 11 )
+	GEMMT_DECL_COL( 12 ) GEMMT_DECL_COL( 13 )
+
+	// Accumulate the full 16x14 product in registers. Only the store is
+	// restricted to the stored triangle.
+	for ( dim_t p = 0; p < k; ++p )
+	{
+		__m512d a0 = _mm512_loadu_pd( a + 0 );
+		__m512d a1 = _mm512_loadu_pd( a + 8 );
+		__m512d bv;
+
+		GEMMT_FMA_COL( 0 )  GEMMT_FMA_COL( 1 )  GEMMT_FMA_COL( 2 )
+		GEMMT_FMA_COL( 3 )  GEMMT_FMA_COL( 4 )  GEMMT_FMA_COL( 5 )
+		GEMMT_FMA_COL( 6 )  GEMMT_FMA_COL( 7 )  GEMMT_FMA_COL( 8 )
+		GEMMT_FMA_COL( 9 )  GEMMT_FMA_COL( 10 ) GEMMT_FMA_COL( 11 )
+		GEMMT_FMA_COL( 12 ) GEMMT_FMA_COL( 13 )
+
+		a += D_MR;
+		b += D_NR;
+	}
+
+	GEMMT_SPILL_COL( 0 )  GEMMT_SPILL_COL( 1 )  GEMMT_SPILL_COL( 2 )
+	GEMMT_SPILL_COL( 3 )  GEMMT_SPILL_COL( 4 )  GEMMT_SPILL_COL( 5 )
+	GEMMT_SPILL_COL( 6 )  GEMMT_SPILL_COL( 7 )  GEMMT_SPILL_COL( 8 )
+	GEMMT_SPILL_COL( 9 )  GEMMT_SPILL_COL( 10 ) GEMMT_SPILL_COL( 11 )
+	GEMMT_SPILL_COL( 12 ) GEMMT_SPILL_COL( 13 )
+
+	const doff_t  diagoff = bli_auxinfo_diagoff( data );
+	const bool    beta0   = bli_deq0( *beta );
+	const __m512d alphav  = _mm512_set1_pd( *alpha );
+	const __m512d betav   = _mm512_set1_pd( *beta );
+
+	for ( dim_t j = 0; j < D_NR; ++j )
+	{
+		// Element (i,j) of the micro-tile lies on the diagonal when
+		// j - i == diagoff. Find the range of rows [i_beg,i_end) of
+		// column j that belong to the stored triangle.
+		const doff_t i_diag = ( doff_t )j - diagoff;
+		dim_t        i_beg, i_end;
+
+		if ( lower ) { i_beg = bli_max( i_diag, 0 ); i_end = D_MR; }
+		else         { i_beg = 0; i_end = bli_min( i_diag + 1, D_MR ); }
+
+		if ( i_end <= i_beg ) continue;
+
+		double* restrict abj = ab + j*D_MR;
+		double* restrict cj  = c  + j*cs_c;
+
+		if ( rs_c == 1 )
+		{
+			const uint32_t m16 = ( ( 1u << i_end ) - 1u ) &
+			                     ~( ( 1u << i_beg ) - 1u );
+			const __mmask8 m0  = ( __mmask8 )( m16 & 0xFF );
+			const __mmask8 m1  = ( __mmask8 )( m16 >> 8 );
+
+			__m512d t0 = _mm512_mul_pd( alphav, _mm512_load_pd( abj + 0 ) );
+			__m512d t1 = _mm512_mul_pd( alphav, _mm512_load_pd( abj + 8 ) );
+
+			if ( !beta0 )
+			{
+				t0 = _mm512_fmadd_pd( betav, _mm512_maskz_loadu_pd( m0, cj + 0 ), t0 );
+				t1 = _mm512_fmadd_pd( betav, _mm512_maskz_loadu_pd( m1, cj + 8 ), t1 );
+			}
+
+			_mm512_mask_storeu_pd( cj + 0, m0, t0 );
+			_mm512_mask_storeu_pd( cj + 8, m1, t1 );
+		}
+		else
+		{
+			for ( dim_t i = i_beg; i < i_end; ++i )
+			{
+				double* restrict cij = cj + i*rs_c;
+
+				if ( beta0 ) *cij = *alpha * abj[ i ];
+				else         *cij = *beta * *cij + *alpha * abj[ i ];
+			}
+		}
+	}
+}
+
+void bli_dgemmt_l_zen_int_16x14
+     (
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	bli_dgemmt_zen_int_16x14_diag( TRUE, k, alpha, a, b, beta,
+	                               c, rs_c, cs_c, data );
+}
+
+void bli_dgemmt_u_zen_int_16x14
+     (
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	bli_dgemmt_zen_int_16x14_diag( FALSE, k, alpha, a, b, beta,
+	                               c, rs_c, cs_c, data );
+}
@@ -0,0 +1,234 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   Diagonal-block micro-kernels for trmm on zen4.
+
+   These kernels share the packed micro-panel format and the register
+   blocking of bli_dgemm_skx_asm_16x14 (MR = 16, NR = 14). They are called
+   for micro-panels of a packed triangular matrix A whose k dimension ends
+   (_l) or begins (_u) with the MR x MR diagonal block. The rectangular
+   part of the k loop is computed by the context's gemm micro-kernel, and
+   the product of the diagonal block is then accumulated into C. Within
+   that block, the rank-1 updates for columns 8..15 of a lower triangle (or
+   0..7 of an upper triangle) only touch one of the two 8-row halves of the
+   micro-tile, so the FMAs on the known-zero half are skipped.
+*/
+
+#define D_MR 16
+#define D_NR 14
+
+#define TRMM_DECL_COL( j ) \
+	__m512d c##j##_0 = _mm512_setzero_pd(); \
+	__m512d c##j##_1 = _mm512_setzero_pd();
+
+#define TRMM_FMA_COL( j ) \
+	bv = _mm512_set1_pd( b[ j ] ); \
+	c##j##_0 = _mm512_fmadd_pd( a0, bv, c##j##_0 ); \
+	c##j##_1 = _mm512_fmadd_pd( a1, bv, c##j##_1 );
+
+#define TRMM_FMA_COL_0( j ) \
+	bv = _mm512_set1_pd( b[ j ] ); \
+	c##j##_0 = _mm512_fmadd_pd( a0, bv, c##j##_0 );
+
+#define TRMM_FMA_COL_1( j ) \
+	bv = _mm512_set1_pd( b[ j ] ); \
+	c##j##_1 = _mm512_fmadd_pd( a1, bv, c##j##_1 );
+
+#define TRMM_FOR_ALL_COLS( OP ) \
+	OP( 0 )  OP( 1 )  OP( 2 )  OP( 3 )  OP( 4 )  OP( 5 )  OP( 6 ) \
+	OP( 7 )  OP( 8 )  OP( 9 )  OP( 10 ) OP( 11 ) OP( 12 ) OP( 13 )
+
+// Rank-1 update with both halves of the current column of A.
+#define TRMM_RANK1_FULL \
+{ \
+	__m512d a0 = _mm512_loadu_pd( a + 0 ); \
+	__m512d a1 = _mm512_loadu_pd( a + 8 ); \
+	__m512d bv; \
+	TRMM_FOR_ALL_COLS( TRMM_FMA_COL ) \
+	a += D_MR; \
+	b += D_NR; \
+}
+
+// Rank-1 update with only rows 0..7 of the current column of A.
+#define TRMM_RANK1_TOP \
+{ \
+	__m512d a0 = _mm512_loadu_pd( a + 0 ); \
+	__m512d bv; \
+	TRMM_FOR_ALL_COLS( TRMM_FMA_COL_0 ) \
+	a += D_MR; \
+	b += D_NR; \
+}
+
+// Rank-1 update with only rows 8..15 of the current column of A.
+#define TRMM_RANK1_BOT \
+{ \
+	__m512d a1 = _mm512_loadu_pd( a + 8 ); \
+	__m512d bv; \
+	TRMM_FOR_ALL_COLS( TRMM_FMA_COL_1 ) \
+	a += D_MR; \
+	b += D_NR; \
+}
+
+#define TRMM_STORE_COL( j ) \
+{ \
+	double* restrict cj = c + j*cs_c; \
+	__m512d t0 = _mm512_mul_pd( alphav, c##j##_0 ); \
+	__m512d t1 = _mm512_mul_pd( alphav, c##j##_1 ); \
+	if ( !beta0 ) \
+	{ \
+		t0 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( cj + 0 ), t0 ); \
+		t1 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( cj + 8 ), t1 ); \
+	} \
+	_mm512_storeu_pd( cj + 0, t0 ); \
+	_mm512_storeu_pd( cj + 8, t1 ); \
+}
+
+#define TRMM_SPILL_COL( j ) \
+	_mm512_store_pd( ab + j*D_MR + 0, c##j##_0 ); \
+	_mm512_store_pd( ab + j*D_MR + 8, c##j##_1 );
+
+static void bli_dtrmm_zen_int_16x14_diag
+     (
+       bool                lower,
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t k_rect = k - D_MR;
+	double      one    = 1.0;
+
+	// Compute the rectangular part with the gemm micro-kernel, and then
+	// accumulate the diagonal block onto its result.
+	if ( k_rect > 0 )
+	{
+		dgemm_ukr_ft gemm_ukr = bli_cntx_get_l3_nat_ukr_dt( BLIS_DOUBLE, BLIS_GEMM_UKR, cntx );
+
+		if ( lower )
+		{
+			gemm_ukr( k_rect, alpha, a, b, beta, c, rs_c, cs_c, data, cntx );
+
+			a += k_rect * D_MR;
+			b += k_rect * D_NR;
+		}
+		else
+		{
+			gemm_ukr( k_rect, alpha, a + D_MR * D_MR, b + D_MR * D_NR,
+			          beta, c, rs_c, cs_c, data, cntx );
+		}
+
+		beta = &one;
+	}
+
+	TRMM_FOR_ALL_COLS( TRMM_DECL_COL )
+
+	if ( lower )
+	{
+		// Column p of the lower triangular block is zero in rows 0..p-1.
+		for ( dim_t p = 0; p < 8; ++p )    TRMM_RANK1_FULL
+		for ( dim_t p = 8; p < D_MR; ++p ) TRMM_RANK1_BOT
+	}
+	else
+	{
+		// Column p of the upper triangular block is zero in rows p+1..MR-1.
+		for ( dim_t p = 0; p < 8; ++p )    TRMM_RANK1_TOP
+		for ( dim_t p = 8; p < D_MR; ++p ) TRMM_RANK1_FULL
+	}
+
+	const bool    beta0  = bli_deq0( *beta );
+	const __m512d alphav = _mm512_set1_pd( *alpha );
+	const __m512d betav  = _mm512_set1_pd( *beta );
+
+	if ( rs_c == 1 )
+	{
+		TRMM_FOR_ALL_COLS( TRMM_STORE_COL )
+	}
+	else
+	{
+		double ab[ D_MR * D_NR ] __attribute__((aligned(64)));
+
+		TRMM_FOR_ALL_COLS( TRMM_SPILL_COL )
+
+		for ( dim_t j = 0; j < D_NR; ++j )
+		for ( dim_t i = 0; i < D_MR; ++i )
+		{
+			double* restrict cij = c + i*rs_c + j*cs_c;
+
+			if ( beta0 ) *cij = *alpha * ab[ i + j*D_MR ];
+			else         *cij = *beta * *cij + *alpha * ab[ i + j*D_MR ];
+		}
+	}
+}
+
+void bli_dtrmm_l_zen_int_16x14
+     (
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	bli_dtrmm_zen_int_16x14_diag( TRUE, k, alpha, a, b, beta,
+	                              c, rs_c, cs_c, data, cntx );
+}
+
+void bli_dtrmm_u_zen_int_16x14
+     (
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	bli_dtrmm_zen_int_16x14_diag( FALSE, k, alpha, a, b, beta,
+	                              c, rs_c, cs_c, data, cntx );
+}
@@ -32,11 +32,43 @@
 
 */
 
+// -- level-1m --
+
+// transposem (intrinsics)
+TRANSPOSEM_KER_PROT( float,    s, transposem_zen_int_avx512_16x16 )
+TRANSPOSEM_KER_PROT( double,   d, transposem_zen_int_avx512_8x8 )
+TRANSPOSEM_KER_PROT( scomplex, c, transposem_zen_int_avx512_8x8 )
+TRANSPOSEM_KER_PROT( dcomplex, z, transposem_zen_int_avx512_4x4 )
+
 // -- level-1v --
 
 // amaxv (intrinsics)
 AMAXV_KER_PROT( float,    s, amaxv_zen_int_avx512 )
 AMAXV_KER_PROT( double,   d, amaxv_zen_int_avx512 )
 
+// rotv (intrinsics)
+ROTV_KER_PROT( float,    float,  s, s, rotv_zen_int_avx512 )
+ROTV_KER_PROT( double,   double, d, d, rotv_zen_int_avx512 )
+ROTV_KER_PROT( scomplex, float,  c, s, rotv_zen_int_avx512 )
+ROTV_KER_PROT( dcomplex, double, z, d, rotv_zen_int_avx512 )
+
+// rotmv (intrinsics)
+ROTMV_KER_PROT( float,    s, rotmv_zen_int_avx512 )
+ROTMV_KER_PROT( double,   d, rotmv_zen_int_avx512 )
+
 GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_l_zen_asm_16x14)
-GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_u_zen_asm_16x14)
\ No newline at end of file
+GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_u_zen_asm_16x14)
+
+// gemmt diagonal micro-tiles (intrinsics)
+GEMM_UKR_PROT( double,   d, gemmt_l_zen_int_16x14 )
+GEMM_UKR_PROT( double,   d, gemmt_u_zen_int_16x14 )
+
+// trmm diagonal micro-panels (intrinsics)
+GEMM_UKR_PROT( double,   d, trmm_l_zen_int_16x14 )
+GEMM_UKR_PROT( double,   d, trmm_u_zen_int_16x14 )
+
+// fixed-size batched gemm (intrinsics)
+GEMM_BATCH_FIXED_KER_PROT( float,    s, gemm_batch_fixed_zen_int_avx512 )
+GEMM_BATCH_FIXED_KER_PROT( double,   d, gemm_batch_fixed_zen_int_avx512 )
+GEMM_BATCH_FIXED_KER_PROT( scomplex, c, gemm_batch_fixed_zen_int_avx512 )
+GEMM_BATCH_FIXED_KER_PROT( dcomplex, z, gemm_batch_fixed_zen_int_avx512 )
@@ -0,0 +1,106 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Apply the 2x2 transformation H = [ h[0] h[2] ; h[1] h[3] ] (stored by
+// columns) to the pair ( x, y ):
+//
+//   x := h11 * x + h12 * y
+//   y := h21 * x + h22 * y
+//
+// This is the BLAS ?rotm operation once the caller has expanded the flag of
+// the modified Givens parameters into a full H.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t            n, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict y, inc_t incy, \
+       ctype*  restrict h, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	const ctype h11 = h[0]; \
+	const ctype h21 = h[1]; \
+	const ctype h12 = h[2]; \
+	const ctype h22 = h[3]; \
+\
+	if ( incx == 1 && incy == 1 ) \
+	{ \
+		PRAGMA_SIMD \
+		for ( dim_t i = 0; i < n; ++i ) \
+		{ \
+			ctype chi; \
+			ctype psi; \
+\
+			PASTEMAC(ch,scal2s)( h11, x[i], chi ); \
+			PASTEMAC(ch,axpys)( h12, y[i], chi ); \
+			PASTEMAC(ch,scal2s)( h21, x[i], psi ); \
+			PASTEMAC(ch,axpys)( h22, y[i], psi ); \
+\
+			PASTEMAC(ch,copys)( chi, x[i] ); \
+			PASTEMAC(ch,copys)( psi, y[i] ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < n; ++i ) \
+		{ \
+			ctype chi; \
+			ctype psi; \
+\
+			PASTEMAC(ch,scal2s)( h11, *x, chi ); \
+			PASTEMAC(ch,axpys)( h12, *y, chi ); \
+			PASTEMAC(ch,scal2s)( h21, *x, psi ); \
+			PASTEMAC(ch,axpys)( h22, *y, psi ); \
+\
+			PASTEMAC(ch,copys)( chi, *x ); \
+			PASTEMAC(ch,copys)( psi, *y ); \
+\
+			x += incx; \
+			y += incy; \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC2( rotmv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
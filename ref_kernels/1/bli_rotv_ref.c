@@ -0,0 +1,110 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Apply the plane rotation defined by c (real) and s to the pair ( x, y ):
+//
+//   x := c * x + s * y
+//   y := c * y - conj( s ) * x
+//
+// For real datatypes this is the BLAS ?rot operation. For complex vectors,
+// a real s gives csrot/zdrot and a complex s the rotation of LAPACK's
+// crot/zrot.
+//
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       ctype_r* restrict c, \
+       ctype*   restrict s, \
+       cntx_t*  restrict cntx  \
+     ) \
+{ \
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	ctype gamma; \
+	ctype sigma; \
+	ctype minus_sigma_conj; \
+\
+	PASTEMAC2(chr,ch,copys)( *c, gamma ); \
+	PASTEMAC(ch,copys)( *s, sigma ); \
+	PASTEMAC(ch,scal2js)( *PASTEMAC(ch,m1), *s, minus_sigma_conj ); \
+\
+	if ( incx == 1 && incy == 1 ) \
+	{ \
+		PRAGMA_SIMD \
+		for ( dim_t i = 0; i < n; ++i ) \
+		{ \
+			ctype chi; \
+			ctype psi; \
+\
+			PASTEMAC(ch,scal2s)( gamma, x[i], chi ); \
+			PASTEMAC(ch,axpys)( sigma, y[i], chi ); \
+			PASTEMAC(ch,scal2s)( gamma, y[i], psi ); \
+			PASTEMAC(ch,axpys)( minus_sigma_conj, x[i], psi ); \
+\
+			PASTEMAC(ch,copys)( chi, x[i] ); \
+			PASTEMAC(ch,copys)( psi, y[i] ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < n; ++i ) \
+		{ \
+			ctype chi; \
+			ctype psi; \
+\
+			PASTEMAC(ch,scal2s)( gamma, *x, chi ); \
+			PASTEMAC(ch,axpys)( sigma, *y, chi ); \
+			PASTEMAC(ch,scal2s)( gamma, *y, psi ); \
+			PASTEMAC(ch,axpys)( minus_sigma_conj, *x, psi ); \
+\
+			PASTEMAC(ch,copys)( chi, *x ); \
+			PASTEMAC(ch,copys)( psi, *y ); \
+\
+			x += incx; \
+			y += incy; \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC2( rotv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
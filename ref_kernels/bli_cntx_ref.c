@@ -301,6 +301,10 @@
 #define dotxv_ker_name     GENARNAME(dotxv)
 #undef  invertv_ker_name
 #define invertv_ker_name   GENARNAME(invertv)
+#undef  rotv_ker_name
+#define rotv_ker_name      GENARNAME(rotv)
+#undef  rotmv_ker_name
+#define rotmv_ker_name     GENARNAME(rotmv)
 #undef  scalv_ker_name
 #define scalv_ker_name     GENARNAME(scalv)
 #undef  scal2v_ker_name
@@ -559,6 +563,8 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_SUBV_KER ],    subv_ker_name    );
 	gen_func_init( &funcs[ BLIS_SWAPV_KER ],   swapv_ker_name   );
 	gen_func_init( &funcs[ BLIS_XPBYV_KER ],   xpbyv_ker_name   );
+	gen_func_init( &funcs[ BLIS_ROTV_KER ],    rotv_ker_name    );
+	gen_func_init( &funcs[ BLIS_ROTMV_KER ],   rotmv_ker_name   );
 
 
 	// -- Set level-1m (packm/unpackm) kernels ---------------------------------
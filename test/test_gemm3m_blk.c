@@ -0,0 +1,159 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Check ?gemm3m_() against ?gemm_() on problems large enough to take the
+// blocked 3M path, with odd m, n and k, several values of transa and transb,
+// beta = 0 (c is not read) and beta != 0, and k spanning several blocks.
+//
+// The 3M algorithm forms the imaginary part of each product as
+// ( ar + ai )( br + bi ) - ar br - ai bi, whose rounding error is bounded by
+// a small multiple of k eps ( |ar| + |ai| )( |br| + |bi| ) rather than by
+// the smaller bound of the conventional product. With the components of a
+// and b in [-1,1] and |alpha| <= 2, every element of the two results must
+// therefore agree to within TOL_FACTOR * k * eps.
+
+#define TOL_FACTOR 16.0
+
+typedef struct
+{
+	f77_int m, n, k;
+} shape_t;
+
+static const shape_t shapes[] =
+{
+	{  257,  263,  259 },
+	{  301,  257,  777 },
+	{  601,  533, 1031 },
+};
+
+static const char trans_pairs[][ 2 ] =
+{
+	{ 'N', 'N' },
+	{ 'T', 'C' },
+	{ 'C', 'T' },
+};
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname ) \
+\
+static int PASTEMAC(ch,opname) \
+     ( \
+       char           transa, \
+       char           transb, \
+       const shape_t* s, \
+       bool           beta0  \
+     ) \
+{ \
+	f77_int m = s->m, n = s->n, k = s->k; \
+	f77_int lda = ( transa == 'N' ? m : k ) + 3; \
+	f77_int ldb = ( transb == 'N' ? k : n ) + 1; \
+	f77_int ldc = m + 2; \
+	ctype   alpha, beta; \
+	double  diff = 0.0; \
+\
+	const double eps = ( sizeof( ctype_r ) == sizeof( float ) ? FLT_EPSILON \
+	                                                      : DBL_EPSILON ); \
+	const double tol = TOL_FACTOR * k * eps; \
+\
+	ctype* a     = malloc( lda * ( transa == 'N' ? k : m ) * sizeof( ctype ) ); \
+	ctype* b     = malloc( ldb * ( transb == 'N' ? n : k ) * sizeof( ctype ) ); \
+	ctype* c     = malloc( ldc * n * sizeof( ctype ) ); \
+	ctype* c_ref = malloc( ldc * n * sizeof( ctype ) ); \
+\
+	PASTEMAC(ch,randv)( lda * ( transa == 'N' ? k : m ), a, 1 ); \
+	PASTEMAC(ch,randv)( ldb * ( transb == 'N' ? n : k ), b, 1 ); \
+	PASTEMAC(ch,randv)( ldc * n, c, 1 ); \
+	memcpy( c_ref, c, ldc * n * sizeof( ctype ) ); \
+\
+	PASTEMAC(ch,sets)( 1.5, -0.5, alpha ); \
+	PASTEMAC(ch,sets)( 0.5, 0.25, beta ); \
+	if ( beta0 ) PASTEMAC(ch,set0s)( beta ); \
+\
+	PASTEF77(ch,gemm3m)( &transa, &transb, &m, &n, &k, &alpha, a, &lda, \
+	                     b, &ldb, &beta, c, &ldc ); \
+	PASTEF77(ch,gemm)( &transa, &transb, &m, &n, &k, &alpha, a, &lda, \
+	                   b, &ldb, &beta, c_ref, &ldc ); \
+\
+	for ( dim_t j = 0; j < n; ++j ) \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ctype  y = c[ i + j * ldc ]; \
+		double d; \
+\
+		PASTEMAC(ch,subs)( c_ref[ i + j * ldc ], y ); \
+		PASTEMAC2(ch,d,abval2s)( y, d ); \
+		diff = bli_max( diff, d ); \
+	} \
+\
+	free( a ); \
+	free( b ); \
+	free( c ); \
+	free( c_ref ); \
+\
+	printf( "%c %c %c m = %4d n = %4d k = %4d beta %s  diff = %8.2e  tol = %8.2e  %s\n", \
+	        #ch[ 0 ], transa, transb, ( int )m, ( int )n, ( int )k, \
+	        beta0 ? "= 0 " : "!= 0", diff, tol, diff <= tol ? "PASS" : "FAIL" ); \
+\
+	return diff <= tol ? 0 : 1; \
+}
+
+GENTFUNCCO( scomplex, float,  c, s, test_gemm3m_blk )
+GENTFUNCCO( dcomplex, double, z, d, test_gemm3m_blk )
+
+int main( int argc, char** argv )
+{
+	int n_bad = 0;
+
+	bli_init();
+
+	for ( dim_t i = 0; i < sizeof( shapes ) / sizeof( shapes[ 0 ] ); ++i )
+	for ( dim_t t = 0; t < sizeof( trans_pairs ) / sizeof( trans_pairs[ 0 ] ); ++t )
+	for ( int beta0 = 0; beta0 <= 1; ++beta0 )
+	{
+		const char ta = trans_pairs[ t ][ 0 ];
+		const char tb = trans_pairs[ t ][ 1 ];
+
+		n_bad += bli_ctest_gemm3m_blk( ta, tb, &shapes[ i ], beta0 );
+		n_bad += bli_ztest_gemm3m_blk( ta, tb, &shapes[ i ], beta0 );
+	}
+
+	printf( "%s: %d failure(s)\n", n_bad == 0 ? "PASS" : "FAIL", n_bad );
+
+	bli_finalize();
+
+	return n_bad == 0 ? 0 : 1;
+}
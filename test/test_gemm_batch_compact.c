@@ -0,0 +1,152 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Compare three ways of computing a large batch of tiny double-precision
+// products of a common size (the m = n = k = 3 and 6 cases are typical of
+// mechanics and robotics codes):
+//  - a loop of dgemm_() calls, one per problem,
+//  - bli_dgemm_batch_fixed_strided() on column-major operands, which
+//    gathers each group of problems into the compact layout and back,
+//  - bli_dgemm_batch_compact() on operands kept in the compact layout, as
+//    a caller that issues many batches over the same operands would do.
+// Each timing is the best of several repetitions and is reported in GFLOPS.
+// The results of the batched calls are checked against those of dgemm_().
+
+#define N_REPEATS 5
+
+static double max_diff( dim_t len, double* x, double* y )
+{
+	double diff = 0.0;
+
+	for ( dim_t i = 0; i < len; ++i )
+		diff = bli_max( diff, bli_fabs( x[ i ] - y[ i ] ) );
+
+	return diff;
+}
+
+int main( int argc, char** argv )
+{
+	const dim_t sizes[] = { 3, 4, 6, 8, 16 };
+	const dim_t batch   = 20000;
+
+	int n_bad = 0;
+
+	bli_init();
+
+	printf( "%% size      batch   dgemm_ loop   batch_fixed_strided   batch_compact\n" );
+
+	for ( dim_t s = 0; s < sizeof( sizes ) / sizeof( sizes[ 0 ] ); ++s )
+	{
+		const dim_t  m     = sizes[ s ];
+		const dim_t  len   = m * m * batch;
+		const double flops = 2.0 * m * m * m * batch;
+		double       alpha = 1.0, beta = 1.0;
+		double       t_loop = DBL_MAX, t_fixed = DBL_MAX, t_compact = DBL_MAX;
+		obj_t        x;
+
+		double* a     = bli_malloc_user( len * sizeof( double ) );
+		double* b     = bli_malloc_user( len * sizeof( double ) );
+		double* c0    = bli_malloc_user( len * sizeof( double ) );
+		double* c     = bli_malloc_user( len * sizeof( double ) );
+		double* c_ref = bli_malloc_user( len * sizeof( double ) );
+
+		double* a_c   = bli_malloc_user( bli_dgemm_batch_compact_size( m, m, batch ) );
+		double* b_c   = bli_malloc_user( bli_dgemm_batch_compact_size( m, m, batch ) );
+		double* c_c   = bli_malloc_user( bli_dgemm_batch_compact_size( m, m, batch ) );
+
+		bli_obj_create_with_attached_buffer( BLIS_DOUBLE, len, 1, a,  1, len, &x ); bli_randv( &x );
+		bli_obj_create_with_attached_buffer( BLIS_DOUBLE, len, 1, b,  1, len, &x ); bli_randv( &x );
+		bli_obj_create_with_attached_buffer( BLIS_DOUBLE, len, 1, c0, 1, len, &x ); bli_randv( &x );
+
+		bli_dgemm_batch_compact_pack( BLIS_NO_TRANSPOSE, m, m, a, 1, m, m * m, batch, a_c );
+		bli_dgemm_batch_compact_pack( BLIS_NO_TRANSPOSE, m, m, b, 1, m, m * m, batch, b_c );
+
+		for ( dim_t r = 0; r < N_REPEATS; ++r )
+		{
+			f77_char t   = 'N';
+			f77_int  mm  = m;
+			double   t0;
+
+			memcpy( c_ref, c0, len * sizeof( double ) );
+			t0 = bli_clock();
+			for ( dim_t i = 0; i < batch; ++i )
+			{
+				const dim_t o = i * m * m;
+
+				dgemm_( &t, &t, &mm, &mm, &mm, &alpha, a + o, &mm,
+				        b + o, &mm, &beta, c_ref + o, &mm );
+			}
+			t_loop = bli_clock_min_diff( t_loop, t0 );
+
+			memcpy( c, c0, len * sizeof( double ) );
+			t0 = bli_clock();
+			bli_dgemm_batch_fixed_strided( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE,
+			  m, m, m, &alpha, a, 1, m, m * m, b, 1, m, m * m,
+			  &beta, c, 1, m, m * m, batch );
+			t_fixed = bli_clock_min_diff( t_fixed, t0 );
+
+			bli_dgemm_batch_compact_pack( BLIS_NO_TRANSPOSE, m, m, c0, 1, m, m * m, batch, c_c );
+			t0 = bli_clock();
+			bli_dgemm_batch_compact( m, m, m, &alpha, a_c, b_c, &beta, c_c, batch );
+			t_compact = bli_clock_min_diff( t_compact, t0 );
+		}
+
+		const double d_fixed = max_diff( len, c, c_ref );
+
+		bli_dgemm_batch_compact_unpack( m, m, c_c, c, 1, m, m * m, batch );
+
+		const double d_compact = max_diff( len, c, c_ref );
+		const bool   bad       = !( d_fixed <= 1e-12 ) || !( d_compact <= 1e-12 );
+
+		if ( bad ) ++n_bad;
+
+		printf( "%4ld %10ld %13.2f %21.2f %15.2f   %s\n",
+		        ( long )m, ( long )batch,
+		        flops / t_loop / 1e9, flops / t_fixed / 1e9, flops / t_compact / 1e9,
+		        bad ? "FAIL" : "PASS" );
+
+		bli_free_user( a );     bli_free_user( b );   bli_free_user( c0 );
+		bli_free_user( c );     bli_free_user( c_ref );
+		bli_free_user( a_c );   bli_free_user( b_c ); bli_free_user( c_c );
+	}
+
+	printf( "%s: %d failure(s)\n", n_bad ? "FAIL" : "PASS", n_bad );
+
+	bli_finalize();
+
+	return ( n_bad != 0 );
+}
@@ -0,0 +1,540 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Check the batched gemm entry points against a loop of bli_gemm() calls:
+//  - bli_?gemm_batch_fixed_strided() and bli_?gemm_batch_fixed_array(),
+//  - bli_?gemm_batch_compact(), on operands converted to and from the
+//    compact layout,
+//  - bli_?gemm_batch_strided() and bli_gemm_batch_strided(),
+//  - ?gemm_batch_strided_() and cblas_?gemm_batch_strided().
+// Each case is run for every datatype and a few batch counts, transposes
+// and operand layouts. Set BLIS_NUM_THREADS to exercise the threaded paths.
+
+// Operand layouts. The batch strides are those of the A, B and C operands.
+typedef enum
+{
+	COL_PACKED = 0, // column-major, consecutive problems
+	COL_PADDED,     // column-major, padded leading dimensions and strides
+	ROW_PADDED,     // row-major, padded leading dimensions and strides
+	COL_SHARED_B,   // one B for all problems; the a_i and c_i stack into
+	                // single tall matrices
+	COL_SHARED_A,   // one A for all problems
+	NUM_LAYOUTS
+} layout_t;
+
+static const char* layout_str[ NUM_LAYOUTS ] =
+{
+	"col", "col-padded", "row-padded", "shared-b", "shared-a"
+};
+
+typedef struct
+{
+	num_t   dt;
+	trans_t transa;
+	trans_t transb;
+	dim_t   m, n, k;
+	dim_t   batch;
+
+	inc_t   rs_a, cs_a, bs_a;
+	inc_t   rs_b, cs_b, bs_b;
+	inc_t   rs_c, cs_c, bs_c;
+
+	void*   a;
+	void*   b;
+	void*   c;
+	void*   c_ref;
+	siz_t   len_c;
+
+	obj_t   alpha;
+	obj_t   beta;
+} batch_t;
+
+// Set the strides of an r x c operand of the given layout. The stacked
+// layouts place problem i at row offset i * r of a matrix with batch * r
+// rows.
+static void set_strides
+     (
+       layout_t layout, dim_t r, dim_t c, dim_t batch, bool shared,
+       inc_t* rs, inc_t* cs, inc_t* bs
+     )
+{
+	switch ( layout )
+	{
+		case COL_PACKED:
+			*rs = 1; *cs = r; *bs = r * c; break;
+		case COL_PADDED:
+			*rs = 1; *cs = r + 3; *bs = ( r + 3 ) * c + 5; break;
+		case ROW_PADDED:
+			*rs = c + 2; *cs = 1; *bs = r * ( c + 2 ) + 1; break;
+		default:
+			if ( layout == COL_SHARED_B && !shared )
+			{
+				*rs = 1; *cs = r * batch; *bs = r;
+			}
+			else
+			{
+				*rs = 1; *cs = r; *bs = r * c;
+			}
+	}
+
+	if ( shared ) *bs = 0;
+}
+
+static siz_t operand_len( dim_t r, dim_t c, inc_t rs, inc_t cs, inc_t bs, dim_t batch )
+{
+	return ( r - 1 ) * rs + ( c - 1 ) * cs + ( batch - 1 ) * bs + 1;
+}
+
+static void* create_operand( num_t dt, siz_t len )
+{
+	void* buf = bli_malloc_user( len * bli_dt_size( dt ) );
+	obj_t x;
+
+	bli_obj_create_with_attached_buffer( dt, len, 1, buf, 1, len, &x );
+	bli_randv( &x );
+
+	return buf;
+}
+
+static void* offset( num_t dt, void* p, inc_t off )
+{
+	return ( char* )p + off * ( inc_t )bli_dt_size( dt );
+}
+
+static void init_batch
+     (
+       num_t dt, trans_t transa, trans_t transb,
+       dim_t m, dim_t n, dim_t k, dim_t batch, layout_t layout,
+       batch_t* p
+     )
+{
+	const dim_t m_a = bli_does_trans( transa ) ? k : m;
+	const dim_t n_a = bli_does_trans( transa ) ? m : k;
+	const dim_t m_b = bli_does_trans( transb ) ? n : k;
+	const dim_t n_b = bli_does_trans( transb ) ? k : n;
+
+	p->dt = dt; p->transa = transa; p->transb = transb;
+	p->m = m; p->n = n; p->k = k; p->batch = batch;
+
+	set_strides( layout, m_a, n_a, batch, layout == COL_SHARED_A,
+	             &p->rs_a, &p->cs_a, &p->bs_a );
+	set_strides( layout, m_b, n_b, batch, layout == COL_SHARED_B,
+	             &p->rs_b, &p->cs_b, &p->bs_b );
+	set_strides( layout, m,   n,   batch, FALSE,
+	             &p->rs_c, &p->cs_c, &p->bs_c );
+
+	p->len_c = operand_len( m, n, p->rs_c, p->cs_c, p->bs_c, batch );
+
+	p->a     = create_operand( dt, operand_len( m_a, n_a, p->rs_a, p->cs_a, p->bs_a, batch ) );
+	p->b     = create_operand( dt, operand_len( m_b, n_b, p->rs_b, p->cs_b, p->bs_b, batch ) );
+	p->c     = create_operand( dt, p->len_c );
+	p->c_ref = bli_malloc_user( p->len_c * bli_dt_size( dt ) );
+
+	memcpy( p->c_ref, p->c, p->len_c * bli_dt_size( dt ) );
+
+	bli_obj_create_1x1( dt, &p->alpha );
+	bli_obj_create_1x1( dt, &p->beta );
+	bli_setsc(  1.2, 0.3, &p->alpha );
+	bli_setsc( -0.7, 0.4, &p->beta );
+
+	// Compute the reference with one bli_gemm() per problem.
+	for ( dim_t i = 0; i < batch; ++i )
+	{
+		obj_t ao, bo, co;
+
+		bli_obj_create_with_attached_buffer( dt, m_a, n_a,
+		  offset( dt, p->a, i * p->bs_a ), p->rs_a, p->cs_a, &ao );
+		bli_obj_create_with_attached_buffer( dt, m_b, n_b,
+		  offset( dt, p->b, i * p->bs_b ), p->rs_b, p->cs_b, &bo );
+		bli_obj_create_with_attached_buffer( dt, m, n,
+		  offset( dt, p->c_ref, i * p->bs_c ), p->rs_c, p->cs_c, &co );
+
+		bli_obj_set_conjtrans( transa, &ao );
+		bli_obj_set_conjtrans( transb, &bo );
+
+		bli_gemm( &p->alpha, &ao, &bo, &p->beta, &co );
+	}
+}
+
+static void free_batch( batch_t* p )
+{
+	bli_free_user( p->a );
+	bli_free_user( p->b );
+	bli_free_user( p->c );
+	bli_free_user( p->c_ref );
+	bli_obj_free( &p->alpha );
+	bli_obj_free( &p->beta );
+}
+
+// Return the largest difference between any problem of the result, which is
+// computed in a copy of the initial C, and the reference. The copy is then
+// reset for the next entry point.
+static double check_batch( batch_t* p, void* c )
+{
+	const num_t dt_r = bli_dt_proj_to_real( p->dt );
+	double      diff = 0.0;
+	double      d_r, d_i;
+	obj_t       norm;
+
+	bli_obj_create_1x1( dt_r, &norm );
+
+	for ( dim_t i = 0; i < p->batch; ++i )
+	{
+		obj_t co, ro;
+
+		bli_obj_create_with_attached_buffer( p->dt, p->m, p->n,
+		  offset( p->dt, c, i * p->bs_c ), p->rs_c, p->cs_c, &co );
+		bli_obj_create_with_attached_buffer( p->dt, p->m, p->n,
+		  offset( p->dt, p->c_ref, i * p->bs_c ), p->rs_c, p->cs_c, &ro );
+
+		// co := co - ro, which is undone below.
+		bli_subm( &ro, &co );
+		bli_normim( &co, &norm );
+		bli_addm( &ro, &co );
+
+		bli_getsc( &norm, &d_r, &d_i );
+
+		if ( d_r > diff ) diff = d_r;
+	}
+
+	bli_obj_free( &norm );
+
+	memcpy( c, p->c, p->len_c * bli_dt_size( p->dt ) );
+
+	return diff;
+}
+
+static char trans_char( trans_t trans )
+{
+	f77_char t;
+
+	bli_param_map_blis_to_netlib_trans( trans, &t );
+
+	return t;
+}
+
+#ifdef BLIS_ENABLE_CBLAS
+static enum CBLAS_TRANSPOSE trans_cblas( trans_t trans )
+{
+	if ( bli_is_conjtrans( trans ) ) return CblasConjTrans;
+	if ( bli_is_trans( trans ) )     return CblasTrans;
+	return CblasNoTrans;
+}
+#endif
+
+#define CALL_BATCH_FIXED_STRIDED( ch, ctype ) \
+	PASTEMAC(ch,gemm_batch_fixed_strided) \
+	( \
+	  p->transa, p->transb, p->m, p->n, p->k, \
+	  bli_obj_buffer( &p->alpha ), \
+	  p->a, p->rs_a, p->cs_a, p->bs_a, \
+	  p->b, p->rs_b, p->cs_b, p->bs_b, \
+	  bli_obj_buffer( &p->beta ), \
+	  c,    p->rs_c, p->cs_c, p->bs_c, \
+	  p->batch \
+	)
+
+#define CALL_BATCH_FIXED_ARRAY( ch, ctype ) \
+	PASTEMAC(ch,gemm_batch_fixed_array) \
+	( \
+	  p->transa, p->transb, p->m, p->n, p->k, \
+	  bli_obj_buffer( &p->alpha ), \
+	  ( ctype** )ap, p->rs_a, p->cs_a, \
+	  ( ctype** )bp, p->rs_b, p->cs_b, \
+	  bli_obj_buffer( &p->beta ), \
+	  ( ctype** )cp, p->rs_c, p->cs_c, \
+	  p->batch \
+	)
+
+#define CALL_BATCH_COMPACT( ch, ctype ) \
+	{ \
+		const siz_t size_a = PASTEMAC(ch,gemm_batch_compact_size)( p->m, p->k, p->batch ); \
+		const siz_t size_b = PASTEMAC(ch,gemm_batch_compact_size)( p->k, p->n, p->batch ); \
+		const siz_t size_c = PASTEMAC(ch,gemm_batch_compact_size)( p->m, p->n, p->batch ); \
+		ctype*      a_c    = bli_malloc_user( size_a ); \
+		ctype*      b_c    = bli_malloc_user( size_b ); \
+		ctype*      c_c    = bli_malloc_user( size_c ); \
+\
+		PASTEMAC(ch,gemm_batch_compact_pack)( p->transa, p->m, p->k, \
+		  p->a, p->rs_a, p->cs_a, p->bs_a, p->batch, a_c ); \
+		PASTEMAC(ch,gemm_batch_compact_pack)( p->transb, p->k, p->n, \
+		  p->b, p->rs_b, p->cs_b, p->bs_b, p->batch, b_c ); \
+		PASTEMAC(ch,gemm_batch_compact_pack)( BLIS_NO_TRANSPOSE, p->m, p->n, \
+		  c, p->rs_c, p->cs_c, p->bs_c, p->batch, c_c ); \
+\
+		PASTEMAC(ch,gemm_batch_compact) \
+		( \
+		  p->m, p->n, p->k, \
+		  bli_obj_buffer( &p->alpha ), a_c, b_c, \
+		  bli_obj_buffer( &p->beta ), c_c, \
+		  p->batch \
+		); \
+\
+		PASTEMAC(ch,gemm_batch_compact_unpack)( p->m, p->n, c_c, \
+		  c, p->rs_c, p->cs_c, p->bs_c, p->batch ); \
+\
+		bli_free_user( a_c ); \
+		bli_free_user( b_c ); \
+		bli_free_user( c_c ); \
+	}
+
+#define CALL_BATCH_STRIDED( ch, ctype ) \
+	PASTEMAC(ch,gemm_batch_strided) \
+	( \
+	  p->transa, p->transb, p->m, p->n, p->k, \
+	  bli_obj_buffer( &p->alpha ), \
+	  p->a, p->rs_a, p->cs_a, p->bs_a, \
+	  p->b, p->rs_b, p->cs_b, p->bs_b, \
+	  bli_obj_buffer( &p->beta ), \
+	  c,    p->rs_c, p->cs_c, p->bs_c, \
+	  p->batch \
+	)
+
+#define CALL_BLAS_BATCH_STRIDED( ch, ctype ) \
+	PASTEF77(ch,gemm_batch_strided) \
+	( \
+	  &ta, &tb, &m, &n, &k, \
+	  bli_obj_buffer( &p->alpha ), \
+	  p->a, &lda, &bsa, \
+	  p->b, &ldb, &bsb, \
+	  bli_obj_buffer( &p->beta ), \
+	  c,    &ldc, &bsc, \
+	  &batch \
+	)
+
+#define DISPATCH( dt, CALL ) \
+	switch ( dt ) \
+	{ \
+		case BLIS_FLOAT:    CALL( s, float );    break; \
+		case BLIS_DOUBLE:   CALL( d, double );   break; \
+		case BLIS_SCOMPLEX: CALL( c, scomplex ); break; \
+		case BLIS_DCOMPLEX: CALL( z, dcomplex ); break; \
+		default: break; \
+	}
+
+// Run every entry point that supports the layout of the batch, and return
+// the number of failures.
+static int test_batch( batch_t* p, double thresh, const char* label )
+{
+	void*  c     = bli_malloc_user( p->len_c * bli_dt_size( p->dt ) );
+	void** ap    = bli_malloc_user( p->batch * sizeof( void* ) );
+	void** bp    = bli_malloc_user( p->batch * sizeof( void* ) );
+	void** cp    = bli_malloc_user( p->batch * sizeof( void* ) );
+	int    n_bad = 0;
+	double diff;
+
+	memcpy( c, p->c, p->len_c * bli_dt_size( p->dt ) );
+
+	for ( dim_t i = 0; i < p->batch; ++i )
+	{
+		ap[ i ] = offset( p->dt, p->a, i * p->bs_a );
+		bp[ i ] = offset( p->dt, p->b, i * p->bs_b );
+		cp[ i ] = offset( p->dt, c,    i * p->bs_c );
+	}
+
+#define REPORT( name ) \
+	{ \
+		const bool bad = !( diff <= thresh ); \
+		if ( bad ) ++n_bad; \
+		printf( "%-28s %s diff = %8.2e  %s\n", name, label, diff, \
+		        bad ? "FAIL" : "PASS" ); \
+	}
+
+	DISPATCH( p->dt, CALL_BATCH_FIXED_STRIDED );
+	diff = check_batch( p, c );
+	REPORT( "bli_?gemm_batch_fixed_strided" );
+
+	DISPATCH( p->dt, CALL_BATCH_FIXED_ARRAY );
+	diff = check_batch( p, c );
+	REPORT( "bli_?gemm_batch_fixed_array" );
+
+	DISPATCH( p->dt, CALL_BATCH_COMPACT );
+	diff = check_batch( p, c );
+	REPORT( "bli_?gemm_batch_compact" );
+
+	DISPATCH( p->dt, CALL_BATCH_STRIDED );
+	diff = check_batch( p, c );
+	REPORT( "bli_?gemm_batch_strided" );
+
+	{
+		const dim_t m_a = bli_does_trans( p->transa ) ? p->k : p->m;
+		const dim_t n_a = bli_does_trans( p->transa ) ? p->m : p->k;
+		const dim_t m_b = bli_does_trans( p->transb ) ? p->n : p->k;
+		const dim_t n_b = bli_does_trans( p->transb ) ? p->k : p->n;
+		obj_t       ao, bo, co;
+
+		bli_obj_create_with_attached_buffer( p->dt, m_a, n_a, p->a, p->rs_a, p->cs_a, &ao );
+		bli_obj_create_with_attached_buffer( p->dt, m_b, n_b, p->b, p->rs_b, p->cs_b, &bo );
+		bli_obj_create_with_attached_buffer( p->dt, p->m, p->n, c, p->rs_c, p->cs_c, &co );
+		bli_obj_set_conjtrans( p->transa, &ao );
+		bli_obj_set_conjtrans( p->transb, &bo );
+
+		bli_gemm_batch_strided( &p->alpha, &ao, p->bs_a, &bo, p->bs_b,
+		                        &p->beta, &co, p->bs_c, p->batch );
+		diff = check_batch( p, c );
+		REPORT( "bli_gemm_batch_strided" );
+	}
+
+#ifdef BLIS_ENABLE_BLAS
+	// The BLAS interface only supports column-major operands.
+	if ( p->rs_a == 1 && p->rs_b == 1 && p->rs_c == 1 )
+	{
+		f77_char ta    = trans_char( p->transa );
+		f77_char tb    = trans_char( p->transb );
+		f77_int  m     = p->m,    n   = p->n,    k   = p->k;
+		f77_int  lda   = p->cs_a, ldb = p->cs_b, ldc = p->cs_c;
+		f77_int  bsa   = p->bs_a, bsb = p->bs_b, bsc = p->bs_c;
+		f77_int  batch = p->batch;
+
+		DISPATCH( p->dt, CALL_BLAS_BATCH_STRIDED );
+		diff = check_batch( p, c );
+		REPORT( "?gemm_batch_strided_" );
+	}
+#endif
+
+#ifdef BLIS_ENABLE_CBLAS
+	if ( ( p->rs_a == 1 && p->rs_b == 1 && p->rs_c == 1 ) ||
+	     ( p->cs_a == 1 && p->cs_b == 1 && p->cs_c == 1 ) )
+	{
+		const bool                 row = ( p->cs_c == 1 && p->rs_c != 1 );
+		const enum CBLAS_ORDER     ord = ( row ? CblasRowMajor : CblasColMajor );
+		const enum CBLAS_TRANSPOSE ta  = trans_cblas( p->transa );
+		const enum CBLAS_TRANSPOSE tb  = trans_cblas( p->transb );
+		const f77_int              lda = ( row ? p->rs_a : p->cs_a );
+		const f77_int              ldb = ( row ? p->rs_b : p->cs_b );
+		const f77_int              ldc = ( row ? p->rs_c : p->cs_c );
+		void*                      al  = bli_obj_buffer( &p->alpha );
+		void*                      be  = bli_obj_buffer( &p->beta );
+
+		switch ( p->dt )
+		{
+			case BLIS_FLOAT:
+				cblas_sgemm_batch_strided( ord, ta, tb, p->m, p->n, p->k,
+				  *( float* )al, p->a, lda, p->bs_a, p->b, ldb, p->bs_b,
+				  *( float* )be, c, ldc, p->bs_c, p->batch );
+				break;
+			case BLIS_DOUBLE:
+				cblas_dgemm_batch_strided( ord, ta, tb, p->m, p->n, p->k,
+				  *( double* )al, p->a, lda, p->bs_a, p->b, ldb, p->bs_b,
+				  *( double* )be, c, ldc, p->bs_c, p->batch );
+				break;
+			case BLIS_SCOMPLEX:
+				cblas_cgemm_batch_strided( ord, ta, tb, p->m, p->n, p->k,
+				  al, p->a, lda, p->bs_a, p->b, ldb, p->bs_b,
+				  be, c, ldc, p->bs_c, p->batch );
+				break;
+			default:
+				cblas_zgemm_batch_strided( ord, ta, tb, p->m, p->n, p->k,
+				  al, p->a, lda, p->bs_a, p->b, ldb, p->bs_b,
+				  be, c, ldc, p->bs_c, p->batch );
+				break;
+		}
+		diff = check_batch( p, c );
+		REPORT( "cblas_?gemm_batch_strided" );
+	}
+#endif
+
+#undef REPORT
+
+	bli_free_user( c );
+	bli_free_user( ap );
+	bli_free_user( bp );
+	bli_free_user( cp );
+
+	return n_bad;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t   dts[]    = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const trans_t transs[] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE, BLIS_CONJ_TRANSPOSE };
+
+	// m, n, k, batch. The first cases use the fixed-size kernels; the
+	// last exceed BLIS_GEMM_BATCH_FIXED_MAX and use bli_gemm().
+	const dim_t shapes[][ 4 ] =
+	{
+		{  4,  4,  4,  1 },
+		{  3,  5,  7, 17 },
+		{  8,  8,  8, 64 },
+		{ 16, 16, 16,  9 },
+		{ 13,  2, 11, 33 },
+		{ 40, 24, 20,  5 },
+		{ 19, 67, 33, 12 },
+	};
+	const dim_t n_shapes = sizeof( shapes ) / sizeof( shapes[ 0 ] );
+
+	int  n_bad = 0;
+	char label[ 64 ];
+
+	bli_init();
+
+	for ( dim_t d = 0; d < 4; ++d )
+	{
+		const num_t  dt     = dts[ d ];
+		const double thresh = ( bli_dt_prec_is_single( dt ) ? 1e-4 : 1e-12 );
+		const dim_t  n_tr   = ( bli_is_complex( dt ) ? 3 : 2 );
+		char         dt_ch;
+
+		bli_param_map_blis_to_char_dt( dt, &dt_ch );
+
+		for ( dim_t s = 0; s < n_shapes; ++s )
+		for ( layout_t l = 0; l < NUM_LAYOUTS; ++l )
+		for ( dim_t ta = 0; ta < n_tr; ++ta )
+		for ( dim_t tb = 0; tb < n_tr; ++tb )
+		{
+			batch_t p;
+
+			init_batch( dt, transs[ ta ], transs[ tb ],
+			            shapes[ s ][ 0 ], shapes[ s ][ 1 ], shapes[ s ][ 2 ],
+			            shapes[ s ][ 3 ], l, &p );
+
+			sprintf( label, "%c %c%c %3ldx%3ldx%3ld x%3ld %-10s", dt_ch,
+			         trans_char( transs[ ta ] ), trans_char( transs[ tb ] ),
+			         ( long )p.m, ( long )p.n, ( long )p.k, ( long )p.batch,
+			         layout_str[ l ] );
+
+			n_bad += test_batch( &p, thresh, label );
+
+			free_batch( &p );
+		}
+	}
+
+	printf( "%s: %d failure(s)\n", n_bad ? "FAIL" : "PASS", n_bad );
+
+	bli_finalize();
+
+	return ( n_bad != 0 );
+}
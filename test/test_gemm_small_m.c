@@ -0,0 +1,182 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Check multithreaded gemm on problems with only one or two micropanels of
+// A (small m) or of B (small n), for which bli_packm_blk_var1() splits each
+// micropanel among the threads that pack it. The small-matrix (sup) path is
+// disabled so that the conventional packed path is always taken, and each
+// result is compared with that of a single-threaded bli_gemm_ex().
+
+typedef struct
+{
+	dim_t m, n, k;
+} shape_t;
+
+typedef struct
+{
+	dim_t       jc, ic, jr;
+	const char* label;
+} ways_t;
+
+static const shape_t shapes[] =
+{
+	{    6, 2000,  600 },
+	{    3, 3000,  800 },
+	{    1,  997,  301 },
+	{ 2000,    6,  600 },
+	{ 3000,    3,  800 },
+};
+
+// The ways used for 8 threads. A value of 0 lets BLIS choose them.
+static const ways_t ways[] =
+{
+	{ 0, 0, 0, "auto"       },
+	{ 1, 1, 8, "jc1 ic1 jr8" },
+	{ 2, 1, 4, "jc2 ic1 jr4" },
+	{ 1, 8, 1, "jc1 ic8 jr1" },
+	{ 8, 1, 1, "jc8 ic1 jr1" },
+};
+
+static const num_t   dts[]    = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+
+// A and B are either both stored by columns or both stored by rows (and
+// used transposed), so that each is packed from both storage schemes.
+static const trans_t transs[] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE };
+
+#define N_ELEM( x ) ( sizeof( x ) / sizeof( x[ 0 ] ) )
+
+int main( int argc, char** argv )
+{
+	const dim_t nt    = 8;
+	int         n_bad = 0;
+	int         n_run = 0;
+
+	bli_init();
+
+	for ( int di = 0; di < N_ELEM( dts ); ++di )
+	for ( int si = 0; si < N_ELEM( shapes ); ++si )
+	for ( int ti = 0; ti < N_ELEM( transs ); ++ti )
+	{
+		const num_t   dt     = dts[ di ];
+		const num_t   dt_r   = bli_dt_proj_to_real( dt );
+		const dim_t   m      = shapes[ si ].m;
+		const dim_t   n      = shapes[ si ].n;
+		const dim_t   k      = shapes[ si ].k;
+		const trans_t transa = transs[ ti ];
+		const trans_t transb = transs[ ti ];
+		const double  thresh = ( bli_dt_prec_is_single( dt ) ? 1e-4 : 1e-12 ) * k;
+		obj_t         a, b, c, c_ref, c_save, alpha, beta, norm;
+		rntm_t        rntm;
+		char          dt_ch;
+
+		bli_param_map_blis_to_char_dt( dt, &dt_ch );
+
+		if ( bli_does_trans( transa ) ) bli_obj_create( dt, k, m, 0, 0, &a );
+		else                            bli_obj_create( dt, m, k, 0, 0, &a );
+		if ( bli_does_trans( transb ) ) bli_obj_create( dt, n, k, 0, 0, &b );
+		else                            bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+		bli_obj_create( dt, m, n, 0, 0, &c_save );
+		bli_obj_create_1x1( dt, &alpha );
+		bli_obj_create_1x1( dt, &beta );
+		bli_obj_create_1x1( dt_r, &norm );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_obj_set_conjtrans( transa, &a );
+		bli_obj_set_conjtrans( transb, &b );
+		bli_randm( &c_save );
+		bli_setsc(  1.2, 0.3, &alpha );
+		bli_setsc( -0.7, 0.4, &beta );
+
+		bli_rntm_init( &rntm );
+		bli_rntm_disable_l3_sup( &rntm );
+		bli_rntm_set_num_threads( 1, &rntm );
+
+		bli_copym( &c_save, &c_ref );
+		bli_gemm_ex( &alpha, &a, &b, &beta, &c_ref, NULL, &rntm );
+
+		for ( int wi = 0; wi < N_ELEM( ways ); ++wi )
+		{
+			double d_r, d_i;
+			bool   bad;
+
+			bli_rntm_init( &rntm );
+			bli_rntm_disable_l3_sup( &rntm );
+
+			if ( ways[ wi ].jc == 0 )
+				bli_rntm_set_num_threads( nt, &rntm );
+			else
+				bli_rntm_set_ways( ways[ wi ].jc, 1, ways[ wi ].ic,
+				                   ways[ wi ].jr, 1, &rntm );
+
+			bli_copym( &c_save, &c );
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c, NULL, &rntm );
+
+			bli_subm( &c_ref, &c );
+			bli_normim( &c, &norm );
+			bli_getsc( &norm, &d_r, &d_i );
+
+			bad = !( d_r <= thresh );
+			if ( bad ) ++n_bad;
+			++n_run;
+
+			printf( "%cgemm %c%c m %5ld n %5ld k %4ld %-12s diff = %8.2e  %s\n",
+			        dt_ch,
+			        bli_does_trans( transa ) ? 't' : 'n',
+			        bli_does_trans( transb ) ? 't' : 'n',
+			        ( long )m, ( long )n, ( long )k, ways[ wi ].label,
+			        d_r, bad ? "FAIL" : "PASS" );
+		}
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+		bli_obj_free( &c_save );
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &norm );
+	}
+
+	printf( "%s: %d of %d check(s) failed\n", n_bad ? "FAIL" : "PASS", n_bad, n_run );
+
+	bli_finalize();
+
+	return ( n_bad != 0 );
+}
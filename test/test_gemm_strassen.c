@@ -0,0 +1,168 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Check Strassen's algorithm for sgemm and dgemm against the conventional
+// algorithm, with one and with two levels of recursion, on problems with odd
+// m, n and k (so that the leftover row, column and rank-1 update are
+// exercised), with and without transposition, and with beta = 0 and
+// beta != 0. The crossover is lowered to MIN_DIM through
+// BLIS_STRASSEN_MIN_DIM so that both levels apply at these sizes.
+//
+// The tolerance is the normwise bound stated in bli_gemm_strassen.h for L
+// levels, plus the bound of the conventional algorithm that the result is
+// compared with, for operands of order max( m, n, k ) with elements in
+// [-1,1], scaled by |alpha|.
+
+#define MIN_DIM "128"
+
+typedef struct
+{
+	dim_t   m, n, k;
+	trans_t transa, transb;
+} shape_t;
+
+static const shape_t shapes[] =
+{
+	{ 301, 263, 299, BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE },
+	{ 257, 513, 385, BLIS_TRANSPOSE,    BLIS_NO_TRANSPOSE },
+	{ 387, 259, 267, BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE    },
+};
+
+// The normwise error bound of L levels of Strassen's algorithm, in units of
+// u max| A | max| B |, for operands of order n (L = 0 is the conventional
+// algorithm).
+static double strassen_bound( dim_t levels, double n )
+{
+	if ( levels == 0 ) return n * n;
+
+	const double nl = n / ( double )( 1 << levels );
+
+	return pow( 12.0, levels ) * ( nl * nl + 5.0 * nl ) - 5.0 * n;
+}
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ch, opname, eps ) \
+\
+static int PASTEMAC(ch,opname)( const shape_t* s, dim_t levels, bool beta0 ) \
+{ \
+	const dim_t m   = s->m, n = s->n, k = s->k; \
+	const dim_t lda = ( bli_does_notrans( s->transa ) ? m : k ) + 3; \
+	const dim_t ldb = ( bli_does_notrans( s->transb ) ? k : n ) + 1; \
+	const dim_t ldc = m + 2; \
+	const dim_t na  = bli_does_notrans( s->transa ) ? k : m; \
+	const dim_t nb  = bli_does_notrans( s->transb ) ? n : k; \
+	ctype       alpha = 1.5, beta = beta0 ? 0.0 : 0.5; \
+	double      diff  = 0.0; \
+	rntm_t      rntm; \
+\
+	const double order = bli_max( m, bli_max( n, k ) ); \
+	const double tol   = bli_fabs( alpha ) * ( eps / 2.0 ) * \
+	                     ( strassen_bound( levels, order ) + \
+	                       strassen_bound( 0, order ) ); \
+\
+	ctype* a     = malloc( lda * na * sizeof( ctype ) ); \
+	ctype* b     = malloc( ldb * nb * sizeof( ctype ) ); \
+	ctype* c     = malloc( ldc * n * sizeof( ctype ) ); \
+	ctype* c_ref = malloc( ldc * n * sizeof( ctype ) ); \
+\
+	PASTEMAC(ch,randv)( lda * na, a, 1 ); \
+	PASTEMAC(ch,randv)( ldb * nb, b, 1 ); \
+	PASTEMAC(ch,randv)( ldc * n, c, 1 ); \
+	memcpy( c_ref, c, ldc * n * sizeof( ctype ) ); \
+\
+	bli_rntm_init_from_global( &rntm ); \
+	bli_rntm_set_strassen_levels( 0, &rntm ); \
+\
+	PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+	( \
+	  s->transa, s->transb, m, n, k, &alpha, a, 1, lda, b, 1, ldb, \
+	  &beta, c_ref, 1, ldc, NULL, &rntm \
+	); \
+\
+	bli_rntm_set_strassen_levels( levels, &rntm ); \
+\
+	PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+	( \
+	  s->transa, s->transb, m, n, k, &alpha, a, 1, lda, b, 1, ldb, \
+	  &beta, c, 1, ldc, NULL, &rntm \
+	); \
+\
+	for ( dim_t j = 0; j < n; ++j ) \
+	for ( dim_t i = 0; i < m; ++i ) \
+		diff = bli_max( diff, bli_fabs( c[ i + j * ldc ] - c_ref[ i + j * ldc ] ) ); \
+\
+	free( a ); \
+	free( b ); \
+	free( c ); \
+	free( c_ref ); \
+\
+	printf( "%c levels = %d m = %4d n = %4d k = %4d trans %c%c beta %s  diff = %8.2e  tol = %8.2e  %s\n", \
+	        #ch[ 0 ], ( int )levels, ( int )m, ( int )n, ( int )k, \
+	        bli_does_trans( s->transa ) ? 'T' : 'N', \
+	        bli_does_trans( s->transb ) ? 'T' : 'N', \
+	        beta0 ? "= 0 " : "!= 0", diff, tol, diff <= tol ? "PASS" : "FAIL" ); \
+\
+	return diff <= tol ? 0 : 1; \
+}
+
+GENTFUNCR( float,  s, test_gemm_strassen, FLT_EPSILON )
+GENTFUNCR( double, d, test_gemm_strassen, DBL_EPSILON )
+
+int main( int argc, char** argv )
+{
+	int n_bad = 0;
+
+	// The crossover is read the first time a gemm is considered for
+	// Strassen's algorithm.
+	setenv( "BLIS_STRASSEN_MIN_DIM", MIN_DIM, 1 );
+
+	bli_init();
+
+	for ( dim_t i = 0; i < sizeof( shapes ) / sizeof( shapes[ 0 ] ); ++i )
+	for ( dim_t levels = 1; levels <= BLIS_GEMM_STRASSEN_MAX_LEVELS; ++levels )
+	for ( int beta0 = 0; beta0 <= 1; ++beta0 )
+	{
+		n_bad += bli_stest_gemm_strassen( &shapes[ i ], levels, beta0 );
+		n_bad += bli_dtest_gemm_strassen( &shapes[ i ], levels, beta0 );
+	}
+
+	printf( "%s: %d failure(s)\n", n_bad == 0 ? "PASS" : "FAIL", n_bad );
+
+	bli_finalize();
+
+	return n_bad == 0 ? 0 : 1;
+}
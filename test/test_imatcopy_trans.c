@@ -0,0 +1,146 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Check the in-place transpose of ?imatcopy_() against an out-of-place
+// reference transpose computed from a copy of the input. The shapes cover
+// square and rectangular matrices, with and without padding of lda and ldb,
+// sizes whose row or column count has no divisor between 2 and 32, and
+// sizes large enough to be split across threads. Each case reports the
+// largest absolute difference from the reference.
+
+#define TOL_S 1.0e-5
+#define TOL_D 1.0e-12
+
+typedef struct
+{
+	f77_int m, n, lda, ldb;
+} shape_t;
+
+static const shape_t shapes[] =
+{
+	{    1,    1,    1,    1 },
+	{   32,   32,   32,   32 },
+	{  100,  100,  100,  100 },
+	{  100,  100,  103,  107 },
+	{    1,   17,    1,   17 },
+	{   17,    1,   17,    1 },
+	{   64,   48,   64,   48 },
+	{   48,   64,   50,   70 },
+	{   37,   96,   37,   96 },
+	{   96,   37,   99,   40 },
+	{   31,   29,   31,   29 },
+	{   31,   29,   35,   33 },
+	{  300,  257,  300,  257 },
+	{  257,  900,  260,  901 },
+	{  600,  512,  600,  512 },
+};
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, tol ) \
+\
+static int PASTEMAC(ch,opname)( char trans, const shape_t* s ) \
+{ \
+	const f77_int m    = s->m; \
+	const f77_int n    = s->n; \
+	f77_int       mf   = m, nf = n, lda = s->lda, ldb = s->ldb; \
+	const dim_t   size = bli_max( lda * n, ldb * m ); \
+	ctype         alpha; \
+	double        diff = 0.0; \
+\
+	ctype* a   = malloc( size * sizeof( ctype ) ); \
+	ctype* a_0 = malloc( size * sizeof( ctype ) ); \
+\
+	PASTEMAC(ch,sets)( 1.5, -0.5, alpha ); \
+\
+	PASTEMAC(ch,randv)( size, a, 1 ); \
+	memcpy( a_0, a, size * sizeof( ctype ) ); \
+\
+	PASTEF77(ch,imatcopy)( &trans, &mf, &nf, &alpha, a, &lda, &ldb ); \
+\
+	for ( dim_t j = 0; j < n; ++j ) \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ctype ref, x = a_0[ i + j * lda ]; \
+		ctype y = a[ j + i * ldb ]; \
+		double d; \
+\
+		if ( trans == 'C' ) PASTEMAC(ch,conjs)( x ); \
+		PASTEMAC(ch,scal2s)( alpha, x, ref ); \
+		PASTEMAC(ch,subs)( ref, y ); \
+		PASTEMAC2(ch,d,abval2s)( y, d ); \
+		diff = bli_max( diff, d ); \
+	} \
+\
+	free( a ); \
+	free( a_0 ); \
+\
+	printf( "%c %c m = %4d n = %4d lda = %4d ldb = %4d  diff = %8.2e  %s\n", \
+	        #ch[ 0 ], trans, ( int )m, ( int )n, ( int )s->lda, ( int )s->ldb, \
+	        diff, diff <= tol ? "PASS" : "FAIL" ); \
+\
+	return diff <= tol ? 0 : 1; \
+}
+
+GENTFUNC( float,    s, test_imatcopy_trans, TOL_S )
+GENTFUNC( double,   d, test_imatcopy_trans, TOL_D )
+GENTFUNC( scomplex, c, test_imatcopy_trans, TOL_S )
+GENTFUNC( dcomplex, z, test_imatcopy_trans, TOL_D )
+
+int main( int argc, char** argv )
+{
+	int n_bad = 0;
+
+	bli_init();
+
+	for ( dim_t k = 0; k < sizeof( shapes ) / sizeof( shapes[ 0 ] ); ++k )
+	{
+		const shape_t* s = &shapes[ k ];
+
+		n_bad += bli_stest_imatcopy_trans( 'T', s );
+		n_bad += bli_dtest_imatcopy_trans( 'T', s );
+		n_bad += bli_ctest_imatcopy_trans( 'T', s );
+		n_bad += bli_ztest_imatcopy_trans( 'T', s );
+		n_bad += bli_ctest_imatcopy_trans( 'C', s );
+		n_bad += bli_ztest_imatcopy_trans( 'C', s );
+	}
+
+	printf( "%s: %d failure(s)\n", n_bad == 0 ? "PASS" : "FAIL", n_bad );
+
+	bli_finalize();
+
+	return n_bad == 0 ? 0 : 1;
+}
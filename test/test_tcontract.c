@@ -0,0 +1,420 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2023, Advanced Micro Devices, Inc. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Check bao_?tcontract() from the tcontract addon against a direct loop
+// over every combination of mode indices. The cases cover contractions
+// that fold into a single gemm, contractions computed on block-scatter
+// views of the tensors (with C stored both ways, so that the roles of A
+// and B are swapped in one of them), and negative strides in each tensor.
+// Set BLIS_NUM_THREADS to exercise the threaded paths.
+
+#define MAX_LABELS 8
+
+typedef struct
+{
+	num_t  dt;
+	dim_t  ndim;
+	dim_t  len[ MAX_LABELS ];
+	inc_t  stride[ MAX_LABELS ];
+	char   idx[ MAX_LABELS + 1 ];
+
+	void*  buf;    // the allocated storage
+	inc_t  off;    // the offset of the element with all mode indices zero
+	siz_t  n_elem;
+} tensor_t;
+
+static dim_t label_pos( const char* labels, char x )
+{
+	return ( dim_t )( strchr( labels, x ) - labels );
+}
+
+// Create a tensor with modes idx, stored with the modes of order varying
+// from fastest to slowest. Each stride is padded by pad elements, and the
+// modes listed in neg are stored in reverse, with a negative stride.
+static void create_tensor
+     (
+       num_t dt, const char* idx, const char* order, const char* neg,
+       const char* labels, const dim_t* lens, dim_t pad, tensor_t* t
+     )
+{
+	inc_t stride = 1;
+
+	t->dt   = dt;
+	t->ndim = strlen( idx );
+	t->off  = 0;
+	strcpy( t->idx, idx );
+
+	for ( dim_t d = 0; d < t->ndim; ++d )
+		t->len[ d ] = lens[ label_pos( labels, idx[ d ] ) ];
+
+	for ( dim_t o = 0; order[ o ] != '\0'; ++o )
+	{
+		const dim_t d = label_pos( idx, order[ o ] );
+
+		t->stride[ d ] = stride;
+		stride        *= t->len[ d ] + pad;
+	}
+
+	for ( dim_t d = 0; d < t->ndim; ++d )
+	{
+		if ( strchr( neg, idx[ d ] ) == NULL || t->len[ d ] == 0 ) continue;
+
+		t->off        += ( t->len[ d ] - 1 ) * t->stride[ d ];
+		t->stride[ d ] = -t->stride[ d ];
+	}
+
+	t->n_elem = stride;
+	t->buf    = bli_malloc_user( bli_max( t->n_elem, 1 ) * bli_dt_size( dt ) );
+}
+
+static void free_tensor( tensor_t* t )
+{
+	bli_free_user( t->buf );
+}
+
+// Return the address of element zero of t, with which it is passed to
+// bao_?tcontract().
+static void* tensor_base( const tensor_t* t )
+{
+	return ( char* )t->buf + t->off * ( inc_t )bli_dt_size( t->dt );
+}
+
+// Return the offset in the buffer of t of the element at the given label
+// positions.
+static inc_t tensor_off( const tensor_t* t, const char* labels, const dim_t* pos )
+{
+	inc_t off = t->off;
+
+	for ( dim_t d = 0; d < t->ndim; ++d )
+		off += pos[ label_pos( labels, t->idx[ d ] ) ] * t->stride[ d ];
+
+	return off;
+}
+
+static void get_elem( num_t dt, void* p, inc_t i, double* re, double* im )
+{
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    *re = (( float*    )p)[ i ];      *im = 0.0; break;
+		case BLIS_DOUBLE:   *re = (( double*   )p)[ i ];      *im = 0.0; break;
+		case BLIS_SCOMPLEX: *re = (( scomplex* )p)[ i ].real;
+		                    *im = (( scomplex* )p)[ i ].imag; break;
+		default:            *re = (( dcomplex* )p)[ i ].real;
+		                    *im = (( dcomplex* )p)[ i ].imag; break;
+	}
+}
+
+static void set_elem( num_t dt, void* p, inc_t i, double re, double im )
+{
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    (( float*    )p)[ i ] = re; break;
+		case BLIS_DOUBLE:   (( double*   )p)[ i ] = re; break;
+		case BLIS_SCOMPLEX: (( scomplex* )p)[ i ].real = re;
+		                    (( scomplex* )p)[ i ].imag = im; break;
+		default:            (( dcomplex* )p)[ i ].real = re;
+		                    (( dcomplex* )p)[ i ].imag = im; break;
+	}
+}
+
+static void rand_tensor( tensor_t* t, bool nan_fill )
+{
+	for ( siz_t i = 0; i < t->n_elem; ++i )
+	{
+		if ( nan_fill ) set_elem( t->dt, t->buf, i, NAN, NAN );
+		else            set_elem( t->dt, t->buf, i,
+		                          ( rand() % 200 - 100 ) / 50.0,
+		                          ( rand() % 200 - 100 ) / 50.0 );
+	}
+}
+
+// Advance pos, the positions of the labels with the given lengths, with the
+// first label varying fastest. Return FALSE after the last position.
+static bool next_pos( dim_t n_labels, const dim_t* lens, dim_t* pos )
+{
+	for ( dim_t l = 0; l < n_labels; ++l )
+	{
+		if ( ++pos[ l ] < lens[ l ] ) return TRUE;
+		pos[ l ] = 0;
+	}
+	return FALSE;
+}
+
+#define CALL_TCONTRACT( ch, ctype ) \
+{ \
+	ctype alpha_l, beta_l; \
+\
+	PASTEMAC2(d,ch,copys)( alpha, alpha_l ); \
+	PASTEMAC2(d,ch,copys)( beta,  beta_l  ); \
+\
+	PASTECH2(bao_,ch,tcontract) \
+	( \
+	  &alpha_l, \
+	  a.ndim, a.len, a.stride, a.idx, tensor_base( &a ), \
+	  b.ndim, b.len, b.stride, b.idx, tensor_base( &b ), \
+	  &beta_l, \
+	  c.ndim, c.len, c.stride, c.idx, tensor_base( &c )  \
+	); \
+}
+
+// Compute C := beta * C + alpha * A * B for tensors with the given modes,
+// storage orders (fastest mode first) and negated modes, and return 1 if
+// the result differs from the reference. With nan_c, C, including its
+// padding, is initialized to NaN, which must not propagate when beta is
+// zero.
+static int test_tcontract
+     (
+       num_t dt, const char* labels, const dim_t* lens,
+       const char* idx_a, const char* ord_a,
+       const char* idx_b, const char* ord_b,
+       const char* idx_c, const char* ord_c,
+       const char* neg, dim_t pad, double alpha, double beta, bool nan_c,
+       const char* label
+     )
+{
+	const dim_t  n_labels = strlen( labels );
+	const double thresh   = ( bli_dt_prec_is_single( dt ) ? 1e-4 : 1e-12 );
+	tensor_t     a, b, c;
+	void*        c_ref;
+	dim_t        pos[ MAX_LABELS ]   = { 0 };
+	dim_t        len_c[ MAX_LABELS ];
+	bool         is_empty = FALSE;
+	bool         c_empty  = FALSE;
+	double       diff = 0.0, norm = 0.0;
+	char         dt_ch;
+
+	bli_param_map_blis_to_char_dt( dt, &dt_ch );
+
+	create_tensor( dt, idx_a, ord_a, neg, labels, lens, pad, &a );
+	create_tensor( dt, idx_b, ord_b, neg, labels, lens, pad, &b );
+	create_tensor( dt, idx_c, ord_c, neg, labels, lens, pad, &c );
+
+	rand_tensor( &a, FALSE );
+	rand_tensor( &b, FALSE );
+	rand_tensor( &c, nan_c );
+
+	c_ref = bli_malloc_user( bli_max( c.n_elem, 1 ) * bli_dt_size( dt ) );
+	memcpy( c_ref, c.buf, c.n_elem * bli_dt_size( dt ) );
+
+	// Compute the reference in a copy of C. First scale it by beta, visiting
+	// the labels of C only.
+	for ( dim_t l = 0; l < n_labels; ++l )
+	{
+		len_c[ l ] = ( strchr( idx_c, labels[ l ] ) ? lens[ l ] : 1 );
+		c_empty   |= ( len_c[ l ] == 0 );
+		is_empty  |= ( lens[ l ] == 0 );
+	}
+
+	if ( !c_empty )
+	do
+	{
+		const inc_t off_c = tensor_off( &c, labels, pos );
+		double      c_r, c_i;
+
+		get_elem( dt, c_ref, off_c, &c_r, &c_i );
+
+		if ( beta == 0.0 ) { c_r = 0.0;   c_i = 0.0;   }
+		else               { c_r *= beta; c_i *= beta; }
+
+		set_elem( dt, c_ref, off_c, c_r, c_i );
+	}
+	while ( next_pos( n_labels, len_c, pos ) );
+
+	// Then accumulate every product.
+	if ( !is_empty )
+	do
+	{
+		const inc_t off_c = tensor_off( &c, labels, pos );
+		double      a_r, a_i, b_r, b_i, c_r, c_i;
+
+		get_elem( dt, a.buf, tensor_off( &a, labels, pos ), &a_r, &a_i );
+		get_elem( dt, b.buf, tensor_off( &b, labels, pos ), &b_r, &b_i );
+		get_elem( dt, c_ref, off_c,                         &c_r, &c_i );
+
+		c_r += alpha * ( a_r * b_r - a_i * b_i );
+		c_i += alpha * ( a_r * b_i + a_i * b_r );
+
+		set_elem( dt, c_ref, off_c, c_r, c_i );
+	}
+	while ( next_pos( n_labels, lens, pos ) );
+
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    CALL_TCONTRACT( s, float );    break;
+		case BLIS_DOUBLE:   CALL_TCONTRACT( d, double );   break;
+		case BLIS_SCOMPLEX: CALL_TCONTRACT( c, scomplex ); break;
+		case BLIS_DCOMPLEX: CALL_TCONTRACT( z, dcomplex ); break;
+		default: break;
+	}
+
+	// Compare the whole buffer of C, so that writes to its padding are
+	// caught as well.
+	for ( siz_t i = 0; i < c.n_elem; ++i )
+	{
+		double x_r, x_i, y_r, y_i, d;
+
+		get_elem( dt, c.buf, i, &x_r, &x_i );
+		get_elem( dt, c_ref, i, &y_r, &y_i );
+
+		if ( y_r != y_r ) d = ( x_r != x_r ? 0.0 : INFINITY );
+		else              d = bli_fmaxabs( x_r - y_r, x_i - y_i );
+
+		if ( d != d ) d = INFINITY;
+		if ( d > diff ) diff = d;
+
+		if ( y_r == y_r ) norm = bli_fmaxabs( norm, bli_fmaxabs( y_r, y_i ) );
+	}
+
+	diff /= norm + 1.0;
+
+	const bool bad = !( diff <= thresh );
+
+	printf( "%ctcontract %-12s A %-4s/%-4s B %-4s/%-4s C %-4s/%-4s diff = %8.2e  %s\n",
+	        dt_ch, label, idx_a, ord_a, idx_b, ord_b, idx_c, ord_c,
+	        diff, bad ? "FAIL" : "PASS" );
+
+	free_tensor( &a );
+	free_tensor( &b );
+	free_tensor( &c );
+	bli_free_user( c_ref );
+
+	return bad;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t dts[] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	int         n_bad = 0;
+
+	bli_init();
+
+	for ( dim_t i = 0; i < 4; ++i )
+	{
+		const num_t dt = dts[ i ];
+
+		// Contractions whose m, n and k modes each fold into one stride, and
+		// which are computed as a single gemm.
+		{
+			const dim_t lens[] = { 37, 29, 41 };
+
+			n_bad += test_tcontract( dt, "ijk", lens, "ik", "ik", "kj", "kj", "ij", "ij",
+			                         "",  0,  1.5,  0.5, FALSE, "fold" );
+			n_bad += test_tcontract( dt, "ijk", lens, "ik", "ki", "kj", "jk", "ij", "ji",
+			                         "",  3,  1.0,  0.0, TRUE,  "fold" );
+		}
+		{
+			const dim_t lens[] = { 7, 6, 9, 5, 4 };
+
+			n_bad += test_tcontract( dt, "abcde", lens, "abde", "abde", "dec", "dec", "abc", "abc",
+			                         "",  0, -1.0,  1.0, FALSE, "fold" );
+		}
+
+		// Contractions computed on block-scatter views of the tensors. C is
+		// stored with its m modes fastest and then with its n modes fastest,
+		// so that one of the two swaps the roles of A and B.
+		{
+			const dim_t lens[] = { 13, 6, 5, 7, 9, 4 };
+
+			n_bad += test_tcontract( dt, "abcdef", lens, "aecf", "aecf", "fdeb", "fdeb", "abcd", "abcd",
+			                         "",  0,  1.0,  1.0, FALSE, "scatter" );
+			n_bad += test_tcontract( dt, "abcdef", lens, "aecf", "fcea", "fdeb", "bdef", "abcd", "dbca",
+			                         "",  1, -2.0,  0.0, TRUE,  "swap" );
+			n_bad += test_tcontract( dt, "abcdef", lens, "aecf", "cafe", "fdeb", "ebfd", "abcd", "cadb",
+			                         "",  0,  0.5, -1.0, FALSE, "scatter" );
+		}
+		{
+			const dim_t lens[] = { 40, 30, 9, 7, 25, 23 };
+
+			n_bad += test_tcontract( dt, "abcdef", lens, "aecf", "aecf", "fdeb", "fdeb", "abcd", "acbd",
+			                         "",  0,  1.0,  1.0, FALSE, "scatter" );
+			n_bad += test_tcontract( dt, "abcdef", lens, "aecf", "fcea", "fdeb", "bdef", "abcd", "dbca",
+			                         "",  0,  1.0,  0.0, FALSE, "swap" );
+		}
+		{
+			// k folds, but m does not.
+			const dim_t lens[] = { 40, 30, 9, 300 };
+
+			n_bad += test_tcontract( dt, "abck", lens, "akc", "akc", "kb", "kb", "abc", "abc",
+			                         "",  0,  1.0,  1.0, FALSE, "scatter" );
+			n_bad += test_tcontract( dt, "abck", lens, "akc", "kac", "kb", "bk", "abc", "bca",
+			                         "",  2,  1.0,  0.0, TRUE,  "swap" );
+		}
+
+		// Negative strides, in an otherwise foldable layout and in a
+		// block-scatter layout, for m, n and k modes.
+		{
+			const dim_t lens[] = { 37, 29, 41 };
+
+			n_bad += test_tcontract( dt, "ijk", lens, "ik", "ik", "kj", "kj", "ij", "ij",
+			                         "i", 0,  1.0,  0.5, FALSE, "neg" );
+			n_bad += test_tcontract( dt, "ijk", lens, "ik", "ik", "kj", "kj", "ij", "ij",
+			                         "k", 0,  1.0,  0.5, FALSE, "neg" );
+			n_bad += test_tcontract( dt, "ijk", lens, "ik", "ki", "kj", "jk", "ij", "ji",
+			                         "j", 1,  1.0,  0.0, TRUE,  "neg swap" );
+		}
+		{
+			const dim_t lens[] = { 13, 6, 5, 7, 9, 4 };
+
+			n_bad += test_tcontract( dt, "abcdef", lens, "aecf", "aecf", "fdeb", "fdeb", "abcd", "abcd",
+			                         "bef", 0,  1.0,  1.0, FALSE, "neg" );
+			n_bad += test_tcontract( dt, "abcdef", lens, "aecf", "fcea", "fdeb", "bdef", "abcd", "dbca",
+			                         "acd", 1, -1.0,  0.0, TRUE,  "neg swap" );
+		}
+
+		// Degenerate cases: k = 0, an outer product, and alpha = 0.
+		{
+			const dim_t lens[] = { 5, 3, 0 };
+
+			n_bad += test_tcontract( dt, "abc", lens, "ac", "ac", "cb", "cb", "ab", "ab",
+			                         "",  0,  1.0,  2.0, FALSE, "k=0" );
+		}
+		{
+			const dim_t lens[] = { 5, 3, 4, 2 };
+
+			n_bad += test_tcontract( dt, "abcd", lens, "ac", "ca", "bd", "db", "abcd", "cadb",
+			                         "",  0,  1.0,  2.0, FALSE, "outer" );
+			n_bad += test_tcontract( dt, "abcd", lens, "acd", "dca", "bd", "db", "abc", "cab",
+			                         "",  1,  0.0,  2.0, FALSE, "alpha=0" );
+		}
+	}
+
+	printf( "%s: %d failure(s)\n", n_bad ? "FAIL" : "PASS", n_bad );
+
+	bli_finalize();
+
+	return ( n_bad != 0 );
+}